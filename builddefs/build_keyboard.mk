@@ -532,6 +532,18 @@ ifeq ($(strip $(KEEP_INTERMEDIATES)), yes)
     OPT_DEFS += -save-temps=obj
 endif
 
+# Share identical objects between builds through a content addressed cache, as `qmk mass-compile` does
+# e.g.:
+#    make handwired/onekey/blackpill_f411:default COMPILE_CACHE_DIR=.build/cache/compile
+# With USE_CCACHE, whatever the cache doesn't have is compiled through ccache.
+ifneq ($(strip $(COMPILE_CACHE_DIR)),)
+    ifneq ($(filter-out no,$(strip $(USE_CCACHE))),)
+        CC_PREFIX ?= $(TOP_DIR)/util/compile_cache.sh --launcher ccache $(COMPILE_CACHE_DIR)
+    else
+        CC_PREFIX ?= $(TOP_DIR)/util/compile_cache.sh $(COMPILE_CACHE_DIR)
+    endif
+endif
+
 OUTPUTS := $(INTERMEDIATE_OUTPUT)
 $(INTERMEDIATE_OUTPUT)_SRC := $(SRC) $(PLATFORM_SRC)
 $(INTERMEDIATE_OUTPUT)_DEFS := \
@@ -131,6 +131,7 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         VPATH += $(QUANTUM_DIR)/pointing_device
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_accel.c
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -167,6 +168,15 @@ ifeq ($(strip $(QUANTUM_PAINTER_ENABLE)), yes)
     include $(QUANTUM_DIR)/painter/rules.mk
 endif
 
+# Caps Word, Layer Lock, Leader and Secure schedule their timeouts on the core deferred_exec table
+ifneq ($(filter yes,$(strip $(CAPS_WORD_ENABLE) $(LAYER_LOCK_ENABLE) $(LEADER_ENABLE) $(SECURE_ENABLE))),)
+    OPT_DEFS += -DDEFERRED_EXEC_CORE_ENABLE
+    # Otherwise built along with the user table, see generic_features.mk
+    ifneq ($(strip $(DEFERRED_EXEC_ENABLE)), yes)
+        SRC += $(QUANTUM_DIR)/deferred_exec.c
+    endif
+endif
+
 VALID_EEPROM_DRIVER_TYPES := vendor custom transient i2c spi wear_leveling legacy_stm32_flash
 EEPROM_DRIVER ?= vendor
 ifeq ($(filter $(EEPROM_DRIVER),$(VALID_EEPROM_DRIVER_TYPES)),)
@@ -247,6 +257,19 @@ else
   endif
 endif
 
+EEPROM_WRITE_CACHE_ENABLE ?= no
+ifeq ($(strip $(EEPROM_WRITE_CACHE_ENABLE)), yes)
+  ifeq ($(filter -DEEPROM_DRIVER,$(OPT_DEFS)),)
+    $(call CATASTROPHIC_ERROR,Invalid EEPROM_WRITE_CACHE_ENABLE,EEPROM_WRITE_CACHE_ENABLE requires an EEPROM_DRIVER implementation; EEPROM_DRIVER="$(EEPROM_DRIVER)" is not supported)
+  else ifeq ($(strip $(EEPROM_DRIVER)), custom)
+    # The cache takes over QMK's drivers by renaming their eeprom_read_block/eeprom_write_block, which a custom driver may not pick up
+    $(call CATASTROPHIC_ERROR,Invalid EEPROM_WRITE_CACHE_ENABLE,EEPROM_WRITE_CACHE_ENABLE does not support EEPROM_DRIVER="custom")
+  else
+    OPT_DEFS += -DEEPROM_WRITE_CACHE_ENABLE
+    SRC += eeprom_write_cache.c
+  endif
+endif
+
 VALID_WEAR_LEVELING_DRIVER_TYPES := custom embedded_flash spi_flash rp2040_flash legacy
 WEAR_LEVELING_DRIVER ?= none
 ifneq ($(strip $(WEAR_LEVELING_DRIVER)),none)
@@ -567,6 +590,13 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     ifeq ($(strip $(RGB_MATRIX_CUSTOM_USER)), yes)
         OPT_DEFS += -DRGB_MATRIX_CUSTOM_USER
     endif
+
+    ifeq ($(strip $(RGB_MATRIX_STREAM_ENABLE)), yes)
+        RAW_ENABLE := yes
+        OPT_DEFS += -DRGB_MATRIX_STREAM_ENABLE
+        COMMON_VPATH += $(QUANTUM_DIR)/led_stream
+        SRC += $(QUANTUM_DIR)/led_stream/led_stream.c
+    endif
 endif
 
 VARIABLE_TRACE ?= no
@@ -626,6 +656,11 @@ ifeq ($(strip $(VIA_ENABLE)), yes)
     RAW_ENABLE := yes
     BOOTMAGIC_ENABLE := yes
     TRI_LAYER_ENABLE := yes
+    ifeq ($(strip $(VIA_BULK_TRANSFER_ENABLE)), yes)
+        OPT_DEFS += -DVIA_BULK_TRANSFER_ENABLE
+        VPATH += $(QUANTUM_DIR)/bulk_transfer
+        SRC += $(QUANTUM_DIR)/bulk_transfer/bulk_transfer.c
+    endif
 endif
 
 VALID_CUSTOM_MATRIX_TYPES:= yes lite no
@@ -643,6 +678,14 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     ifneq ($(strip $(CUSTOM_MATRIX)), lite)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
+
+        ifeq ($(strip $(MATRIX_DMA_ENABLE)), yes)
+            ifneq ($(strip $(PLATFORM_KEY)), chibios)
+                $(call CATASTROPHIC_ERROR,Invalid MATRIX_DMA_ENABLE,MATRIX_DMA_ENABLE is only supported on ChibiOS)
+            endif
+            OPT_DEFS += -DMATRIX_DMA_ENABLE
+            SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)/matrix_dma.c
+        endif
     endif
 endif
 
@@ -675,6 +718,11 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
 
+        ifeq ($(strip $(SPLIT_TELEMETRY_ENABLE)), yes)
+            OPT_DEFS += -DSPLIT_TELEMETRY_ENABLE
+            QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_telemetry.c
+        endif
+
         # Functions added via QUANTUM_LIB_SRC are only included in the final binary if they're called.
         # Unused functions are pruned away, which is why we can add multiple drivers here without bloat.
         ifeq ($(PLATFORM),AVR)
@@ -42,6 +42,7 @@ GENERIC_FEATURES = \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    OUTPUT_QUEUE \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
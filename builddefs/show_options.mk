@@ -6,8 +6,10 @@ BUILD_OPTION_NAMES = \
   COMMAND_ENABLE \
   NKRO_ENABLE \
   CUSTOM_MATRIX \
+  MATRIX_DMA_ENABLE \
   DEBOUNCE_TYPE \
   SPLIT_KEYBOARD \
+  SPLIT_TELEMETRY_ENABLE \
   DYNAMIC_KEYMAP_ENABLE \
   USB_HID_ENABLE \
   VIA_ENABLE
@@ -17,6 +17,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#define EEPROM_WRITE_CACHE_FRONTEND
 #include "eeprom_driver.h"
 
 uint8_t eeprom_read_byte(const uint8_t *addr) {
@@ -22,3 +22,17 @@
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+
+#if defined(EEPROM_WRITE_CACHE_ENABLE)
+/* With the write cache enabled, eeprom_read_block/eeprom_write_block are provided by eeprom_write_cache.c, and
+ * QMK's driver implementations, which all include this header, are renamed to become its backing store. Custom
+ * drivers are rejected by the build instead. Code layered above the cache defines EEPROM_WRITE_CACHE_FRONTEND
+ * before including this header to keep using the cached versions. */
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len);
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len);
+
+#    if !defined(EEPROM_WRITE_CACHE_FRONTEND)
+#        define eeprom_read_block eeprom_driver_read_block
+#        define eeprom_write_block eeprom_driver_write_block
+#    endif
+#endif
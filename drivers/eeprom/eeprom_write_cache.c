@@ -0,0 +1,180 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdint.h>
+#include <string.h>
+
+#define EEPROM_WRITE_CACHE_FRONTEND
+#include "eeprom_driver.h"
+#include "eeprom_write_cache.h"
+#include "timer.h"
+
+typedef struct {
+    uintptr_t base;  // address of the first byte, a multiple of EEPROM_WRITE_CACHE_LINE_SIZE
+    uint16_t  dirty; // one bit per byte awaiting write-back, 0 when the line is free
+    uint16_t  since; // timer value when the line first became dirty
+    uint8_t   data[EEPROM_WRITE_CACHE_LINE_SIZE];
+} eeprom_write_cache_line_t;
+
+static eeprom_write_cache_line_t cache_lines[EEPROM_WRITE_CACHE_LINE_COUNT];
+static uint16_t                  last_write = 0;
+
+static eeprom_write_cache_line_t *eeprom_write_cache_find(uintptr_t base) {
+    for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_LINE_COUNT; i++) {
+        if (cache_lines[i].dirty && cache_lines[i].base == base) {
+            return &cache_lines[i];
+        }
+    }
+    return NULL;
+}
+
+static eeprom_write_cache_line_t *eeprom_write_cache_oldest(void) {
+    eeprom_write_cache_line_t *oldest = NULL;
+    uint16_t                   age    = 0;
+    for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_LINE_COUNT; i++) {
+        if (cache_lines[i].dirty) {
+            uint16_t elapsed = timer_elapsed(cache_lines[i].since);
+            if (oldest == NULL || elapsed > age) {
+                oldest = &cache_lines[i];
+                age    = elapsed;
+            }
+        }
+    }
+    return oldest;
+}
+
+/**
+ * @brief Writes the dirty bytes of a line back to the driver and frees the line
+ *
+ * Only the span between the first and last dirty byte is read back, and only runs of bytes that are both
+ * dirty and different from the backing store are written.
+ */
+static void eeprom_write_cache_write_back(eeprom_write_cache_line_t *line) {
+    uint8_t first = 0;
+    uint8_t last  = EEPROM_WRITE_CACHE_LINE_SIZE - 1;
+    while (!(line->dirty & (1u << first))) {
+        first++;
+    }
+    while (!(line->dirty & (1u << last))) {
+        last--;
+    }
+
+    uint8_t current[EEPROM_WRITE_CACHE_LINE_SIZE];
+    eeprom_driver_read_block(&current[first], (const void *)(line->base + first), last - first + 1);
+
+    uint8_t i = first;
+    while (i <= last) {
+        if (!(line->dirty & (1u << i)) || line->data[i] == current[i]) {
+            i++;
+            continue;
+        }
+        uint8_t start = i;
+        while (i <= last && (line->dirty & (1u << i)) && line->data[i] != current[i]) {
+            i++;
+        }
+        eeprom_driver_write_block(&line->data[start], (void *)(line->base + start), i - start);
+    }
+    line->dirty = 0;
+}
+
+/**
+ * @brief Reads from the backing store, with any bytes still pending in the cache overlaid
+ */
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_driver_read_block(buf, addr, len);
+
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end   = start + len;
+    for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_LINE_COUNT; i++) {
+        eeprom_write_cache_line_t *line = &cache_lines[i];
+        if (!line->dirty || line->base >= end || line->base + EEPROM_WRITE_CACHE_LINE_SIZE <= start) {
+            continue;
+        }
+        for (uint8_t j = 0; j < EEPROM_WRITE_CACHE_LINE_SIZE; j++) {
+            uintptr_t byte = line->base + j;
+            if ((line->dirty & (1u << j)) && byte >= start && byte < end) {
+                ((uint8_t *)buf)[byte - start] = line->data[j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Stores the data in the cache, evicting the oldest line when all lines are in use
+ */
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *src    = (const uint8_t *)buf;
+    uintptr_t      offset = (uintptr_t)addr;
+    uint16_t       now    = timer_read();
+
+    while (len > 0) {
+        uintptr_t base  = offset & ~(uintptr_t)(EEPROM_WRITE_CACHE_LINE_SIZE - 1);
+        uint8_t   start = offset - base;
+        uint8_t   count = EEPROM_WRITE_CACHE_LINE_SIZE - start;
+        if (count > len) {
+            count = len;
+        }
+
+        eeprom_write_cache_line_t *line = eeprom_write_cache_find(base);
+        if (line == NULL) {
+            for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_LINE_COUNT && line == NULL; i++) {
+                if (!cache_lines[i].dirty) {
+                    line = &cache_lines[i];
+                }
+            }
+            if (line == NULL) {
+                line = eeprom_write_cache_oldest();
+                eeprom_write_cache_write_back(line);
+            }
+            line->base  = base;
+            line->since = now;
+        }
+
+        memcpy(&line->data[start], src, count);
+        line->dirty |= (uint16_t)((((uint32_t)1 << count) - 1) << start);
+
+        src += count;
+        offset += count;
+        len -= count;
+    }
+    last_write = now;
+}
+
+/**
+ * @brief Writes back at most one line per call, once writes have settled or a line has been dirty for too long
+ */
+void eeprom_write_cache_task(void) {
+    eeprom_write_cache_line_t *oldest = eeprom_write_cache_oldest();
+    if (oldest == NULL) {
+        return;
+    }
+    if (timer_elapsed(last_write) >= EEPROM_WRITE_CACHE_IDLE_TIMEOUT || timer_elapsed(oldest->since) >= EEPROM_WRITE_CACHE_MAX_AGE) {
+        eeprom_write_cache_write_back(oldest);
+    }
+}
+
+/**
+ * @brief Writes back every pending line, used before reset, bootloader jump and suspend
+ */
+void eeprom_write_cache_flush(void) {
+    eeprom_write_cache_line_t *line;
+    while ((line = eeprom_write_cache_oldest()) != NULL) {
+        eeprom_write_cache_write_back(line);
+    }
+}
+
+/**
+ * @brief Drops every pending line without writing it, used when the backing store is being formatted
+ */
+void eeprom_write_cache_discard(void) {
+    memset(cache_lines, 0, sizeof(cache_lines));
+}
+
+bool eeprom_write_cache_is_dirty(void) {
+    for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_LINE_COUNT; i++) {
+        if (cache_lines[i].dirty) {
+            return true;
+        }
+    }
+    return false;
+}
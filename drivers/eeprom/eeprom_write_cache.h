@@ -0,0 +1,39 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * The write cache sits between eeprom_read/write/update_* and the selected EEPROM_DRIVER. Writes land in a
+ * small set of RAM lines and are written back from the housekeeping task once the firmware has been idle for a
+ * while, so repeated updates of the same bytes (eeconfig toggles, VIA keymap edits) reach the backing store once.
+ */
+
+// Number of bytes covered by a single cache line, fixed by the width of the dirty mask
+#define EEPROM_WRITE_CACHE_LINE_SIZE 16
+
+#ifndef EEPROM_WRITE_CACHE_LINE_COUNT
+#    define EEPROM_WRITE_CACHE_LINE_COUNT 8
+#endif
+
+// Time since the last write, in milliseconds, before dirty lines start being written back
+#ifndef EEPROM_WRITE_CACHE_IDLE_TIMEOUT
+#    define EEPROM_WRITE_CACHE_IDLE_TIMEOUT 250
+#endif
+
+// Time a line may stay dirty, in milliseconds, before it is written back even while writes keep arriving
+#ifndef EEPROM_WRITE_CACHE_MAX_AGE
+#    define EEPROM_WRITE_CACHE_MAX_AGE 2000
+#endif
+
+#if EEPROM_WRITE_CACHE_LINE_COUNT < 1 || EEPROM_WRITE_CACHE_LINE_COUNT > 255
+#    error "EEPROM_WRITE_CACHE_LINE_COUNT must be between 1 and 255"
+#endif
+
+void eeprom_write_cache_task(void);
+void eeprom_write_cache_flush(void);
+void eeprom_write_cache_discard(void);
+bool eeprom_write_cache_is_dirty(void);
@@ -17,6 +17,33 @@
 // for memcpy
 #include <string.h>
 
+#if defined(ENCODER_QUADRATURE_TIMER_SAMPLING) || defined(ENCODER_QUADRATURE_PIN_CHANGE_SAMPLING)
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error "Built-in encoder ISR sampling is only supported on ChibiOS, use ENCODER_QUADRATURE_ISR_SAMPLING with your own interrupt instead"
+#    endif
+#    if defined(ENCODER_QUADRATURE_TIMER_SAMPLING) && defined(ENCODER_QUADRATURE_PIN_CHANGE_SAMPLING)
+#        error "Only one of ENCODER_QUADRATURE_TIMER_SAMPLING or ENCODER_QUADRATURE_PIN_CHANGE_SAMPLING can be enabled"
+#    endif
+#    include <ch.h>
+#    include <hal.h>
+#    ifndef ENCODER_QUADRATURE_ISR_SAMPLING
+#        define ENCODER_QUADRATURE_ISR_SAMPLING
+#    endif
+#endif
+
+#ifdef ENCODER_QUADRATURE_ISR_SAMPLING
+#    ifndef ENCODER_QUADRATURE_ISR_QUEUE_SIZE
+#        define ENCODER_QUADRATURE_ISR_QUEUE_SIZE 16
+#    endif
+#    if (ENCODER_QUADRATURE_ISR_QUEUE_SIZE & (ENCODER_QUADRATURE_ISR_QUEUE_SIZE - 1)) != 0 || ENCODER_QUADRATURE_ISR_QUEUE_SIZE > 128
+#        error "ENCODER_QUADRATURE_ISR_QUEUE_SIZE must be a power of two, no larger than 128"
+#    endif
+#endif
+
+#if defined(ENCODER_QUADRATURE_TIMER_SAMPLING) && !defined(ENCODER_QUADRATURE_SAMPLE_INTERVAL_US)
+#    define ENCODER_QUADRATURE_SAMPLE_INTERVAL_US 250
+#endif
+
 #if !defined(ENCODER_RESOLUTIONS) && !defined(ENCODER_RESOLUTION)
 #    define ENCODER_RESOLUTION 4
 #endif
@@ -74,6 +101,44 @@ static int8_t encoder_LUT[] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1,
 static uint8_t encoder_state[NUM_ENCODERS]  = {0};
 static int8_t  encoder_pulses[NUM_ENCODERS] = {0};
 
+#ifdef ENCODER_QUADRATURE_ISR_SAMPLING
+// Single-producer/single-consumer ring between the sampling interrupt and encoder_driver_task().
+// Only the interrupt writes head, only the main loop writes tail, so neither side needs a critical section.
+typedef struct encoder_isr_ring_t {
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    encoder_event_t  queue[ENCODER_QUADRATURE_ISR_QUEUE_SIZE];
+} encoder_isr_ring_t;
+
+static encoder_isr_ring_t         encoder_isr_ring;
+static encoder_quadrature_stats_t encoder_isr_stats;
+
+#    define ENCODER_ISR_RING_MASK (ENCODER_QUADRATURE_ISR_QUEUE_SIZE - 1)
+#    define ENCODER_ISR_BARRIER() __asm__ volatile("" ::: "memory")
+
+static void encoder_isr_ring_push(uint8_t index, bool clockwise) {
+    uint8_t head = encoder_isr_ring.head;
+    uint8_t next = (head + 1) & ENCODER_ISR_RING_MASK;
+    if (next == encoder_isr_ring.tail) {
+        encoder_isr_stats.overflows++;
+        return;
+    }
+    encoder_isr_ring.queue[head] = (encoder_event_t){.index = index, .clockwise = clockwise ? 1 : 0};
+    // Publish the slot contents before the new head
+    ENCODER_ISR_BARRIER();
+    encoder_isr_ring.head = next;
+    encoder_isr_stats.events++;
+}
+#endif // ENCODER_QUADRATURE_ISR_SAMPLING
+
+static inline void encoder_quadrature_emit_event(uint8_t index, bool clockwise) {
+#ifdef ENCODER_QUADRATURE_ISR_SAMPLING
+    encoder_isr_ring_push(index, clockwise);
+#else
+    encoder_queue_event(index, clockwise);
+#endif
+}
+
 // encoder counts
 static uint8_t thisCount;
 #ifdef SPLIT_KEYBOARD
@@ -104,6 +169,10 @@ void encoder_quadrature_post_init(void) {
 #endif
 
     encoder_quadrature_post_init_kb();
+
+#if defined(ENCODER_QUADRATURE_TIMER_SAMPLING) || defined(ENCODER_QUADRATURE_PIN_CHANGE_SAMPLING)
+    encoder_quadrature_sampling_start();
+#endif
 }
 
 void encoder_driver_init(void) {
@@ -123,6 +192,10 @@ void encoder_driver_init(void) {
     // here, but it's the simplest solution.
     memset(encoder_state, 0, sizeof(encoder_state));
     memset(encoder_pulses, 0, sizeof(encoder_pulses));
+#    ifdef ENCODER_QUADRATURE_ISR_SAMPLING
+    memset(&encoder_isr_ring, 0, sizeof(encoder_isr_ring));
+    memset(&encoder_isr_stats, 0, sizeof(encoder_isr_stats));
+#    endif
     const pin_t encoders_pad_a_left[] = ENCODER_A_PINS;
     const pin_t encoders_pad_b_left[] = ENCODER_B_PINS;
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -180,7 +253,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
     if (encoder_pulses[i] >= resolution) {
 #endif
 
-            encoder_queue_event(index, ENCODER_COUNTER_CLOCKWISE);
+            encoder_quadrature_emit_event(index, ENCODER_COUNTER_CLOCKWISE);
         }
 
 #ifdef ENCODER_DEFAULT_POS
@@ -188,7 +261,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
 #else
     if (encoder_pulses[i] <= -resolution) { // direction is arbitrary here, but this clockwise
 #endif
-            encoder_queue_event(index, ENCODER_CLOCKWISE);
+            encoder_quadrature_emit_event(index, ENCODER_CLOCKWISE);
         }
         encoder_pulses[i] %= resolution;
 #ifdef ENCODER_DEFAULT_POS
@@ -206,8 +279,97 @@ void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t
     }
 }
 
+#ifdef ENCODER_QUADRATURE_ISR_SAMPLING
+
+/**
+ * @brief Samples every encoder on this side once. Safe to call from an interrupt.
+ */
+void encoder_quadrature_sample_isr(void) {
+    for (uint8_t i = 0; i < thisCount; i++) {
+        encoder_quadrature_handle_read(i, encoder_quadrature_read_pin(i, false), encoder_quadrature_read_pin(i, true));
+    }
+    encoder_isr_stats.samples++;
+}
+
+void encoder_quadrature_get_stats(encoder_quadrature_stats_t *stats) {
+    // Counters are only written by the interrupt; re-read until a consistent snapshot is seen rather than locking
+    do {
+        memcpy(stats, (const void *)&encoder_isr_stats, sizeof(encoder_quadrature_stats_t));
+        ENCODER_ISR_BARRIER();
+    } while (memcmp(stats, (const void *)&encoder_isr_stats, sizeof(encoder_quadrature_stats_t)) != 0);
+#    ifdef ENCODER_QUADRATURE_TIMER_SAMPLING
+    stats->sample_interval_us = ENCODER_QUADRATURE_SAMPLE_INTERVAL_US;
+#    endif
+}
+
+#    if defined(ENCODER_QUADRATURE_TIMER_SAMPLING)
+
+static virtual_timer_t encoder_sample_timer;
+
+static void encoder_quadrature_sample_timer_cb(struct ch_virtual_timer *timer, void *arg) {
+    (void)arg;
+    chSysLockFromISR();
+    encoder_quadrature_sample_isr();
+    chVTSetI(&encoder_sample_timer, TIME_US2I(ENCODER_QUADRATURE_SAMPLE_INTERVAL_US), encoder_quadrature_sample_timer_cb, NULL);
+    chSysUnlockFromISR();
+}
+
+void encoder_quadrature_sampling_start(void) {
+    chVTObjectInit(&encoder_sample_timer);
+    chVTSet(&encoder_sample_timer, TIME_US2I(ENCODER_QUADRATURE_SAMPLE_INTERVAL_US), encoder_quadrature_sample_timer_cb, NULL);
+}
+
+#    elif defined(ENCODER_QUADRATURE_PIN_CHANGE_SAMPLING)
+#        if !defined(ENCODER_DEFAULT_PIN_API_IMPL)
+#            error "ENCODER_QUADRATURE_PIN_CHANGE_SAMPLING requires ENCODER_A_PINS and ENCODER_B_PINS"
+#        endif
+#        if !PAL_USE_CALLBACKS
+#            error "ENCODER_QUADRATURE_PIN_CHANGE_SAMPLING requires PAL_USE_CALLBACKS to be TRUE in halconf.h"
+#        endif
+
+static void encoder_quadrature_pin_change_cb(void *arg) {
+    uint8_t index = (uint8_t)(uintptr_t)arg;
+    // EXTI vectors may have differing priorities, lock so that there is only ever a single producer
+    chSysLockFromISR();
+    encoder_quadrature_handle_read(index, encoder_quadrature_read_pin(index, false), encoder_quadrature_read_pin(index, true));
+    encoder_isr_stats.samples++;
+    chSysUnlockFromISR();
+}
+
+void encoder_quadrature_sampling_start(void) {
+    for (uint8_t i = 0; i < thisCount; i++) {
+        pin_t pins[] = {encoders_pad_a[i], encoders_pad_b[i]};
+        for (uint8_t p = 0; p < ARRAY_SIZE(pins); p++) {
+            if (pins[p] != NO_PIN) {
+                palEnableLineEvent(pins[p], PAL_EVENT_MODE_BOTH_EDGES);
+                palSetLineCallback(pins[p], encoder_quadrature_pin_change_cb, (void *)(uintptr_t)i);
+            }
+        }
+    }
+}
+
+#    endif
+
+__attribute__((weak)) void encoder_driver_task(void) {
+    // Move events from the interrupt ring into the main encoder queue, leaving them in place if that queue is full
+    while (encoder_isr_ring.tail != encoder_isr_ring.head) {
+        uint8_t         tail  = encoder_isr_ring.tail;
+        encoder_event_t event = encoder_isr_ring.queue[tail];
+        if (!encoder_queue_event(event.index, event.clockwise)) {
+            break;
+        }
+        // Finish reading the slot before handing it back to the producer
+        ENCODER_ISR_BARRIER();
+        encoder_isr_ring.tail = (tail + 1) & ENCODER_ISR_RING_MASK;
+    }
+}
+
+#else // ENCODER_QUADRATURE_ISR_SAMPLING
+
 __attribute__((weak)) void encoder_driver_task(void) {
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_quadrature_handle_read(i, encoder_quadrature_read_pin(i, false), encoder_quadrature_read_pin(i, true));
     }
 }
+
+#endif // ENCODER_QUADRATURE_ISR_SAMPLING
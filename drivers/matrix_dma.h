@@ -0,0 +1,35 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+/**
+ * \brief Start scanning the matrix in hardware.
+ *
+ * A timer selects one row per period and samples the column port part way through it, continuously and without the CPU.
+ *
+ * \param row_pins The row pins, selected by driving them low.
+ * \param row_count The number of rows.
+ * \param col_port The port every column pin is on.
+ *
+ * \return false if the rows or the MCU cannot be scanned this way, and the matrix must be scanned in software.
+ */
+bool matrix_dma_start(const pin_t row_pins[], uint8_t row_count, gpio_port_t col_port);
+
+/**
+ * \brief Stop scanning the matrix in hardware, releasing the timer and DMA streams.
+ *
+ * The row pins are left as they were, the caller must set them up again before scanning in software.
+ */
+void matrix_dma_stop(void);
+
+/**
+ * \brief Copy out the column port samples of the last complete scan, one per row.
+ *
+ * \return false if no scan has completed since the last call, leaving `samples` untouched.
+ */
+bool matrix_dma_read(gpio_port_value_t samples[]);
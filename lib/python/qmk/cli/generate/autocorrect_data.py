@@ -165,80 +165,135 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
+def make_leaf_data(typo: str, correction: str) -> List[int]:
+    """Encodes the backspace count and replacement text for a typo."""
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    return [backspaces + 128] + list(bytes(correction[i:], 'ascii')) + [0]
+
+
+def make_dawg(trie: Dict[str, Any]) -> Dict[str, Any]:
+    """Merges identical subtrees of the trie, turning it into a directed acyclic word graph.
+  Typos that end the same way and share their correction tail, or that share
+  whole groups of such entries, then only get serialized once.
+  Args:
+    trie: Dict of dicts, as returned by make_trie.
+  Returns:
+    Root node of the graph. Nodes are dicts with a 'kind' of 'leaf', 'chain' or
+    'branch', and equal nodes are the same object.
+  """
+    nodes = {}
+
+    def intern(node):
+        return nodes.setdefault(node['key'], node)
+
+    def build(trie_node):
+        if 'LEAF' in trie_node:
+            data = make_leaf_data(*trie_node['LEAF'])
+            return intern({'kind': 'leaf', 'data': data, 'key': ('leaf', tuple(data))})
+        elif len(trie_node) == 1:
+            # Collapse runs of single-child nodes into one chain.
+            chars = ''
+            while len(trie_node) == 1 and 'LEAF' not in trie_node:
+                c, trie_node = next(iter(trie_node.items()))
+                chars += c
+            child = build(trie_node)
+            return intern({'kind': 'chain', 'chars': chars, 'links': [child], 'key': ('chain', chars, id(child))})
+        else:
+            chars = ''.join(sorted(trie_node.keys()))
+            links = [build(trie_node[c]) for c in chars]
+            return intern({'kind': 'branch', 'chars': chars, 'links': links, 'key': ('branch', chars, tuple(map(id, links)))})
+
+    return build(trie)
+
+
+def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any], offset_size: int = 0) -> Tuple[List[int], int]:
     """Serializes trie and correction data in a form readable by the C code.
+  Shared subtrees are written once and linked to from every parent. A chain is
+  followed in the table by its child, so when that child already lives
+  elsewhere the last letter of the chain becomes a single-entry branch instead.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
+    offset_size: Bytes per node link, 2 or 3. Zero picks the smallest that fits.
   Returns:
-    List of ints in the range 0-255.
+    List of ints in the range 0-255, and the number of bytes per node link.
   """
     table = []
-
-    # Traverse trie in depth first order.
-    def traverse(trie_node):
-        if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
-            table.append(entry)
-        elif len(trie_node) == 1:  # Handle trie node with a single child.
-            c, trie_node = next(iter(trie_node.items()))
-            entry = {'chars': c, 'byte_offset': 0}
-
-            # It's common for a trie to have long chains of single-child nodes. We
-            # find the whole chain so that we can serialize it more efficiently.
-            while len(trie_node) == 1 and 'LEAF' not in trie_node:
-                c, trie_node = next(iter(trie_node.items()))
-                entry['chars'] += c
-
+    placed = {}  # Node id -> (entry, byte offset within the entry).
+    chain_tails = {}  # (chars, child id) -> (entry, byte offset), for every tail of a serialized chain.
+
+    # Traverse graph in depth first order, serializing each node the first time it is reached.
+    def traverse(node):
+        if id(node) in placed:
+            return
+        if node['kind'] == 'chain':
+            chars, child = node['chars'], node['links'][0]
+            tail = chain_tails.get((chars, id(child)))
+            if tail:
+                placed[id(node)] = tail
+            elif id(child) in placed:
+                if len(chars) > 1:
+                    entry = {'chars': chars[:-1], 'links': []}
+                    table.append(entry)
+                    placed[id(node)] = (entry, 0)
+                branch = {'chars': chars[-1], 'links': [child]}
+                table.append(branch)
+                placed.setdefault(id(node), (branch, 0))
+            else:
+                entry = {'chars': chars, 'links': []}
+                table.append(entry)
+                placed[id(node)] = (entry, 0)
+                for i in range(len(chars)):
+                    chain_tails[(chars[i:], id(child))] = (entry, i)
+                traverse(child)
+        elif node['kind'] == 'branch':
+            entry = {'chars': node['chars'], 'links': node['links']}
             table.append(entry)
-            entry['links'] = [traverse(trie_node)]
-        else:  # Handle trie node with multiple children.
-            entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
+            placed[id(node)] = (entry, 0)
+            for child in node['links']:
+                traverse(child)
+        else:
+            entry = {'data': node['data']}
             table.append(entry)
-            entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
-        return entry
+            placed[id(node)] = (entry, 0)
 
-    traverse(trie)
+    traverse(make_dawg(trie))
 
-    def serialize(e: Dict[str, Any]) -> List[int]:
-        if not e['links']:  # Handle a leaf table entry.
+    def serialize(e: Dict[str, Any], offset_size: int) -> List[int]:
+        if 'data' in e:  # Handle a leaf table entry.
             return e['data']
-        elif len(e['links']) == 1:  # Handle a chain table entry.
-            return [TYPO_CHARS[c] for c in e['chars']] + [0]  # + encode_link(e['links'][0]))
+        elif not e['links']:  # Handle a chain table entry, its child follows immediately.
+            return [TYPO_CHARS[c] for c in e['chars']] + [0]
         else:  # Handle a branch table entry.
             data = []
             for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
+                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(placed[id(link)], offset_size)
             return data + [0]
 
-    byte_offset = 0
-    for e in table:  # To encode links, first compute byte offset of each entry.
-        e['byte_offset'] = byte_offset
-        byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
+    for size in [offset_size] if offset_size else [2, 3]:
+        byte_offset = 0
+        for e in table:  # To encode links, first compute byte offset of each entry.
+            e['byte_offset'] = byte_offset
+            byte_offset += 1 + len(e['chars']) * (1 + size) if e.get('links') else len(serialize(e, size))
+        if byte_offset <= 1 << (8 * size):
+            break
 
-    return [b for e in table for b in serialize(e)]  # Serialize final table.
+    return [b for e in table for b in serialize(e, size)], size  # Serialize final table.
 
 
-def encode_link(link: Dict[str, Any]) -> List[int]:
-    """Encodes a node link as two bytes."""
-    byte_offset = link['byte_offset']
-    if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+def encode_link(link: Tuple[Dict[str, Any], int], offset_size: int) -> List[int]:
+    """Encodes a node link as `offset_size` little endian bytes."""
+    byte_offset = link[0]['byte_offset'] + link[1]
+    if not (0 <= byte_offset < 1 << (8 * offset_size)):
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds %dKB limit. Try reducing the autocorrection dict to fewer entries.', 1 << (8 * offset_size - 10))
         maybe_exit(1)
-    return [byte_offset & 255, byte_offset >> 8]
+    return [(byte_offset >> (8 * i)) & 255 for i in range(offset_size)]
 
 
 def typo_len(e: Tuple[str, str]) -> int:
@@ -254,11 +309,12 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('--offset-size', arg_only=True, type=int, choices=[2, 3], default=0, help='Bytes per trie node link. Defaults to the smallest size that fits the dictionary.')
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    data, offset_size = serialize_trie(autocorrections, trie, cli.args.offset_size)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +338,8 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if offset_size != 2:
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_OFFSET_SIZE {offset_size}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
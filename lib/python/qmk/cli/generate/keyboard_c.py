@@ -56,12 +56,82 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+
+    if config_type == 'rgb_matrix':
+        lines.extend(_gen_led_polar(info_data, config_type))
+
     lines.append('#endif')
     lines.append('')
 
     return lines
 
 
+def _c_div(a, b):
+    """Integer division truncating towards zero, as C does
+    """
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def _sqrt16(x):
+    """Port of lib8tion sqrt16(), so generated distances match the ones computed at runtime
+    """
+    x &= 0xFFFF
+    if x <= 1:
+        return x
+
+    low = 1
+    hi = 255 if x > 7904 else (x >> 5) + 8
+    while True:
+        mid = (low + hi) >> 1
+        if ((mid * mid) & 0xFFFF) > x:
+            hi = (mid - 1) & 0xFF
+        else:
+            if mid == 255:
+                return 255
+            low = mid + 1
+        if hi < low:
+            break
+
+    return low - 1
+
+
+def _atan2_8(dy, dx):
+    """Port of lib8tion atan2_8(), so generated angles match the ones computed at runtime
+    """
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = 32 - _c_div(32 * (dx - abs_y), dx + abs_y)
+    else:
+        a = 96 - _c_div(32 * (dx + abs_y), abs_y - dx)
+
+    # int8_t storage, then the uint8_t return value
+    a = ((a + 128) & 0xFF) - 128
+    return (-a if dy < 0 else a) & 0xFF
+
+
+def _gen_led_polar(info_data, config_type):
+    """Precompute each LED's offset, distance and angle from the center point, for the effect runners
+    """
+    center_x, center_y = info_data[config_type].get('center_point', [112, 32])
+
+    polar = []
+    for led_data in info_data[config_type]['layout']:
+        dx = led_data.get('x', 0) - center_x
+        dy = led_data.get('y', 0) - center_y
+        polar.append(f'{{{dx}, {dy}, {_sqrt16(dx * dx + dy * dy)}, {_atan2_8(dy, dx)}}}')
+
+    lines = []
+    lines.append('__attribute__ ((weak)) const led_polar_t g_rgb_matrix_led_polar[RGB_MATRIX_LED_COUNT] PROGMEM = {')
+    lines.append(f'  {", ".join(polar)}')
+    lines.append('};')
+
+    return lines
+
+
 def _gen_matrix_mask(info_data):
     """Convert info.json content to matrix_mask
     """
@@ -136,7 +206,7 @@ def generate_keyboard_c(cli):
     kb_info_json = info_json(cli.args.keyboard)
 
     # Build the layouts.h file.
-    keyboard_h_lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#include QMK_KEYBOARD_H', '']
+    keyboard_h_lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#include QMK_KEYBOARD_H', '#include "progmem.h"', '']
 
     keyboard_h_lines.extend(_gen_led_configs(kb_info_json))
     keyboard_h_lines.extend(_gen_matrix_mask(kb_info_json))
@@ -3,6 +3,7 @@
 This will compile everything in parallel, for testing purposes.
 """
 import os
+import time
 from typing import List
 from pathlib import Path
 from subprocess import DEVNULL
@@ -16,7 +17,7 @@ from qmk.build_targets import BuildTarget, JsonKeymapBuildTarget
 from qmk.util import maybe_exit_config
 
 
-def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool, no_temp: bool, parallel: int, **env):
+def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool, no_temp: bool, parallel: int, compile_cache: bool = True, **env):
     if len(targets) == 0:
         return
 
@@ -25,6 +26,7 @@ def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool,
     make_cmd = find_make()
     builddir = Path(QMK_FIRMWARE) / '.build'
     makefile = builddir / 'parallel_kb_builds.mk'
+    cache_stats = builddir / f'compile_cache.{os.getpid()}'
 
     if dry_run:
         cli.log.info('Compilation targets:')
@@ -36,6 +38,15 @@ def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool,
             cli.run([make_cmd, 'clean'], capture_output=False, stdin=DEVNULL)
 
         builddir.mkdir(parents=True, exist_ok=True)
+
+        # Identical objects are only compiled once across all the builds, see util/compile_cache.sh
+        make_env = None
+        if compile_cache:
+            env.setdefault('COMPILE_CACHE_DIR', '.build/cache/compile')
+            make_env = {**os.environ, 'COMPILE_CACHE_STATS': cache_stats.as_posix()}
+            if cache_stats.exists():
+                cache_stats.unlink()
+
         with open(makefile, "w") as f:
             for target in sorted(targets, key=lambda t: (t.keyboard, t.keymap)):
                 keyboard_name = target.keyboard
@@ -85,7 +96,15 @@ all: {target_filename}{target_suffix}_binary
                     # yapf: enable
                 f.write('\n')
 
-        cli.run([find_make(), *get_make_parallel_args(parallel), '-f', makefile.as_posix(), 'all'], capture_output=False, stdin=DEVNULL)
+        start = time.monotonic()
+        cli.run([find_make(), *get_make_parallel_args(parallel), '-f', makefile.as_posix(), 'all'], capture_output=False, stdin=DEVNULL, env=make_env)
+        cli.log.info(f'Compiled {len(targets)} targets in {time.monotonic() - start:.1f}s.')
+
+        if cache_stats.exists():
+            results = cache_stats.read_text().split()
+            hits = results.count('hit')
+            cli.log.info(f'Compile cache: reused {hits} of {len(results)} objects ({100 * hits / max(len(results), 1):.1f}%).')
+            cache_stats.unlink()
 
         # Check for failures
         failures = [f for f in builddir.glob(f'failed.log.{os.getpid()}.*')]
@@ -109,6 +128,7 @@ all: {target_filename}{target_suffix}_binary
 )
 @cli.argument('-km', '--keymap', type=str, default='default', help="The keymap name to build. Default is 'default'.")
 @cli.argument('-e', '--env', arg_only=True, action='append', default=[], help="Set a variable to be passed to make. May be passed multiple times.")
+@cli.argument('--no-compile-cache', arg_only=True, action='store_true', help="Compile every object for every keyboard, rather than sharing identical ones between them.")
 @cli.subcommand('Compile QMK Firmware for all keyboards.', hidden=False if cli.config.user.developer else True)
 def mass_compile(cli):
     """Compile QMK Firmware against all keyboards.
@@ -123,4 +143,4 @@ def mass_compile(cli):
     else:
         targets = search_keymap_targets([('all', cli.config.mass_compile.keymap)], cli.args.filter)
 
-    return mass_compile_targets(targets, cli.args.clean, cli.args.dry_run, cli.args.no_temp, cli.config.mass_compile.parallel, **build_environment(cli.args.env))
+    return mass_compile_targets(targets, cli.args.clean, cli.args.dry_run, cli.args.no_temp, cli.config.mass_compile.parallel, not cli.args.no_compile_cache, **build_environment(cli.args.env))
@@ -2,13 +2,19 @@
 """
 import re
 import os
+import contextlib
+import hashlib
+import logging
+import pickle
+import tempfile
+from functools import lru_cache
 from pathlib import Path
 import jsonschema
 from dotty_dict import dotty
 
 from milc import cli
 
-from qmk.constants import COL_LETTERS, ROW_LETTERS, CHIBIOS_PROCESSORS, LUFA_PROCESSORS, VUSB_PROCESSORS, JOYSTICK_AXES
+from qmk.constants import BUILD_DIR, COL_LETTERS, ROW_LETTERS, CHIBIOS_PROCESSORS, LUFA_PROCESSORS, VUSB_PROCESSORS, JOYSTICK_AXES
 from qmk.c_parse import find_layouts, parse_config_h_file, find_led_config
 from qmk.json_schema import deep_update, json_load, validate
 from qmk.keyboard import config_h, rules_mk
@@ -20,6 +26,8 @@ from qmk.util import maybe_exit, truthy
 true_values = ['1', 'on', 'yes']
 false_values = ['0', 'off', 'no']
 
+INFO_JSON_CACHE_PATH = Path(BUILD_DIR) / 'cache' / 'info_json'
+
 
 def _keyboard_in_layout_name(keyboard, layout):
     """Validate that a layout macro does not contain name of keyboard
@@ -213,8 +221,144 @@ def _validate(keyboard, info_data):
         maybe_exit(1)
 
 
+class _LogRecorder(logging.Handler):
+    """Keeps the log records emitted while generating info.json data, so they can be replayed when it is reused.
+    """
+    def __init__(self):
+        super().__init__(logging.NOTSET)
+        self.records = []
+
+    def emit(self, record):
+        self.records.append((record.levelno, record.msg, record.args))
+
+
+def _folder_signature(folder):
+    """Returns the name, size and modification time of each file directly inside a folder.
+    """
+    try:
+        entries = list(os.scandir(folder))
+    except OSError:
+        return []
+
+    signature = []
+    for entry in entries:
+        if entry.is_file():
+            stat = entry.stat()
+            signature.append((entry.name, stat.st_size, stat.st_mtime_ns))
+
+    return sorted(signature)
+
+
+@lru_cache(maxsize=1)
+def _info_json_cache_base():
+    """Signature of everything info_json() reads from outside the keyboard's folders: this code, the data mappings and schemas, and the community layouts.
+    """
+    folders = [Path(__file__).parent, *sorted(Path('data/mappings').glob('**/')), Path('data/schemas')]
+    signature = [(str(folder), _folder_signature(folder)) for folder in folders]
+
+    layouts = Path('layouts/default')
+    signature.append(sorted(path.name for path in layouts.iterdir()) if layouts.is_dir() else [])
+
+    return signature
+
+
+def _info_json_cache_key(keyboard, force_layout):
+    """Hash of everything that goes into the info.json data for a keyboard.
+
+    Only the files directly inside each of the keyboard's folders are considered, as subfolders hold keymaps and other keyboards.
+    """
+    folders = set()
+    root_rules_mk = parse_rules_mk_file(Path('keyboards') / keyboard / 'rules.mk')
+    for name in {str(keyboard), root_rules_mk.get('DEFAULT_FOLDER', str(keyboard))}:
+        folder = Path('keyboards')
+        for part in Path(name).parts:
+            folder = folder / part
+            folders.add(folder)
+
+    key = hashlib.sha1()
+    key.update(repr((_info_json_cache_base(), str(keyboard), force_layout, truthy(os.environ.get('SKIP_SCHEMA_VALIDATION'), False))).encode())
+    for folder in sorted(folders):
+        key.update(repr((str(folder), _folder_signature(folder))).encode())
+
+    return key.hexdigest()
+
+
+def _info_json_cache_file(keyboard, force_layout):
+    """Returns where the cached info.json data for a keyboard lives.
+    """
+    name = f'info_{force_layout}.pickle' if force_layout else 'info.pickle'
+    return INFO_JSON_CACHE_PATH / keyboard / name
+
+
+def _load_cached_info_json(cache_file, key, log_level):
+    """Returns the cached info.json data and log records, or None if they are missing, stale, or were recorded with less logging than is now enabled.
+    """
+    try:
+        with cache_file.open('rb') as fd:
+            cached = pickle.load(fd)
+    except Exception:
+        return None
+
+    if not isinstance(cached, dict) or cached.get('key') != key or cached.get('log_level', logging.CRITICAL) > log_level:
+        return None
+
+    return cached
+
+
+def _store_cached_info_json(cache_file, cached):
+    """Writes out cached info.json data, atomically as parallel builds may be after the same file.
+    """
+    temp_file = None
+    try:
+        if not cache_file.parent.is_dir():
+            cache_file.parent.mkdir(parents=True, exist_ok=True)
+        with tempfile.NamedTemporaryFile(dir=cache_file.parent, prefix=f'.{cache_file.name}.', delete=False) as fd:
+            temp_file = fd.name
+            pickle.dump(cached, fd, protocol=pickle.HIGHEST_PROTOCOL)
+        os.replace(temp_file, cache_file)
+    except Exception as e:
+        cli.log.debug('Could not cache info.json data in %s: %s', cache_file, e)
+        if temp_file:
+            with contextlib.suppress(OSError):
+                os.unlink(temp_file)
+
+
 def info_json(keyboard, force_layout=None):
     """Generate the info.json data for a specific keyboard.
+
+    The result is cached under .build/cache/info_json/ and reused until a file it could have been generated from changes, along with the errors and warnings that were logged. Set SKIP_INFO_JSON_CACHE=1 to always regenerate it.
+    """
+    if truthy(os.environ.get('SKIP_INFO_JSON_CACHE'), False):
+        return _info_json(keyboard, force_layout)
+
+    key = _info_json_cache_key(keyboard, force_layout)
+    cache_file = _info_json_cache_file(keyboard, force_layout)
+    log_level = cli.log.getEffectiveLevel()
+
+    cached = _load_cached_info_json(cache_file, key, log_level)
+    if cached is not None:
+        for level, msg, args in cached['log']:
+            if isinstance(args, tuple):
+                cli.log.log(level, msg, *args)
+            else:
+                cli.log.log(level, msg, args)
+        return cached['info_data']
+
+    recorder = _LogRecorder()
+    cli.log.addHandler(recorder)
+    try:
+        info_data = _info_json(keyboard, force_layout)
+    finally:
+        cli.log.removeHandler(recorder)
+
+    # Pickled now, as callers are free to modify what they get back
+    _store_cached_info_json(cache_file, {'key': key, 'log_level': log_level, 'log': recorder.records, 'info_data': info_data})
+
+    return info_data
+
+
+def _info_json(keyboard, force_layout=None):
+    """Generate the info.json data for a specific keyboard, without the cache.
     """
     cur_dir = Path('keyboards')
     root_rules_mk = parse_rules_mk_file(cur_dir / keyboard / 'rules.mk')
@@ -1,11 +1,30 @@
 """Functions that help us work with Quantum Painter's file formats.
 """
+import contextlib
 import datetime
+import functools
+import hashlib
 import math
+import os
+import pickle
 import re
+import tempfile
 from pathlib import Path
 from string import Template
 from PIL import Image, ImageOps
+from milc import cli
+
+from qmk.constants import BUILD_DIR
+from qmk.util import parallel_map, truthy
+
+# Where converted frames and glyphs are kept between runs, see cached_map()
+PAINTER_CACHE_PATH = Path(BUILD_DIR) / 'cache' / 'painter'
+
+# The code a conversion runs through, so that editing any of it ignores older cache entries
+PAINTER_CACHE_SOURCES = ('painter.py', 'painter_qgf.py', 'painter_qff.py')
+
+# Less work than this, in pixels, is converted in-process as starting up workers would take longer
+PARALLEL_MIN_PIXELS = 128 * 128
 
 # The list of valid formats Quantum Painter supports
 valid_formats = {
@@ -323,6 +342,32 @@ def rgb_to565(r, g, b):
     return [msb, lsb]
 
 
+def _or_bytes(a, b):
+    """Bitwise OR of two equal length byte strings, done a whole string at a time.
+    """
+    return (int.from_bytes(a, 'little') | int.from_bytes(b, 'little')).to_bytes(len(a), 'little')
+
+
+def _interleave(*channels):
+    """Returns the supplied byte strings interleaved, i.e. the first byte of each, then the second, and so on.
+    """
+    output = bytearray(len(channels[0]) * len(channels))
+    for n, channel in enumerate(channels):
+        output[n::len(channels)] = channel
+    return bytes(output)
+
+
+def _pack_pixels(pixels, values, pixels_per_byte, shifter, byte_count):
+    """Packs one byte per pixel into `byte_count` bytes, first pixel in the lowest bits, mapping each through the `values` table of 256 entries.
+    """
+    packed = bytes(byte_count)
+    for n in range(pixels_per_byte):
+        shifted = bytes((v << int(n * shifter)) & 0xFF for v in values)
+        column = pixels[n::pixels_per_byte].translate(shifted)
+        packed = _or_bytes(packed, column + bytes(byte_count - len(column)))
+    return packed
+
+
 def convert_image_bytes(im, format):
     """Convert the supplied image to the equivalent bytes required by the QMK firmware.
     """
@@ -340,43 +385,23 @@ def convert_image_bytes(im, format):
         expected_byte_count = width * height * bytes_per_pixel
 
     if image_format == 'IMAGE_FORMAT_GRAYSCALE':
-        # Take the red channel
-        image_bytes = im.tobytes("raw", "R")
-        image_bytes_len = len(image_bytes)
-
         # No palette
         palette = None
 
-        bytearray = []
-        for x in range(expected_byte_count):
-            byte = 0
-            for n in range(pixels_per_byte):
-                byte_offset = x * pixels_per_byte + n
-                if byte_offset < image_bytes_len:
-                    # If mono, each input byte is a grayscale [0,255] pixel -- rescale to the range we want then pack together
-                    byte = byte | (rescale_byte(image_bytes[byte_offset], ncolors - 1) << int(n * shifter))
-            bytearray.append(byte)
+        # Take the red channel, each byte is a grayscale [0,255] pixel -- rescale to the range we want then pack together
+        values = [rescale_byte(v, ncolors - 1) for v in range(256)]
+        image_bytes = _pack_pixels(im.tobytes("raw", "R"), values, pixels_per_byte, shifter, expected_byte_count)
 
     elif image_format == 'IMAGE_FORMAT_PALETTE':
-        # Convert each pixel to the palette bytes
-        image_bytes = im.tobytes("raw", "P")
-        image_bytes_len = len(image_bytes)
-
         # Export the palette
         palette = []
         pal = im.getpalette()
         for n in range(0, ncolors * 3, 3):
             palette.append((pal[n + 0], pal[n + 1], pal[n + 2]))
 
-        bytearray = []
-        for x in range(expected_byte_count):
-            byte = 0
-            for n in range(pixels_per_byte):
-                byte_offset = x * pixels_per_byte + n
-                if byte_offset < image_bytes_len:
-                    # If color, each input byte is the index into the color palette -- pack them together
-                    byte = byte | ((image_bytes[byte_offset] & (ncolors - 1)) << int(n * shifter))
-            bytearray.append(byte)
+        # Each byte is the index into the color palette -- pack them together
+        values = [v & (ncolors - 1) for v in range(256)]
+        image_bytes = _pack_pixels(im.tobytes("raw", "P"), values, pixels_per_byte, shifter, expected_byte_count)
 
     if image_format == 'IMAGE_FORMAT_RGB565':
         # Take the red, green, and blue channels
@@ -387,7 +412,10 @@ def convert_image_bytes(im, format):
         # No palette
         palette = None
 
-        bytearray = [byte for r, g, b in zip(red, green, blue) for byte in rgb_to565(r, g, b)]
+        # Same as rgb_to565(), for every pixel at once
+        msb = _or_bytes(red.translate(bytes(v & 0xF8 for v in range(256))), green.translate(bytes(v >> 5 for v in range(256))))
+        lsb = _or_bytes(green.translate(bytes((v << 3) & 0xE0 for v in range(256))), blue.translate(bytes(v >> 3 for v in range(256))))
+        image_bytes = _interleave(msb, lsb)
 
     if image_format == 'IMAGE_FORMAT_RGB888':
         # Take the red, green, and blue channels
@@ -398,59 +426,179 @@ def convert_image_bytes(im, format):
         # No palette
         palette = None
 
-        bytearray = [byte for r, g, b in zip(red, green, blue) for byte in (r, g, b)]
+        image_bytes = _interleave(red, green, blue)
 
-    if len(bytearray) != expected_byte_count:
-        raise Exception(f"Wrong byte count, was {len(bytearray)}, expected {expected_byte_count}")
+    if len(image_bytes) != expected_byte_count:
+        raise Exception(f"Wrong byte count, was {len(image_bytes)}, expected {expected_byte_count}")
 
-    return (palette, bytearray)
+    return (palette, list(image_bytes))
 
 
-def compress_bytes_qmk_rle(bytearray):
-    debug_dump = False
-    output = []
-    temp = []
-    repeat = False
+def compress_bytes_qmk_rle(data):
+    """Compresses the supplied bytes with QMK's RLE scheme.
 
-    def append_byte(c):
-        if debug_dump:
-            print('Appending byte:', '0x{0:02X}'.format(int(c)), '=', c)
-        output.append(c)
+    Runs of two or more identical bytes are written as a count of up to 127 followed by the byte. Everything in between
+    is written as a count of 128 plus the number of bytes, up to 128 of them, followed by the bytes themselves.
 
-    def append_range(r):
-        append_byte(127 + len(r))
-        if debug_dump:
-            print('Appending {0} byte(s):'.format(len(r)), '[', ', '.join(['{0:02X}'.format(e) for e in r]), ']')
-        output.extend(r)
+    Works through the input a run at a time rather than a byte at a time, making the same choices as a byte-wise encoder
+    would, including its quirks -- a run capped at 127 carries its last byte over, and the final literal block is
+    always written out even if it's empty.
+    """
+    data = bytes(data)
+    output = bytearray()
+    literal = bytearray()
+    repeat_value = None
+    repeat_count = 0
+
+    def append_literal(chunk):
+        nonlocal repeat_count
+        if repeat_count > 0:
+            output.extend((repeat_count, repeat_value))
+            repeat_count = 0
+        while chunk:
+            take = 128 - len(literal)
+            literal.extend(chunk[:take])
+            chunk = chunk[take:]
+            if len(literal) == 128:
+                output.append(255)
+                output.extend(literal)
+                literal.clear()
+
+    last_end = 0
+    for run in re.finditer(rb'(.)\1+', data, re.DOTALL):
+        value = data[run.start()]
+        remaining = run.end() - run.start()
+
+        # Anything since the last run, along with the first byte of this one, is added to the literal block
+        append_literal(data[last_end:run.start() + 1])
+        remaining -= 1
+        if len(literal) == 0:
+            literal.append(value)
+            remaining -= 1
+        last_end = run.end()
+
+        # A second byte the same turns the end of the literal block into a run, capped at 127 with the last carried over
+        while remaining > 0:
+            if len(literal) > 1:
+                output.append(127 + len(literal) - 1)
+                output.extend(literal[:-1])
+            literal.clear()
+            repeat_value = value
+            repeat_count = min(remaining + 1, 128)
+            remaining -= repeat_count - 1
+            if repeat_count == 128:
+                output.extend((127, value))
+                repeat_count = 0
+                literal.append(value)
+
+    if last_end < len(data):
+        append_literal(data[last_end:])
+
+    if repeat_count > 0:
+        output.extend((repeat_count, repeat_value))
+    else:
+        output.append(127 + len(literal))
+        output.extend(literal)
+    return list(output)
 
-    for n in range(0, len(bytearray) + 1):
-        end = True if n == len(bytearray) else False
-        if not end:
-            c = bytearray[n]
-            temp.append(c)
-            if len(temp) <= 1:
-                continue
 
-        if debug_dump:
-            print('Temp buffer state {0:3d} bytes:'.format(len(temp)), '[', ', '.join(['{0:02X}'.format(e) for e in temp]), ']')
-
-        if repeat:
-            if temp[-1] != temp[-2]:
-                repeat = False
-            if not repeat or len(temp) == 128 or end:
-                append_byte(len(temp) if end else len(temp) - 1)
-                append_byte(temp[0])
-                temp = [temp[-1]]
-                repeat = False
+@functools.lru_cache(maxsize=None)
+def _painter_code_signature():
+    """Returns the name, size and modification time of each of PAINTER_CACHE_SOURCES.
+    """
+    signature = []
+    for name in PAINTER_CACHE_SOURCES:
+        stat = (Path(__file__).parent / name).stat()
+        signature.append((name, stat.st_size, stat.st_mtime_ns))
+    return repr(signature)
+
+
+def content_key(*parts):
+    """Returns a key for the supplied images, byte strings and values, for use with cached_map().
+
+    Images are keyed on everything a conversion could depend on -- their mode, size, info, palette, and pixels. The signature of the conversion code is folded in too.
+    """
+    key = hashlib.sha1(_painter_code_signature().encode())
+    for part in parts:
+        if isinstance(part, Image.Image):
+            data = repr((part.mode, part.size, sorted(part.info.items()), part.getpalette())).encode() + part.tobytes()
+        elif isinstance(part, bytes):
+            data = part
         else:
-            if len(temp) >= 2 and temp[-1] == temp[-2]:
-                repeat = True
-                if len(temp) > 2:
-                    append_range(temp[0:(len(temp) - 2)])
-                    temp = [temp[-1], temp[-1]]
-                continue
-            if len(temp) == 128 or end:
-                append_range(temp)
-                temp = []
-                repeat = False
-    return output
+            data = repr(part).encode()
+        key.update(len(data).to_bytes(8, 'little'))
+        key.update(data)
+    return key.hexdigest()
+
+
+def _cache_file(key):
+    return PAINTER_CACHE_PATH / key[:2] / f'{key[2:]}.pickle'
+
+
+def _load_cached(key):
+    """Returns the cached result for the key, or None if there isn't one.
+    """
+    try:
+        with _cache_file(key).open('rb') as fd:
+            cached_key, result = pickle.load(fd)
+    except Exception:
+        return None
+
+    return result if cached_key == key else None
+
+
+def _store_cached(key, result):
+    """Writes out a result, atomically as other conversions may be after the same file.
+    """
+    cache_file = _cache_file(key)
+    temp_file = None
+    try:
+        if not cache_file.parent.is_dir():
+            cache_file.parent.mkdir(parents=True, exist_ok=True)
+        with tempfile.NamedTemporaryFile(dir=cache_file.parent, prefix=f'.{cache_file.name}.', delete=False) as fd:
+            temp_file = fd.name
+            pickle.dump((key, result), fd, protocol=pickle.HIGHEST_PROTOCOL)
+        os.replace(temp_file, cache_file)
+    except Exception as e:
+        cli.log.debug('Could not cache painter data in %s: %s', cache_file, e)
+        if temp_file:
+            with contextlib.suppress(OSError):
+                os.unlink(temp_file)
+
+
+def _run_keyed(job):
+    func, key, args = job
+    return key, func(*args)
+
+
+def cached_map(func, jobs, keys, pixels):
+    """Returns `[func(*args) for args in jobs]`, where each job has a content key and a size in pixels.
+
+    Results are cached under .build/cache/painter/ by key, so only jobs that haven't been seen before are run. Those are
+    spread across all CPUs when there's enough of them to be worth it. Set SKIP_PAINTER_CACHE=1 to always run every job.
+    """
+    use_cache = not truthy(os.environ.get('SKIP_PAINTER_CACHE'), False)
+
+    results = {}
+    pending = {}
+    for args, key, size in zip(jobs, keys, pixels):
+        if key in results or key in pending:
+            continue
+        result = _load_cached(key) if use_cache else None
+        if result is not None:
+            results[key] = result
+        else:
+            pending[key] = (args, size)
+
+    work = [(func, key, args) for key, (args, _) in pending.items()]
+    if len(work) > 1 and (os.cpu_count() or 1) > 1 and sum(size for _, size in pending.values()) >= PARALLEL_MIN_PIXELS:
+        done = parallel_map(_run_keyed, work)
+    else:
+        done = map(_run_keyed, work)
+
+    for key, result in done:
+        results[key] = result
+        if use_cache:
+            _store_cached(key, result)
+
+    return [results[key] for key in keys]
@@ -177,6 +177,13 @@ def _generate_font_glyphs_list(use_ascii, unicode_glyphs):
     return sorted(glyphs.keys())
 
 
+def _convert_glyph(glyph_img, format):
+    """Returns the raw and RLE bytes for a single glyph.
+    """
+    (_, image_bytes) = qmk.painter.convert_image_bytes(glyph_img, format)
+    return (image_bytes, qmk.painter.compress_bytes_qmk_rle(image_bytes))
+
+
 class QFFFont:
     def __init__(self, logger):
         self.logger = logger
@@ -192,11 +199,15 @@ class QFFFont:
         converted_img = qmk.painter.convert_requested_format(self.image, format)
         (self.palette, _) = qmk.painter.convert_image_bytes(converted_img, format)
 
+        # Convert all the glyphs, in parallel and reusing any that have been converted before. A glyph's bytes don't
+        # depend on the palette, so it's left out of the key.
+        glyph_imgs = [converted_img.crop((glyph_entry.x, 1, glyph_entry.x + glyph_entry.w, 1 + self.glyph_height)) for glyph_entry in self.glyph_data.values()]
+        jobs = [(glyph_img, format) for glyph_img in glyph_imgs]
+        keys = [qmk.painter.content_key(glyph_img.mode, glyph_img.size, glyph_img.tobytes(), format) for glyph_img in glyph_imgs]
+        glyph_bytes = qmk.painter.cached_map(_convert_glyph, jobs, keys, [glyph_img.width * glyph_img.height for glyph_img in glyph_imgs])
+
         # Work out how many bytes used for RLE vs. non-RLE
-        for _, glyph_entry in self.glyph_data.items():
-            glyph_img = converted_img.crop((glyph_entry.x, 1, glyph_entry.x + glyph_entry.w, 1 + self.glyph_height))
-            (_, this_glyph_image_bytes) = qmk.painter.convert_image_bytes(glyph_img, format)
-            this_glyph_rle_bytes = qmk.painter.compress_bytes_qmk_rle(this_glyph_image_bytes)
+        for glyph_entry, (this_glyph_image_bytes, this_glyph_rle_bytes) in zip(self.glyph_data.values(), glyph_bytes):
             total_data_size += len(this_glyph_image_bytes)
             total_rle_data_size += len(this_glyph_rle_bytes)
             glyph_entry['image_uncompressed_bytes'] = this_glyph_image_bytes
@@ -326,14 +326,13 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
     }
 
 
-# Helper function to save each frame to the output file
-def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwargs):
-    # Not an argument of the function as it would then not be part of kwargs
-    # This would cause an issue with `_compress_image(**kwargs)` missing an argument
-    format_ = kwargs["format_"]
-
-    # (potentially) Apply RLE and/or delta, and work out output image's information
-    outputs = _compress_image(frame, last_frame, **kwargs)
+# Helper for qmk.painter.cached_map(), which only passes positional arguments
+def _compress_frame(frame, last_frame, options):
+    return _compress_image(frame, last_frame, **options)
+
+
+# Helper function to save each frame to the output file, given the outputs of `_compress_image()` for it
+def _write_frame(idx, frame, outputs, *, fp, frame_offsets, metadata, format_):
     bbox = outputs["bbox"]
     graphic_data = outputs["graphic_data"]
     image_data = outputs["image_data"]
@@ -412,9 +411,10 @@ def _save(im, fp, _filename):
     append_images = list(encoderinfo.get("append_images", []))
     for_all_frames = functools.partial(_for_all_frames, images=[im, *append_images])
 
-    # Collect all the frame sizes
-    frame_sizes = []
-    for_all_frames(lambda _idx, frame, _last_frame: frame_sizes.append(frame.size))
+    # Collect all the frames, each along with the one before it for working out deltas
+    frames = []
+    for_all_frames(lambda _idx, frame, last_frame: frames.append((frame, last_frame)))
+    frame_sizes = [frame.size for frame, _ in frames]
 
     # Make sure all frames are the same size
     if len(set(frame_sizes)) != 1:
@@ -436,9 +436,16 @@ def _save(im, fp, _filename):
     vprint(f'{"Frame offsets block":26s} {fp.tell():5d}d / {fp.tell():04X}h')
     frame_offsets.write(fp)
 
+    # Compress all the frames up front, in parallel and reusing any that have been compressed before
+    options = {"format_": encoderinfo["qmk_format"], "use_deltas": encoderinfo.get("use_deltas", True), "use_rle": encoderinfo.get("use_rle", True)}
+    jobs = [(frame, last_frame if options["use_deltas"] else None, options) for frame, last_frame in frames]
+    keys = [qmk.painter.content_key(*job) for job in jobs]
+    outputs = qmk.painter.cached_map(_compress_frame, jobs, keys, [frame.width * frame.height for frame, _ in frames])
+
     # Iterate over each if the input frames, writing it to the output in the process
-    write_frame = functools.partial(_write_frame, format_=encoderinfo["qmk_format"], fp=fp, use_deltas=encoderinfo.get("use_deltas", True), use_rle=encoderinfo.get("use_rle", True), frame_offsets=frame_offsets, metadata=metadata)
-    for_all_frames(write_frame)
+    write_frame = functools.partial(_write_frame, format_=options["format_"], fp=fp, frame_offsets=frame_offsets, metadata=metadata)
+    for idx, ((frame, _), frame_outputs) in enumerate(zip(frames, outputs)):
+        write_frame(idx, frame, frame_outputs)
 
     # Go back and update the graphics descriptor now that we can determine the final file size
     graphics_descriptor.total_file_size = fp.tell()
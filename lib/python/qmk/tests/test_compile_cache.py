@@ -0,0 +1,125 @@
+import os
+import shutil
+import subprocess
+import tempfile
+from contextlib import contextmanager
+from pathlib import Path
+from unittest import SkipTest
+
+COMPILE_CACHE = Path('util/compile_cache.sh').resolve()
+
+
+@contextmanager
+def scratch():
+    """Sets up a source file next to an empty cache, skipping the test without a host compiler.
+    """
+    if shutil.which('cc') is None:
+        raise SkipTest('No host compiler')
+
+    with tempfile.TemporaryDirectory() as tree:
+        tree = Path(tree)
+        (tree / 'source.c').write_text('int value(void) { return VALUE; }\n')
+        yield tree
+
+
+def compile_cached(tree, *args, launcher=None, compiler='cc'):
+    """Compiles source.c to source.o through the cache, returning the result and what the cache reported.
+    """
+    stats = tree / 'stats'
+    stats.unlink(missing_ok=True)
+    prefix = [COMPILE_CACHE, *(['--launcher', launcher] if launcher else []), tree / 'cache', compiler]
+    result = subprocess.run([*prefix, *args], cwd=tree, capture_output=True, text=True, env={**os.environ, 'COMPILE_CACHE_STATS': str(stats)})
+    return result, stats.read_text().split() if stats.exists() else []
+
+
+def test_compile_cache_hit():
+    with scratch() as tree:
+        result, stats = compile_cached(tree, '-DVALUE=1', '-c', 'source.c', '-o', 'source.o')
+        assert result.returncode == 0
+        assert stats == ['miss']
+        first = (tree / 'source.o').read_bytes()
+
+        (tree / 'source.o').unlink()
+        result, stats = compile_cached(tree, '-DVALUE=1', '-c', 'source.c', '-o', 'source.o')
+        assert result.returncode == 0
+        assert stats == ['hit']
+        assert (tree / 'source.o').read_bytes() == first
+
+
+def test_compile_cache_preprocessed_source_changed():
+    with scratch() as tree:
+        compile_cached(tree, '-DVALUE=1', '-c', 'source.c', '-o', 'source.o')
+        result, stats = compile_cached(tree, '-DVALUE=2', '-c', 'source.c', '-o', 'source.o')
+        assert result.returncode == 0
+        assert stats == ['miss']
+
+
+def test_compile_cache_flags_changed():
+    with scratch() as tree:
+        compile_cached(tree, '-DVALUE=1', '-O1', '-c', 'source.c', '-o', 'source.o')
+        _, stats = compile_cached(tree, '-DVALUE=1', '-O2', '-c', 'source.c', '-o', 'source.o')
+        assert stats == ['miss']
+
+
+def test_compile_cache_same_source_elsewhere():
+    with scratch() as tree:
+        compile_cached(tree, '-DVALUE=1', '-c', 'source.c', '-o', 'source.o')
+        (tree / 'other').mkdir()
+        result, stats = compile_cached(tree, '-DVALUE=1', '-Iother', '-c', 'source.c', '-o', 'other/source.o')
+        assert result.returncode == 0
+        assert stats == ['hit']
+        assert (tree / 'other/source.o').read_bytes() == (tree / 'source.o').read_bytes()
+
+
+def test_compile_cache_dependencies_written_on_hit():
+    with scratch() as tree:
+        compile_cached(tree, '-DVALUE=1', '-MMD', '-MP', '-MF', 'first.d', '-c', 'source.c', '-o', 'first.o')
+        _, stats = compile_cached(tree, '-DVALUE=1', '-MMD', '-MP', '-MF', 'second.d', '-c', 'source.c', '-o', 'second.o')
+        assert stats == ['hit']
+        assert (tree / 'second.d').read_text().startswith('second.o:')
+
+
+def test_compile_cache_warnings_replayed():
+    with scratch() as tree:
+        (tree / 'source.c').write_text('#warning replayed\nint value(void) { return 1; }\n')
+        first, _ = compile_cached(tree, '-c', 'source.c', '-o', 'source.o')
+        second, stats = compile_cached(tree, '-c', 'source.c', '-o', 'source.o')
+        assert stats == ['hit']
+        assert 'replayed' in first.stderr
+        assert second.stderr == first.stderr
+
+
+def test_compile_cache_failure_not_cached():
+    with scratch() as tree:
+        result, stats = compile_cached(tree, '-c', 'source.c', '-o', 'source.o')
+        assert result.returncode != 0
+        assert stats == ['miss']
+        _, stats = compile_cached(tree, '-c', 'source.c', '-o', 'source.o')
+        assert stats == ['miss']
+
+
+def test_compile_cache_passthrough():
+    with scratch() as tree:
+        result, stats = compile_cached(tree, '-DVALUE=1', '-S', 'source.c', '-o', 'source.s')
+        assert result.returncode == 0
+        assert stats == []
+        assert (tree / 'source.s').exists()
+
+        _, stats = compile_cached(tree, '-DVALUE=1', '-g', '-c', 'source.c', '-o', 'source.o')
+        assert stats == []
+
+
+def test_compile_cache_launcher():
+    with scratch() as tree:
+        launcher = tree / 'launcher'
+        launcher.write_text(f'#!/bin/sh\necho "$@" >>{tree / "launched"}\nexec "$@"\n')
+        launcher.chmod(0o755)
+
+        result, stats = compile_cached(tree, '-DVALUE=1', '-c', 'source.c', '-o', 'source.o', launcher=launcher)
+        assert result.returncode == 0
+        assert stats == ['miss']
+        assert (tree / 'launched').read_text().split('\n')[0].split()[0] == 'cc'
+
+        _, stats = compile_cached(tree, '-DVALUE=1', '-c', 'source.c', '-o', 'source.o', launcher=launcher)
+        assert stats == ['hit']
+        assert len((tree / 'launched').read_text().splitlines()) == 1
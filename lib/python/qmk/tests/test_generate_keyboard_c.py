@@ -0,0 +1,51 @@
+import shutil
+import subprocess
+import tempfile
+from pathlib import Path
+from unittest import SkipTest
+
+from qmk.cli.generate.keyboard_c import _sqrt16, _atan2_8
+
+LIB_PATH = Path('lib').resolve()
+
+# Offsets from the center point, wider than any LED layout reaches on either axis
+OFFSETS = range(-255, 256)
+
+# Prints every sqrt16() result, then atan2_8() for every pair of OFFSETS
+LIB8TION_TABLES = '''
+#include <stdio.h>
+#include "lib8tion/lib8tion.h"
+
+int main(void) {
+    for (long x = 0; x <= UINT16_MAX; x++) {
+        putchar(sqrt16(x));
+    }
+    for (int dy = -255; dy <= 255; dy++) {
+        for (int dx = -255; dx <= 255; dx++) {
+            putchar(atan2_8(dy, dx));
+        }
+    }
+    return 0;
+}
+'''
+
+
+def lib8tion_tables():
+    """Builds and runs LIB8TION_TABLES against the C functions the generator ports, skipping the test without a host compiler.
+    """
+    if shutil.which('cc') is None:
+        raise SkipTest('No host compiler')
+
+    with tempfile.TemporaryDirectory() as tree:
+        tree = Path(tree)
+        (tree / 'tables.c').write_text(LIB8TION_TABLES)
+        subprocess.run(['cc', f'-I{LIB_PATH}', 'tables.c', '-o', 'tables'], cwd=tree, check=True)
+        output = subprocess.run([tree / 'tables'], capture_output=True, check=True).stdout
+
+    return output[:0x10000], output[0x10000:]
+
+
+def test_led_polar_matches_lib8tion():
+    sqrt16, atan2_8 = lib8tion_tables()
+    assert bytes(_sqrt16(x) for x in range(0x10000)) == sqrt16
+    assert bytes(_atan2_8(dy, dx) for dy in OFFSETS for dx in OFFSETS) == atan2_8
@@ -0,0 +1,79 @@
+import json
+import os
+import tempfile
+from contextlib import contextmanager
+from pathlib import Path
+from unittest import mock
+
+import qmk.info
+
+
+@contextmanager
+def cached_keyboard():
+    """Sets up a keyboard with a revision in a scratch tree, and counts how often its info.json data is generated.
+    """
+    orig_cwd = os.getcwd()
+    with tempfile.TemporaryDirectory() as tree:
+        tree = Path(tree)
+        (tree / 'keyboards/pytest_cache/rev1/keymaps/default').mkdir(parents=True)
+        (tree / 'keyboards/pytest_cache/rules.mk').write_text('BOOTMAGIC_ENABLE = yes\n')
+        (tree / 'keyboards/pytest_cache/rev1/keyboard.json').write_text(json.dumps({'keyboard_name': 'first'}))
+
+        generated = []
+
+        def _info_json(keyboard, force_layout=None):
+            generated.append(keyboard)
+            return json.loads(Path('keyboards', keyboard, 'keyboard.json').read_text())
+
+        os.chdir(tree)
+        try:
+            with mock.patch.dict(os.environ, {'SKIP_INFO_JSON_CACHE': '0'}), mock.patch.object(qmk.info, 'INFO_JSON_CACHE_PATH', tree / '.build/cache/info_json'), mock.patch.object(qmk.info, '_info_json', _info_json):
+                yield tree / 'keyboards/pytest_cache', generated
+        finally:
+            os.chdir(orig_cwd)
+
+
+def test_info_json_cache_reused():
+    with cached_keyboard() as (keyboard, generated):
+        assert qmk.info.info_json('pytest_cache/rev1')['keyboard_name'] == 'first'
+        assert qmk.info.info_json('pytest_cache/rev1')['keyboard_name'] == 'first'
+        assert generated == ['pytest_cache/rev1']
+
+
+def test_info_json_cache_keyboard_json_changed():
+    with cached_keyboard() as (keyboard, generated):
+        qmk.info.info_json('pytest_cache/rev1')
+        (keyboard / 'rev1/keyboard.json').write_text(json.dumps({'keyboard_name': 'second'}))
+        assert qmk.info.info_json('pytest_cache/rev1')['keyboard_name'] == 'second'
+        assert len(generated) == 2
+
+
+def test_info_json_cache_parent_rules_mk_changed():
+    with cached_keyboard() as (keyboard, generated):
+        qmk.info.info_json('pytest_cache/rev1')
+        (keyboard / 'rules.mk').write_text('BOOTMAGIC_ENABLE = no\n')
+        qmk.info.info_json('pytest_cache/rev1')
+        assert len(generated) == 2
+
+
+def test_info_json_cache_parent_file_added():
+    with cached_keyboard() as (keyboard, generated):
+        qmk.info.info_json('pytest_cache/rev1')
+        (keyboard / 'config.h').write_text('#pragma once\n')
+        qmk.info.info_json('pytest_cache/rev1')
+        assert len(generated) == 2
+
+
+def test_info_json_cache_keymap_changed():
+    with cached_keyboard() as (keyboard, generated):
+        qmk.info.info_json('pytest_cache/rev1')
+        (keyboard / 'rev1/keymaps/default/keymap.c').write_text('')
+        qmk.info.info_json('pytest_cache/rev1')
+        assert generated == ['pytest_cache/rev1']
+
+
+def test_info_json_cache_force_layout():
+    with cached_keyboard() as (keyboard, generated):
+        qmk.info.info_json('pytest_cache/rev1')
+        qmk.info.info_json('pytest_cache/rev1', force_layout='LAYOUT_all')
+        assert len(generated) == 2
@@ -0,0 +1,76 @@
+import os
+from pathlib import Path
+
+import qmk.painter
+from qmk.painter import compress_bytes_qmk_rle, rescale_byte, _pack_pixels
+
+# Known-good output of the byte at a time encoder
+RLE_CASES = [
+    ([], [127]),
+    ([1], [128, 1]),
+    ([1, 2, 3], [130, 1, 2, 3]),
+    ([5, 5], [2, 5]),
+    ([5] * 3, [3, 5]),
+    ([7] * 127, [127, 7]),
+    ([7] * 128, [127, 7, 128, 7]),
+    ([7] * 129, [127, 7, 2, 7]),
+    ([7] * 256, [127, 7, 127, 7, 2, 7]),
+    (list(range(127)), [254, *range(127)]),
+    (list(range(128)), [255, *range(128), 127]),
+    (list(range(129)), [255, *range(128), 128, 128]),
+    (list(range(128)) + [9] * 3, [255, *range(128), 3, 9]),
+    ([1, 2, 3, 4, 4, 4, 4], [130, 1, 2, 3, 4, 4]),
+    ([4] * 5 + [1, 2, 3], [5, 4, 130, 1, 2, 3]),
+    ([1, 1, 2, 3, 3], [2, 1, 128, 2, 2, 3]),
+    ([0, 0, 1, 2, 2, 2, 3, 4, 5, 5], [2, 0, 128, 1, 3, 2, 129, 3, 4, 2, 5]),
+]
+
+PIXELS = bytes([0, 1, 2, 3, 255, 128, 7, 5, 9, 200, 17])
+
+# Known-good output of the pixel at a time packer, for each bit depth
+PALETTE_CASES = {
+    1: [218, 5],
+    2: [228, 115, 17],
+    4: [16, 50, 15, 87, 137, 1],
+    8: list(PIXELS),
+}
+GRAYSCALE_CASES = {
+    1: [48, 2],
+    2: [0, 11, 8],
+    4: [0, 0, 143, 0, 193, 1],
+    8: list(PIXELS),
+}
+
+
+def pack(values, bits):
+    pixels_per_byte = 8 // bits
+    return list(_pack_pixels(PIXELS, values, pixels_per_byte, bits, (len(PIXELS) + pixels_per_byte - 1) // pixels_per_byte))
+
+
+def test_compress_bytes_qmk_rle():
+    for data, expected in RLE_CASES:
+        assert compress_bytes_qmk_rle(data) == expected, data
+
+
+def test_pack_pixels_palette():
+    for bits, expected in PALETTE_CASES.items():
+        assert pack([v & ((1 << bits) - 1) for v in range(256)], bits) == expected, bits
+
+
+def test_pack_pixels_grayscale():
+    for bits, expected in GRAYSCALE_CASES.items():
+        assert pack([rescale_byte(v, (1 << bits) - 1) for v in range(256)], bits) == expected, bits
+
+
+def test_content_key_painter_code_changed():
+    source = Path(qmk.painter.__file__).parent / 'painter_qff.py'
+    stat = source.stat()
+    qmk.painter._painter_code_signature.cache_clear()
+    before = qmk.painter.content_key(b'glyph')
+    try:
+        os.utime(source, ns=(stat.st_atime_ns, stat.st_mtime_ns + 1))
+        qmk.painter._painter_code_signature.cache_clear()
+        assert qmk.painter.content_key(b'glyph') != before
+    finally:
+        os.utime(source, ns=(stat.st_atime_ns, stat.st_mtime_ns))
+        qmk.painter._painter_code_signature.cache_clear()
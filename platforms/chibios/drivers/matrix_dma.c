@@ -0,0 +1,194 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "matrix_dma.h"
+#include "matrix.h"
+#include "util.h"
+#include "chibios_config.h"
+
+#if !defined(MCU_STM32)
+#    error "MATRIX_DMA_ENABLE is only supported on STM32"
+#endif
+
+#ifndef MATRIX_DMA_GPT_DRIVER
+#    define MATRIX_DMA_GPT_DRIVER GPTD1 // TIMx, must have a capture/compare channel 1
+#endif
+#ifndef MATRIX_DMA_TIMER_FREQUENCY
+#    define MATRIX_DMA_TIMER_FREQUENCY 8000000
+#endif
+#ifndef MATRIX_DMA_SCAN_RATE
+#    define MATRIX_DMA_SCAN_RATE 8000 // Whole matrix scans per second, at most
+#endif
+#ifndef MATRIX_DMA_SETTLE_NS
+#    ifndef MATRIX_IO_DELAY
+#        define MATRIX_IO_DELAY 30
+#    endif
+#    define MATRIX_DMA_SETTLE_NS (MATRIX_IO_DELAY * 1000) // The same recovery time the software scan waits for
+#endif
+#ifndef MATRIX_DMA_SELECT_STREAM
+#    define MATRIX_DMA_SELECT_STREAM STM32_DMA2_STREAM5 // DMA Stream for TIMx_UP
+#endif
+#ifndef MATRIX_DMA_SELECT_CHANNEL
+#    define MATRIX_DMA_SELECT_CHANNEL 6 // DMA Channel for TIMx_UP
+#endif
+#ifndef MATRIX_DMA_SAMPLE_STREAM
+#    define MATRIX_DMA_SAMPLE_STREAM STM32_DMA2_STREAM1 // DMA Stream for TIMx_CH1
+#endif
+#ifndef MATRIX_DMA_SAMPLE_CHANNEL
+#    define MATRIX_DMA_SAMPLE_CHANNEL 6 // DMA Channel for TIMx_CH1
+#endif
+#if (STM32_DMA_SUPPORTS_DMAMUX == TRUE) && (!defined(MATRIX_DMA_SELECT_DMAMUX_ID) || !defined(MATRIX_DMA_SAMPLE_DMAMUX_ID))
+#    error "please consult your MCU's datasheet and specify in your config.h: #define MATRIX_DMA_SELECT_DMAMUX_ID STM32_DMAMUX1_TIM?_UP, #define MATRIX_DMA_SAMPLE_DMAMUX_ID STM32_DMAMUX1_TIM?_CH1"
+#endif
+
+// Unselected rows are released, like the input-high rows of the software scan
+#if defined(MATRIX_UNSELECT_DRIVE_HIGH)
+#    define MATRIX_DMA_ROW_MODE PAL_MODE_OUTPUT_PUSHPULL
+#elif defined(USE_GPIOV1)
+#    define MATRIX_DMA_ROW_MODE PAL_MODE_OUTPUT_OPENDRAIN
+#else
+#    define MATRIX_DMA_ROW_MODE (PAL_MODE_OUTPUT_OPENDRAIN | PAL_STM32_PUPDR_PULLUP)
+#endif
+
+// BSRR is a plain register on GPIOv1 and a union on later versions
+#define MATRIX_DMA_BSRR(port) ((volatile uint32_t *)&(port)->BSRR)
+
+#define MATRIX_DMA_MODE (STM32_DMA_CR_PSIZE_WORD | STM32_DMA_CR_MSIZE_WORD | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3))
+
+static const stm32_dma_stream_t *select_stream;
+static const stm32_dma_stream_t *sample_stream;
+
+static uint8_t           row_count;
+static uint32_t          select_buffer[MATRIX_ROWS];     // BSRR word written at the end of each period, selecting the next row
+static gpio_port_value_t sample_buffer[MATRIX_ROWS * 2]; // Two scans, one being filled while the other is read
+
+static volatile uint8_t  complete_half;
+static volatile uint32_t scans;
+static uint32_t          last_scan;
+
+static void matrix_dma_sample_cb(void *param, uint32_t flags) {
+    if (flags & STM32_DMA_ISR_TCIF) {
+        complete_half = 1;
+    } else if (flags & STM32_DMA_ISR_HTIF) {
+        complete_half = 0;
+    }
+    scans++;
+}
+
+bool matrix_dma_start(const pin_t row_pins[], uint8_t rows, gpio_port_t col_port) {
+    if (rows == 0 || rows > MATRIX_ROWS) {
+        return false;
+    }
+    // The timer is in use elsewhere
+    if (MATRIX_DMA_GPT_DRIVER.state != GPT_STOP) {
+        return false;
+    }
+    gpio_port_t row_port = PAL_PORT(row_pins[0]);
+    uint32_t    row_mask = 0;
+    for (uint8_t row = 0; row < rows; row++) {
+        if (row_pins[row] == NO_PIN || PAL_PORT(row_pins[row]) != row_port) {
+            return false;
+        }
+        row_mask |= 1U << PAL_PAD(row_pins[row]);
+    }
+
+    // Period k ends by selecting row k + 1, row 0 is selected before the timer starts
+    row_count = rows;
+    for (uint8_t row = 0; row < rows; row++) {
+        uint32_t bit                           = 1U << PAL_PAD(row_pins[row]);
+        select_buffer[(row + rows - 1) % rows] = (row_mask & ~bit) | (bit << 16);
+    }
+
+    const stm32_dma_stream_t *select = dmaStreamAlloc(MATRIX_DMA_SELECT_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    if (select == NULL) {
+        return false;
+    }
+    const stm32_dma_stream_t *sample = dmaStreamAlloc(MATRIX_DMA_SAMPLE_STREAM - STM32_DMA_STREAM(0), 10, matrix_dma_sample_cb, NULL);
+    if (sample == NULL) {
+        dmaStreamFree(select);
+        return false;
+    }
+    select_stream = select;
+    sample_stream = sample;
+
+    for (uint8_t row = 0; row < rows; row++) {
+        palSetLineMode(row_pins[row], MATRIX_DMA_ROW_MODE);
+    }
+    *MATRIX_DMA_BSRR(row_port) = select_buffer[rows - 1];
+
+    dmaStreamSetPeripheral(select, MATRIX_DMA_BSRR(row_port));
+    dmaStreamSetMemory0(select, select_buffer);
+    dmaStreamSetTransactionSize(select, rows);
+    dmaStreamSetMode(select, STM32_DMA_CR_CHSEL(MATRIX_DMA_SELECT_CHANNEL) | STM32_DMA_CR_DIR_M2P | MATRIX_DMA_MODE);
+
+    dmaStreamSetPeripheral(sample, &col_port->IDR);
+    dmaStreamSetMemory0(sample, sample_buffer);
+    dmaStreamSetTransactionSize(sample, rows * 2);
+    dmaStreamSetMode(sample, STM32_DMA_CR_CHSEL(MATRIX_DMA_SAMPLE_CHANNEL) | STM32_DMA_CR_DIR_P2M | MATRIX_DMA_MODE | STM32_DMA_CR_HTIE | STM32_DMA_CR_TCIE);
+
+#if (STM32_DMA_SUPPORTS_DMAMUX == TRUE)
+    dmaSetRequestSource(select, MATRIX_DMA_SELECT_DMAMUX_ID);
+    dmaSetRequestSource(sample, MATRIX_DMA_SAMPLE_DMAMUX_ID);
+#endif
+
+    dmaStreamEnable(select);
+    dmaStreamEnable(sample);
+
+    // The GPT driver sets up the clock and prescaler, the rest is programmed here so that no DMA request fires before the first period
+    static const GPTConfig config = {
+        .frequency = MATRIX_DMA_TIMER_FREQUENCY,
+        .callback  = NULL,
+        .cr2       = 0,
+        .dier      = 0,
+    };
+    gptStart(&MATRIX_DMA_GPT_DRIVER, &config);
+
+    // Rows too short to settle and leave a microsecond for the sample transfer lower the scan rate
+    uint32_t settle = (uint64_t)MATRIX_DMA_TIMER_FREQUENCY * MATRIX_DMA_SETTLE_NS / 1000000000;
+    uint32_t period = MAX(MATRIX_DMA_TIMER_FREQUENCY / ((uint32_t)MATRIX_DMA_SCAN_RATE * rows), settle + MATRIX_DMA_TIMER_FREQUENCY / 1000000);
+
+    stm32_tim_t *tim = MATRIX_DMA_GPT_DRIVER.tim;
+    tim->ARR         = period - 1;
+    tim->CCR[0]      = settle;
+    tim->CR1         = STM32_TIM_CR1_URS;
+    tim->EGR         = STM32_TIM_EGR_UG;
+    tim->SR          = 0;
+    tim->DIER        = STM32_TIM_DIER_UDE | STM32_TIM_DIER_CC1DE;
+    tim->CR1         = STM32_TIM_CR1_URS | STM32_TIM_CR1_CEN;
+
+    return true;
+}
+
+void matrix_dma_stop(void) {
+    if (select_stream == NULL) {
+        return;
+    }
+
+    stm32_tim_t *tim = MATRIX_DMA_GPT_DRIVER.tim;
+    tim->CR1         = 0;
+    tim->DIER        = 0;
+    gptStop(&MATRIX_DMA_GPT_DRIVER);
+
+    dmaStreamDisable(select_stream);
+    dmaStreamDisable(sample_stream);
+    dmaStreamFree(select_stream);
+    dmaStreamFree(sample_stream);
+    select_stream = NULL;
+    sample_stream = NULL;
+}
+
+bool matrix_dma_read(gpio_port_value_t samples[]) {
+    uint32_t scan;
+    do {
+        scan = scans;
+        if (scan == last_scan) {
+            return false;
+        }
+        memcpy(samples, &sample_buffer[complete_half * row_count], row_count * sizeof(gpio_port_value_t));
+        // The DMA came back round to the copied half, take the newer scan instead
+    } while (scan != scans);
+
+    last_scan = scan;
+    return true;
+}
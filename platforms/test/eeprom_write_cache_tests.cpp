@@ -0,0 +1,143 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#define EEPROM_WRITE_CACHE_FRONTEND
+#include "eeprom_driver.h"
+#include "eeprom_write_cache.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+/* Backing store standing in for the selected EEPROM_DRIVER, counting how often it is touched */
+static uint8_t  backing[EEPROM_SIZE];
+static uint32_t backend_writes;
+static uint32_t backend_bytes_written;
+
+void eeprom_driver_init(void) {}
+
+void eeprom_driver_format(bool erase) {}
+
+void eeprom_driver_erase(void) {
+    memset(backing, 0, sizeof(backing));
+}
+
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len) {
+    memcpy(buf, &backing[(uintptr_t)addr], len);
+}
+
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
+    memcpy(&backing[(uintptr_t)addr], buf, len);
+    backend_writes++;
+    backend_bytes_written += len;
+}
+}
+
+class EepromWriteCacheTest : public testing::Test {
+   protected:
+    void SetUp() override {
+        eeprom_write_cache_discard();
+        eeprom_driver_erase();
+        backend_writes        = 0;
+        backend_bytes_written = 0;
+        set_time(0);
+    }
+};
+
+TEST_F(EepromWriteCacheTest, WritesAreDeferredAndVisibleToReads) {
+    eeprom_update_dword((uint32_t *)4, 0xdeadbeef);
+    EXPECT_EQ(backend_writes, 0u);
+    EXPECT_TRUE(eeprom_write_cache_is_dirty());
+    EXPECT_EQ(eeprom_read_dword((const uint32_t *)4), 0xdeadbeefu);
+    EXPECT_EQ(backing[4], 0);
+
+    advance_time(EEPROM_WRITE_CACHE_IDLE_TIMEOUT - 1);
+    eeprom_write_cache_task();
+    EXPECT_EQ(backend_writes, 0u);
+
+    advance_time(1);
+    eeprom_write_cache_task();
+    EXPECT_EQ(backend_writes, 1u);
+    EXPECT_FALSE(eeprom_write_cache_is_dirty());
+    EXPECT_EQ(eeprom_read_dword((const uint32_t *)4), 0xdeadbeefu);
+}
+
+TEST_F(EepromWriteCacheTest, RepeatedWritesCoalesce) {
+    for (uint8_t i = 0; i < 100; i++) {
+        eeprom_update_byte((uint8_t *)10, i);
+        eeprom_update_byte((uint8_t *)11, i + 1);
+        advance_time(1);
+        eeprom_write_cache_task();
+    }
+    eeprom_write_cache_flush();
+    EXPECT_EQ(backend_writes, 1u);
+    EXPECT_EQ(backend_bytes_written, 2u);
+    EXPECT_EQ(backing[10], 99);
+    EXPECT_EQ(backing[11], 100);
+}
+
+TEST_F(EepromWriteCacheTest, UnchangedBytesAreNotWrittenBack) {
+    backing[20] = 0x12;
+    backing[22] = 0x34;
+    uint8_t data[4] = {0x12, 0xaa, 0x34, 0xbb};
+    eeprom_write_block(data, (void *)20, sizeof(data));
+    eeprom_write_cache_flush();
+    EXPECT_EQ(backend_writes, 2u);
+    EXPECT_EQ(backend_bytes_written, 2u);
+    EXPECT_EQ(backing[21], 0xaa);
+    EXPECT_EQ(backing[23], 0xbb);
+}
+
+TEST_F(EepromWriteCacheTest, BlocksSpanningLinesRoundTrip) {
+    uint8_t data[EEPROM_WRITE_CACHE_LINE_SIZE + 4];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i + 1;
+    }
+    eeprom_write_block(data, (void *)(EEPROM_WRITE_CACHE_LINE_SIZE - 2), sizeof(data));
+
+    uint8_t readback[sizeof(data) + 2] = {0};
+    eeprom_read_block(readback, (const void *)(EEPROM_WRITE_CACHE_LINE_SIZE - 3), sizeof(readback));
+    EXPECT_EQ(readback[0], 0);
+    EXPECT_EQ(memcmp(&readback[1], data, sizeof(data)), 0);
+    EXPECT_EQ(readback[sizeof(readback) - 1], 0);
+
+    eeprom_write_cache_flush();
+    EXPECT_EQ(memcmp(&backing[EEPROM_WRITE_CACHE_LINE_SIZE - 2], data, sizeof(data)), 0);
+}
+
+TEST_F(EepromWriteCacheTest, OldestLineIsEvictedWhenFull) {
+    eeprom_update_byte((uint8_t *)0, 1);
+    advance_time(1);
+    eeprom_update_byte((uint8_t *)(EEPROM_WRITE_CACHE_LINE_SIZE * 1), 2);
+    advance_time(1);
+    EXPECT_EQ(backend_writes, 0u);
+
+    eeprom_update_byte((uint8_t *)(EEPROM_WRITE_CACHE_LINE_SIZE * 2), 3);
+    EXPECT_EQ(backend_writes, 1u);
+    EXPECT_EQ(backing[0], 1);
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)(EEPROM_WRITE_CACHE_LINE_SIZE * 1)), 2);
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)(EEPROM_WRITE_CACHE_LINE_SIZE * 2)), 3);
+}
+
+TEST_F(EepromWriteCacheTest, MaxAgeFlushesDuringContinuousWrites) {
+    uint32_t elapsed = 0;
+    while (backend_writes == 0 && elapsed <= EEPROM_WRITE_CACHE_MAX_AGE) {
+        eeprom_update_byte((uint8_t *)40, (uint8_t)elapsed);
+        advance_time(10);
+        elapsed += 10;
+        eeprom_write_cache_task();
+    }
+    EXPECT_EQ(backend_writes, 1u);
+    EXPECT_GE(elapsed, (uint32_t)EEPROM_WRITE_CACHE_MAX_AGE);
+}
+
+TEST_F(EepromWriteCacheTest, DiscardDropsPendingWrites) {
+    eeprom_update_byte((uint8_t *)5, 0x55);
+    eeprom_write_cache_discard();
+    eeprom_write_cache_flush();
+    EXPECT_EQ(backend_writes, 0u);
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)5), 0);
+}
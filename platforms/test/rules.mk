@@ -23,3 +23,11 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+eeprom_write_cache_DEFS := -DEEPROM_DRIVER -DEEPROM_CUSTOM -DEEPROM_SIZE=256 -DEEPROM_WRITE_CACHE_ENABLE -DEEPROM_WRITE_CACHE_LINE_COUNT=2 -DNO_PRINT
+
+eeprom_write_cache_SRC := \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_write_cache.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_write_cache_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
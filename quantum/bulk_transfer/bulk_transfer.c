@@ -0,0 +1,211 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "bulk_transfer.h"
+
+static struct {
+    const bulk_transfer_region_t *region;
+    uint16_t                      offset;
+    uint16_t                      length;
+    uint16_t                      next_index;
+    uint16_t                      packet_count;
+    uint32_t                      crc;
+    uint8_t                       window;
+    bool                          write;
+    bool                          nacked;
+} transfer = {0};
+
+// Written data is only handed to the region once the whole transfer has been verified
+static uint8_t staging[BULK_TRANSFER_STAGING_SIZE];
+
+// CRC-32 (IEEE 802.3, reflected), nibble at a time to keep the table small
+static const uint32_t crc32_table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+/**
+ * @brief Updates a CRC32, start with 0 and chain the result to checksum data in pieces
+ */
+uint32_t bulk_transfer_crc32(uint32_t crc, const uint8_t *data, uint16_t length) {
+    crc = ~crc;
+    for (uint16_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ crc32_table[crc & 0x0F];
+        crc = (crc >> 4) ^ crc32_table[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+static inline uint16_t bulk_transfer_get_u16(const uint8_t *data) {
+    return ((uint16_t)data[0] << 8) | data[1];
+}
+
+static inline void bulk_transfer_put_u16(uint8_t *data, uint16_t value) {
+    data[0] = value >> 8;
+    data[1] = value & 0xFF;
+}
+
+static inline void bulk_transfer_put_u32(uint8_t *data, uint32_t value) {
+    data[0] = (value >> 24) & 0xFF;
+    data[1] = (value >> 16) & 0xFF;
+    data[2] = (value >> 8) & 0xFF;
+    data[3] = value & 0xFF;
+}
+
+static void bulk_transfer_ack(uint8_t *data, bulk_transfer_status_t status) {
+    data[1] = status;
+    bulk_transfer_put_u16(&data[2], transfer.next_index);
+}
+
+/**
+ * @brief Starts a transfer, replacing any transfer already in progress
+ *
+ * @param[in,out] data begin request, overwritten with the reply
+ * @param[in] region region selected by data[1], or NULL if unknown
+ */
+void bulk_transfer_begin(uint8_t *data, const bulk_transfer_region_t *region) {
+    uint16_t offset = bulk_transfer_get_u16(&data[3]);
+    uint16_t length = bulk_transfer_get_u16(&data[5]);
+    uint8_t  window = data[7];
+    bool     write  = data[2] == BULK_TRANSFER_WRITE;
+
+    memset(&transfer, 0, sizeof(transfer));
+
+    if (window == 0 || window > BULK_TRANSFER_MAX_WINDOW) {
+        window = BULK_TRANSFER_MAX_WINDOW;
+    }
+
+    // The limits are sent back even on failure, so that the host can size its next attempt
+    data[2] = BULK_TRANSFER_PAYLOAD_SIZE;
+    data[3] = window;
+    bulk_transfer_put_u16(&data[4], sizeof(staging));
+
+    if (region == NULL) {
+        data[1] = BULK_TRANSFER_ERROR_REGION;
+        return;
+    }
+    if (length == 0 || (uint32_t)offset + length > region->get_size() || (write && length > sizeof(staging))) {
+        data[1] = BULK_TRANSFER_ERROR_RANGE;
+        return;
+    }
+
+    transfer.region       = region;
+    transfer.offset       = offset;
+    transfer.length       = length;
+    transfer.packet_count = (length + BULK_TRANSFER_PAYLOAD_SIZE - 1) / BULK_TRANSFER_PAYLOAD_SIZE;
+    transfer.window       = window;
+    transfer.write        = write;
+
+    data[1] = BULK_TRANSFER_OK;
+}
+
+/**
+ * @brief Handles a data packet
+ *
+ * Writes are only acknowledged at the end of each window, on the last packet, or on the first out of order packet.
+ * Later out of order packets are dropped silently until the expected index arrives again.
+ * Reads stream a full window through send() starting at the requested index.
+ *
+ * @param[in,out] data data packet, overwritten with the reply if one is due
+ * @param[in] length report length
+ * @param[in] send used to stream read packets
+ * @return true if data holds a reply that should be sent back
+ */
+bool bulk_transfer_data(uint8_t *data, uint8_t length, bulk_transfer_send_t send) {
+    if (transfer.region == NULL) {
+        bulk_transfer_ack(data, BULK_TRANSFER_ERROR_STATE);
+        return true;
+    }
+
+    uint16_t index = bulk_transfer_get_u16(&data[1]);
+
+    if (transfer.write) {
+        if (index != transfer.next_index || index >= transfer.packet_count) {
+            if (transfer.nacked) {
+                return false;
+            }
+            transfer.nacked = true;
+            bulk_transfer_ack(data, BULK_TRANSFER_ERROR_SEQUENCE);
+            return true;
+        }
+        transfer.nacked = false;
+
+        uint16_t position = index * BULK_TRANSFER_PAYLOAD_SIZE;
+        uint16_t size     = transfer.length - position;
+        if (size > BULK_TRANSFER_PAYLOAD_SIZE) {
+            size = BULK_TRANSFER_PAYLOAD_SIZE;
+        }
+        memcpy(&staging[position], &data[BULK_TRANSFER_HEADER_SIZE], size);
+        transfer.crc = bulk_transfer_crc32(transfer.crc, &data[BULK_TRANSFER_HEADER_SIZE], size);
+        transfer.next_index++;
+
+        if (transfer.next_index % transfer.window == 0 || transfer.next_index == transfer.packet_count) {
+            bulk_transfer_ack(data, BULK_TRANSFER_OK);
+            return true;
+        }
+        return false;
+    }
+
+    if (index >= transfer.packet_count) {
+        bulk_transfer_ack(data, BULK_TRANSFER_ERROR_RANGE);
+        return true;
+    }
+    for (uint8_t i = 0; i < transfer.window && index < transfer.packet_count; i++, index++) {
+        uint16_t position = index * BULK_TRANSFER_PAYLOAD_SIZE;
+        uint16_t size     = transfer.length - position;
+        if (size > BULK_TRANSFER_PAYLOAD_SIZE) {
+            size = BULK_TRANSFER_PAYLOAD_SIZE;
+        }
+        memset(&data[BULK_TRANSFER_HEADER_SIZE], 0, length - BULK_TRANSFER_HEADER_SIZE);
+        bulk_transfer_put_u16(&data[1], index);
+        transfer.region->read(transfer.offset + position, size, &data[BULK_TRANSFER_HEADER_SIZE]);
+        send(data, length);
+    }
+    transfer.next_index = index;
+    return false;
+}
+
+/**
+ * @brief Finishes a transfer, verifying the host CRC32 of a write
+ *
+ * A write is only applied to the region here, once every packet has arrived and the CRC32 matches.
+ * Reads return the CRC32 of the whole range, computed from the region, for the host to compare.
+ *
+ * @param[in,out] data end request, overwritten with the reply
+ * @return bulk_transfer_status_t, BULK_TRANSFER_OK once a write has been applied
+ */
+bulk_transfer_status_t bulk_transfer_end(uint8_t *data) {
+    bulk_transfer_status_t status = BULK_TRANSFER_OK;
+    uint32_t               crc    = 0;
+
+    if (transfer.region == NULL) {
+        status = BULK_TRANSFER_ERROR_STATE;
+    } else if (transfer.write) {
+        uint32_t expected = ((uint32_t)bulk_transfer_get_u16(&data[1]) << 16) | bulk_transfer_get_u16(&data[3]);
+        crc               = transfer.crc;
+        if (transfer.next_index != transfer.packet_count) {
+            status = BULK_TRANSFER_ERROR_LENGTH;
+        } else if (crc != expected) {
+            status = BULK_TRANSFER_ERROR_CRC;
+        } else {
+            transfer.region->write(transfer.offset, transfer.length, staging);
+        }
+    } else {
+        uint8_t buffer[BULK_TRANSFER_PAYLOAD_SIZE];
+        for (uint16_t position = 0; position < transfer.length; position += sizeof(buffer)) {
+            uint16_t size = transfer.length - position;
+            if (size > sizeof(buffer)) {
+                size = sizeof(buffer);
+            }
+            transfer.region->read(transfer.offset + position, size, buffer);
+            crc = bulk_transfer_crc32(crc, buffer, size);
+        }
+    }
+
+    memset(&transfer, 0, sizeof(transfer));
+
+    data[1] = status;
+    bulk_transfer_put_u32(&data[2], crc);
+    return status;
+}
@@ -0,0 +1,70 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Windowed bulk transfers over fixed size raw HID reports.
+ *
+ * Every packet keeps the caller's command id in data[0]. Layouts of the remaining bytes:
+ *
+ *   begin request:  [region] [direction] [offset hi] [offset lo] [length hi] [length lo] [window]
+ *   begin reply:    [status] [payload size] [window] [max write length hi] [max write length lo]
+ *   data (write):   [index hi] [index lo] [payload...]           host -> keyboard, no reply per packet
+ *   data (read):    [index hi] [index lo]                         host -> keyboard, requests one window
+ *                   [index hi] [index lo] [payload...]           keyboard -> host, window packets
+ *   ack:            [status] [next index hi] [next index lo]     after each window, the last packet, or an error
+ *   end request:    [crc32, big endian]
+ *   end reply:      [status] [crc32 of the transferred range, big endian]
+ *
+ * Writes are staged in RAM as they arrive, and only handed to the region once the transfer ends with every packet
+ * received and a matching CRC32. A write may therefore be no longer than BULK_TRANSFER_STAGING_SIZE, larger ranges are
+ * written as several transfers.
+ */
+
+#ifndef BULK_TRANSFER_PACKET_SIZE
+#    define BULK_TRANSFER_PACKET_SIZE 32
+#endif
+
+#ifndef BULK_TRANSFER_MAX_WINDOW
+#    define BULK_TRANSFER_MAX_WINDOW 16
+#endif
+
+#ifndef BULK_TRANSFER_STAGING_SIZE
+#    define BULK_TRANSFER_STAGING_SIZE 1024
+#endif
+
+// command id plus a 16-bit packet index
+#define BULK_TRANSFER_HEADER_SIZE 3
+#define BULK_TRANSFER_PAYLOAD_SIZE (BULK_TRANSFER_PACKET_SIZE - BULK_TRANSFER_HEADER_SIZE)
+
+typedef enum {
+    BULK_TRANSFER_READ  = 0,
+    BULK_TRANSFER_WRITE = 1,
+} bulk_transfer_direction_t;
+
+typedef enum {
+    BULK_TRANSFER_OK             = 0x00,
+    BULK_TRANSFER_ERROR_REGION   = 0x01, // Unknown region
+    BULK_TRANSFER_ERROR_RANGE    = 0x02, // Offset or length outside the region, or a write longer than the staging buffer
+    BULK_TRANSFER_ERROR_STATE    = 0x03, // No transfer in progress, or wrong direction
+    BULK_TRANSFER_ERROR_SEQUENCE = 0x04, // Packet out of order, resend from the returned index
+    BULK_TRANSFER_ERROR_LENGTH   = 0x05, // Transfer ended before all data was received
+    BULK_TRANSFER_ERROR_CRC      = 0x06, // CRC32 mismatch
+} bulk_transfer_status_t;
+
+typedef struct {
+    uint16_t (*get_size)(void);
+    void (*read)(uint16_t offset, uint16_t size, uint8_t *data);
+    void (*write)(uint16_t offset, uint16_t size, uint8_t *data);
+} bulk_transfer_region_t;
+
+typedef void (*bulk_transfer_send_t)(uint8_t *data, uint8_t length);
+
+void                   bulk_transfer_begin(uint8_t *data, const bulk_transfer_region_t *region);
+bool                   bulk_transfer_data(uint8_t *data, uint8_t length, bulk_transfer_send_t send);
+bulk_transfer_status_t bulk_transfer_end(uint8_t *data);
+uint32_t               bulk_transfer_crc32(uint32_t crc, const uint8_t *data, uint16_t length);
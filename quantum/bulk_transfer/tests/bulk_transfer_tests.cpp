@@ -0,0 +1,323 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <vector>
+
+extern "C" {
+#include "bulk_transfer.h"
+}
+
+enum {
+    CMD_BEGIN = 0xE0,
+    CMD_DATA  = 0xE1,
+    CMD_END   = 0xE2,
+};
+
+typedef std::array<uint8_t, BULK_TRANSFER_PACKET_SIZE> packet_t;
+
+/* Region standing in for the dynamic keymap */
+static std::vector<uint8_t> region_data(4096);
+
+static uint16_t region_get_size(void) {
+    return region_data.size();
+}
+
+static void region_read(uint16_t offset, uint16_t size, uint8_t *data) {
+    memcpy(data, &region_data[offset], size);
+}
+
+static void region_write(uint16_t offset, uint16_t size, uint8_t *data) {
+    memcpy(&region_data[offset], data, size);
+}
+
+static const bulk_transfer_region_t region = {region_get_size, region_read, region_write};
+
+/* Reports travelling from the keyboard to the host */
+static std::deque<packet_t> replies;
+
+static void device_send(uint8_t *data, uint8_t length) {
+    packet_t packet;
+    memcpy(packet.data(), data, length);
+    replies.push_back(packet);
+}
+
+/* Mirrors the VIA command dispatch for the three bulk transfer commands */
+static void device_receive(packet_t packet) {
+    uint8_t *data = packet.data();
+    switch (data[0]) {
+        case CMD_BEGIN:
+            bulk_transfer_begin(data, data[1] == 0 ? &region : NULL);
+            break;
+        case CMD_DATA:
+            if (!bulk_transfer_data(data, packet.size(), device_send)) {
+                return;
+            }
+            break;
+        case CMD_END:
+            bulk_transfer_end(data);
+            break;
+    }
+    device_send(data, packet.size());
+}
+
+static uint16_t get_u16(const uint8_t *data) {
+    return (data[0] << 8) | data[1];
+}
+
+static uint32_t get_u32(const uint8_t *data) {
+    return ((uint32_t)get_u16(&data[0]) << 16) | get_u16(&data[2]);
+}
+
+class Host {
+   public:
+    uint32_t reports_out = 0;
+    uint32_t reports_in  = 0;
+    uint32_t round_trips = 0;
+    uint8_t  payload     = 0;
+    uint8_t  window      = 0;
+    uint16_t max_write   = 0;
+
+    void send(const packet_t &packet) {
+        reports_out++;
+        device_receive(packet);
+    }
+
+    // Waiting on the keyboard is what costs a round trip on a real host
+    packet_t receive(void) {
+        EXPECT_FALSE(replies.empty());
+        packet_t packet = replies.front();
+        replies.pop_front();
+        reports_in++;
+        return packet;
+    }
+
+    uint8_t begin(uint8_t region_id, bulk_transfer_direction_t direction, uint16_t offset, uint16_t length, uint8_t requested_window = 0) {
+        packet_t packet = {CMD_BEGIN, region_id, direction, (uint8_t)(offset >> 8), (uint8_t)offset, (uint8_t)(length >> 8), (uint8_t)length, requested_window};
+        send(packet);
+        round_trips++;
+        packet_t reply = receive();
+        payload        = reply[2];
+        window         = reply[3];
+        max_write      = get_u16(&reply[4]);
+        return reply[1];
+    }
+
+    uint8_t end(uint32_t crc, uint32_t *device_crc = NULL) {
+        packet_t packet = {CMD_END, (uint8_t)(crc >> 24), (uint8_t)(crc >> 16), (uint8_t)(crc >> 8), (uint8_t)crc};
+        send(packet);
+        round_trips++;
+        packet_t reply = receive();
+        if (device_crc != NULL) {
+            *device_crc = get_u32(&reply[2]);
+        }
+        return reply[1];
+    }
+
+    packet_t data_packet(const uint8_t *data, uint16_t length, uint16_t index) {
+        packet_t packet = {CMD_DATA, (uint8_t)(index >> 8), (uint8_t)index};
+        uint16_t position = index * payload;
+        memcpy(&packet[BULK_TRANSFER_HEADER_SIZE], &data[position], std::min<uint16_t>(payload, length - position));
+        return packet;
+    }
+
+    // Splits the range into transfers no longer than the keyboard can stage, which the first begin reply reports
+    bool write(uint16_t offset, const uint8_t *data, uint16_t length, int drop_index = -1) {
+        uint16_t size = length;
+        for (uint16_t position = 0; position < length; position += size) {
+            size           = std::min<uint16_t>(size, length - position);
+            uint8_t status = begin(0, BULK_TRANSFER_WRITE, offset + position, size);
+            if (status == BULK_TRANSFER_ERROR_RANGE && size > max_write) {
+                size   = max_write;
+                status = begin(0, BULK_TRANSFER_WRITE, offset + position, size);
+            }
+            if (status != BULK_TRANSFER_OK || !write_transfer(&data[position], size, drop_index)) {
+                return false;
+            }
+            drop_index = -1;
+        }
+        return true;
+    }
+
+    // Streams a window of packets, then waits for the single ack, rewinding when the keyboard asks for it
+    bool write_transfer(const uint8_t *data, uint16_t length, int drop_index) {
+        uint16_t packets = (length + payload - 1) / payload;
+        uint16_t index   = 0;
+        while (index < packets) {
+            uint16_t last = std::min<uint16_t>(packets, (index / window + 1) * window);
+            for (uint16_t i = index; i < last; i++) {
+                if (i == drop_index) {
+                    drop_index = -1;
+                    continue;
+                }
+                send(data_packet(data, length, i));
+            }
+            round_trips++;
+            packet_t ack = receive();
+            replies.clear();
+            if (ack[1] != BULK_TRANSFER_OK && ack[1] != BULK_TRANSFER_ERROR_SEQUENCE) {
+                return false;
+            }
+            index = get_u16(&ack[2]);
+        }
+        return end(bulk_transfer_crc32(0, data, length)) == BULK_TRANSFER_OK;
+    }
+
+    bool read(uint16_t offset, uint8_t *data, uint16_t length) {
+        if (begin(0, BULK_TRANSFER_READ, offset, length) != BULK_TRANSFER_OK) {
+            return false;
+        }
+        uint16_t packets = (length + payload - 1) / payload;
+        for (uint16_t index = 0; index < packets; index += window) {
+            packet_t packet = {CMD_DATA, (uint8_t)(index >> 8), (uint8_t)index};
+            send(packet);
+            round_trips++;
+            for (uint16_t i = index; i < packets && i < index + window; i++) {
+                packet_t reply    = receive();
+                uint16_t position = get_u16(&reply[1]) * payload;
+                EXPECT_EQ(position, i * payload);
+                memcpy(&data[position], &reply[BULK_TRANSFER_HEADER_SIZE], std::min<uint16_t>(payload, length - position));
+            }
+        }
+        uint32_t device_crc = 0;
+        return end(0, &device_crc) == BULK_TRANSFER_OK && device_crc == bulk_transfer_crc32(0, data, length);
+    }
+};
+
+class BulkTransferTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        std::fill(region_data.begin(), region_data.end(), 0);
+        replies.clear();
+        uint8_t end_request[BULK_TRANSFER_PACKET_SIZE] = {CMD_END};
+        bulk_transfer_end(end_request);
+    }
+
+    std::vector<uint8_t> pattern(uint16_t length) {
+        std::vector<uint8_t> data(length);
+        for (uint16_t i = 0; i < length; i++) {
+            data[i] = (i * 7 + (i >> 8)) & 0xFF;
+        }
+        return data;
+    }
+};
+
+TEST_F(BulkTransferTest, Crc32CheckValue) {
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    EXPECT_EQ(bulk_transfer_crc32(0, check, sizeof(check)), 0xCBF43926u);
+    EXPECT_EQ(bulk_transfer_crc32(bulk_transfer_crc32(0, check, 4), &check[4], 5), 0xCBF43926u);
+}
+
+TEST_F(BulkTransferTest, BeginValidatesRegionAndRange) {
+    Host host;
+    EXPECT_EQ(host.begin(1, BULK_TRANSFER_WRITE, 0, 16), BULK_TRANSFER_ERROR_REGION);
+    EXPECT_EQ(host.begin(0, BULK_TRANSFER_WRITE, 4090, 16), BULK_TRANSFER_ERROR_RANGE);
+    EXPECT_EQ(host.begin(0, BULK_TRANSFER_WRITE, 0, 0), BULK_TRANSFER_ERROR_RANGE);
+    EXPECT_EQ(host.begin(0, BULK_TRANSFER_WRITE, 0, 16, 200), BULK_TRANSFER_OK);
+    EXPECT_EQ(host.payload, BULK_TRANSFER_PAYLOAD_SIZE);
+    EXPECT_EQ(host.window, BULK_TRANSFER_MAX_WINDOW);
+    EXPECT_EQ(host.max_write, BULK_TRANSFER_STAGING_SIZE);
+}
+
+TEST_F(BulkTransferTest, WriteLongerThanStagingIsRejected) {
+    Host host;
+    EXPECT_EQ(host.begin(0, BULK_TRANSFER_WRITE, 0, BULK_TRANSFER_STAGING_SIZE + 1), BULK_TRANSFER_ERROR_RANGE);
+    EXPECT_EQ(host.begin(0, BULK_TRANSFER_WRITE, 0, BULK_TRANSFER_STAGING_SIZE), BULK_TRANSFER_OK);
+    EXPECT_EQ(host.begin(0, BULK_TRANSFER_READ, 0, BULK_TRANSFER_STAGING_SIZE + 1), BULK_TRANSFER_OK);
+}
+
+TEST_F(BulkTransferTest, DataWithoutBeginIsRejected) {
+    Host     host;
+    packet_t packet = {CMD_DATA, 0, 0};
+    host.send(packet);
+    EXPECT_EQ(host.receive()[1], BULK_TRANSFER_ERROR_STATE);
+    EXPECT_EQ(host.end(0), BULK_TRANSFER_ERROR_STATE);
+}
+
+TEST_F(BulkTransferTest, WriteIsAcknowledgedOncePerWindow) {
+    Host host;
+    auto data = pattern(1000);
+    EXPECT_TRUE(host.write(100, data.data(), data.size()));
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), region_data.begin() + 100));
+    EXPECT_EQ(region_data[99], 0);
+    EXPECT_EQ(region_data[1100], 0);
+
+    uint32_t packets = (data.size() + BULK_TRANSFER_PAYLOAD_SIZE - 1) / BULK_TRANSFER_PAYLOAD_SIZE;
+    uint32_t windows = (packets + BULK_TRANSFER_MAX_WINDOW - 1) / BULK_TRANSFER_MAX_WINDOW;
+    EXPECT_EQ(host.reports_out, packets + 2);
+    EXPECT_EQ(host.reports_in, windows + 2);
+}
+
+TEST_F(BulkTransferTest, CrcMismatchIsReported) {
+    Host host;
+    auto data = pattern(64);
+    ASSERT_EQ(host.begin(0, BULK_TRANSFER_WRITE, 0, data.size()), BULK_TRANSFER_OK);
+    for (uint16_t i = 0; i < 3; i++) {
+        host.send(host.data_packet(data.data(), data.size(), i));
+    }
+    EXPECT_EQ(host.receive()[1], BULK_TRANSFER_OK);
+    EXPECT_EQ(host.end(bulk_transfer_crc32(0, data.data(), data.size()) ^ 1), BULK_TRANSFER_ERROR_CRC);
+    EXPECT_TRUE(std::all_of(region_data.begin(), region_data.end(), [](uint8_t value) { return value == 0; })) << "Region should be left unchanged";
+}
+
+TEST_F(BulkTransferTest, IncompleteWriteIsReported) {
+    Host host;
+    auto data = pattern(100);
+    ASSERT_EQ(host.begin(0, BULK_TRANSFER_WRITE, 0, data.size()), BULK_TRANSFER_OK);
+    host.send(host.data_packet(data.data(), data.size(), 0));
+    EXPECT_TRUE(replies.empty());
+    EXPECT_EQ(host.end(bulk_transfer_crc32(0, data.data(), data.size())), BULK_TRANSFER_ERROR_LENGTH);
+    EXPECT_TRUE(std::all_of(region_data.begin(), region_data.end(), [](uint8_t value) { return value == 0; })) << "Region should be left unchanged";
+}
+
+TEST_F(BulkTransferTest, DroppedPacketIsResent) {
+    Host host;
+    auto data = pattern(2000);
+    EXPECT_TRUE(host.write(0, data.data(), data.size(), 20));
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), region_data.begin()));
+}
+
+TEST_F(BulkTransferTest, OnlyFirstOutOfOrderPacketIsNacked) {
+    Host host;
+    auto data = pattern(200);
+    ASSERT_EQ(host.begin(0, BULK_TRANSFER_WRITE, 0, data.size()), BULK_TRANSFER_OK);
+    host.send(host.data_packet(data.data(), data.size(), 0));
+    host.send(host.data_packet(data.data(), data.size(), 2));
+    host.send(host.data_packet(data.data(), data.size(), 3));
+    ASSERT_EQ(replies.size(), 1u);
+    packet_t nack = host.receive();
+    EXPECT_EQ(nack[1], BULK_TRANSFER_ERROR_SEQUENCE);
+    EXPECT_EQ(get_u16(&nack[2]), 1);
+}
+
+TEST_F(BulkTransferTest, ReadReturnsRegionAndCrc) {
+    Host host;
+    auto data = pattern(4096);
+    std::copy(data.begin(), data.end(), region_data.begin());
+
+    std::vector<uint8_t> readback(3000);
+    EXPECT_TRUE(host.read(1000, readback.data(), readback.size()));
+    EXPECT_TRUE(std::equal(readback.begin(), readback.end(), data.begin() + 1000));
+}
+
+TEST_F(BulkTransferTest, Throughput) {
+    Host host;
+    auto data = pattern(region_data.size());
+
+    ASSERT_TRUE(host.write(0, data.data(), data.size()));
+
+    // The legacy VIA buffer commands move 28 bytes per request and reply
+    uint32_t legacy_round_trips = (data.size() + 27) / 28;
+
+    // Full speed interrupt endpoints move one report per direction per 1 ms frame, and a host waiting on a
+    // reply loses at least one more frame turning the request around
+    double legacy_ms = legacy_round_trips * 3.0;
+    double bulk_ms   = host.reports_out + host.reports_in + host.round_trips;
+
+    EXPECT_LT(host.round_trips * 8, legacy_round_trips);
+    EXPECT_LT(bulk_ms * 2, legacy_ms);
+}
@@ -0,0 +1,7 @@
+bulk_transfer_DEFS := -DNO_PRINT -DBULK_TRANSFER_STAGING_SIZE=2048
+
+bulk_transfer_SRC := \
+	$(QUANTUM_PATH)/bulk_transfer/tests/bulk_transfer_tests.cpp \
+	$(QUANTUM_PATH)/bulk_transfer/bulk_transfer.c
+
+bulk_transfer_INC := $(QUANTUM_PATH)/bulk_transfer
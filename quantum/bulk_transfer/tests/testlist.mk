@@ -0,0 +1 @@
+TEST_LIST += bulk_transfer
@@ -14,7 +14,7 @@
 
 #include <stdint.h>
 #include "caps_word.h"
-#include "timer.h"
+#include "deferred_exec.h"
 #include "action.h"
 #include "action_util.h"
 
@@ -28,20 +28,20 @@ static bool caps_word_active = false;
 #        error "CAPS_WORD_IDLE_TIMEOUT must be between 100 and 30000 ms"
 #    endif
 
-/** @brief Deadline for idle timeout. */
-static uint16_t idle_timer = 0;
+/** @brief Token of the scheduled idle timeout. */
+static deferred_token idle_token = INVALID_DEFERRED_TOKEN;
 
-void caps_word_task(void) {
-    if (caps_word_active && timer_expired(timer_read(), idle_timer)) {
-        caps_word_off();
-    }
+static uint32_t caps_word_idle_timeout(uint32_t trigger_time, void *cb_arg) {
+    idle_token = INVALID_DEFERRED_TOKEN;
+    caps_word_off();
+    return 0;
 }
 
 void caps_word_reset_idle_timer(void) {
-    idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    if (!extend_deferred_exec_core(idle_token, CAPS_WORD_IDLE_TIMEOUT)) {
+        idle_token = defer_exec_core(CAPS_WORD_IDLE_TIMEOUT, caps_word_idle_timeout, NULL);
+    }
 }
-#else
-void caps_word_task(void) {}
 #endif // CAPS_WORD_IDLE_TIMEOUT > 0
 
 void caps_word_on(void) {
@@ -67,6 +67,10 @@ void caps_word_off(void) {
     }
 
     unregister_weak_mods(MOD_MASK_SHIFT); // Make sure weak shift is off.
+#if CAPS_WORD_IDLE_TIMEOUT > 0
+    cancel_deferred_exec_core(idle_token);
+    idle_token = INVALID_DEFERRED_TOKEN;
+#endif // CAPS_WORD_IDLE_TIMEOUT > 0
     caps_word_active = false;
     caps_word_set_user(false);
 }
@@ -20,9 +20,6 @@
 #    define CAPS_WORD_IDLE_TIMEOUT 5000 // Default timeout of 5 seconds.
 #endif
 
-/** @brief Matrix scan task for Caps Word feature */
-void caps_word_task(void);
-
 #if CAPS_WORD_IDLE_TIMEOUT > 0
 /** @brief Resets timer for Caps Word idle timeout. */
 void caps_word_reset_idle_timer(void);
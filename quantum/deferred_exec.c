@@ -160,6 +160,8 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 // Basic API: used by user-mode code, guaranteed to not collide with core deferred execution
 //
 
+#ifdef DEFERRED_EXEC_ENABLE
+
 static uint32_t            last_deferred_exec_check                = 0;
 static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
 
@@ -175,3 +177,60 @@ bool cancel_deferred_exec(deferred_token token) {
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
+
+#endif // DEFERRED_EXEC_ENABLE
+
+//------------------------------------
+// Core API: used by core features to schedule their timeouts, instead of polling a timer from keyboard_task()
+//
+
+#ifdef DEFERRED_EXEC_CORE_ENABLE
+
+#    ifndef MAX_CORE_DEFERRED_EXECUTORS
+#        define MAX_CORE_DEFERRED_EXECUTORS 8
+#    endif
+
+static uint32_t            last_core_deferred_exec_check               = 0;
+static deferred_executor_t core_executors[MAX_CORE_DEFERRED_EXECUTORS] = {0};
+
+// Lets keyboard_task() skip reading the timer while nothing is scheduled
+static bool core_executors_pending = false;
+
+static bool core_executors_empty(void) {
+    for (int i = 0; i < MAX_CORE_DEFERRED_EXECUTORS; ++i) {
+        if (core_executors[i].token != INVALID_DEFERRED_TOKEN) {
+            return false;
+        }
+    }
+    return true;
+}
+
+deferred_token defer_exec_core(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    bool           was_empty = core_executors_empty();
+    deferred_token token     = defer_exec_advanced(core_executors, MAX_CORE_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    if (token != INVALID_DEFERRED_TOKEN) {
+        if (was_empty) {
+            // The throttle isn't updated while the table is empty, so restart it rather than comparing against a stale time
+            last_core_deferred_exec_check = timer_read32() - 1;
+        }
+        core_executors_pending = true;
+    }
+    return token;
+}
+bool extend_deferred_exec_core(deferred_token token, uint32_t delay_ms) {
+    return extend_deferred_exec_advanced(core_executors, MAX_CORE_DEFERRED_EXECUTORS, token, delay_ms);
+}
+bool cancel_deferred_exec_core(deferred_token token) {
+    return cancel_deferred_exec_advanced(core_executors, MAX_CORE_DEFERRED_EXECUTORS, token);
+}
+void deferred_exec_core_task(void) {
+    if (!core_executors_pending) {
+        return;
+    }
+
+    deferred_exec_advanced_task(core_executors, MAX_CORE_DEFERRED_EXECUTORS, &last_core_deferred_exec_check);
+
+    core_executors_pending = !core_executors_empty();
+}
+
+#endif // DEFERRED_EXEC_CORE_ENABLE
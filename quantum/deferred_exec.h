@@ -119,3 +119,39 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  * @param last_execution_time[in,out] the last execution time -- this will be checked first to determine if execution is needed, and updated if execution occurred
  */
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time);
+
+//------------------------------------
+// Core API: used by core features to schedule their timeouts, instead of polling a timer from keyboard_task()
+//------------------------------------
+
+/**
+ * Configures the supplied deferred executor to be executed after the required number of milliseconds, using the core table.
+ *
+ * @param delay_ms[in] the number of milliseconds before executing the callback
+ * @param callback[in] the executor to invoke
+ * @param cb_arg[in] the argument to pass to the executor, may be NULL if unused by the executor
+ * @return a token usable for extension/cancellation, or INVALID_DEFERRED_TOKEN if an error occurred
+ */
+deferred_token defer_exec_core(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
+
+/**
+ * Allows for extending the timeframe before an existing core deferred execution is invoked.
+ *
+ * @param token[in] the returned value from defer_exec_core for the deferred execution you wish to extend
+ * @param delay_ms[in] the number of milliseconds before executing the callback
+ * @return true if the token was extended successfully, otherwise false
+ */
+bool extend_deferred_exec_core(deferred_token token, uint32_t delay_ms);
+
+/**
+ * Allows for cancellation of an existing core deferred execution.
+ *
+ * @param token[in] the returned value from defer_exec_core for the deferred execution you wish to cancel
+ * @return true if the token was cancelled successfully, otherwise false
+ */
+bool cancel_deferred_exec_core(deferred_token token);
+
+/**
+ * Forward declaration for keyboard_task() in order to execute any due core deferred executors. Should not be invoked by keyboard/user code.
+ */
+void deferred_exec_core_task(void);
@@ -195,6 +195,44 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     }
 }
 
+uint16_t dynamic_keymap_get_buffer_size(void) {
+    return DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+}
+
+#ifdef ENCODER_MAP_ENABLE
+uint16_t dynamic_keymap_encoder_get_buffer_size(void) {
+    return DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2;
+}
+
+void dynamic_keymap_encoder_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    uint16_t dynamic_encoder_eeprom_size = dynamic_keymap_encoder_get_buffer_size();
+    void *   source                      = (void *)(DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + offset);
+    uint8_t *target                      = data;
+    for (uint16_t i = 0; i < size; i++) {
+        if (offset + i < dynamic_encoder_eeprom_size) {
+            *target = eeprom_read_byte(source);
+        } else {
+            *target = 0x00;
+        }
+        source++;
+        target++;
+    }
+}
+
+void dynamic_keymap_encoder_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    uint16_t dynamic_encoder_eeprom_size = dynamic_keymap_encoder_get_buffer_size();
+    void *   target                      = (void *)(DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + offset);
+    uint8_t *source                      = data;
+    for (uint16_t i = 0; i < size; i++) {
+        if (offset + i < dynamic_encoder_eeprom_size) {
+            eeprom_update_byte(target, *source);
+        }
+        source++;
+        target++;
+    }
+}
+#endif // ENCODER_MAP_ENABLE
+
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
     if (layer_num < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
         return dynamic_keymap_get_keycode(layer_num, row, column);
@@ -35,8 +35,15 @@ void dynamic_keymap_reset(void);
 // This is only really useful for host applications that want to get a whole keymap fast,
 // by reading 14 keycodes (28 bytes) at a time, reducing the number of raw HID transfers by
 // a factor of 14.
-void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
-void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+uint16_t dynamic_keymap_get_buffer_size(void);
+void     dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+void     dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+#ifdef ENCODER_MAP_ENABLE
+// Same as above for the encoder map, ordered by layer/encoder/direction (clockwise first)
+uint16_t dynamic_keymap_encoder_get_buffer_size(void);
+void     dynamic_keymap_encoder_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+void     dynamic_keymap_encoder_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+#endif // ENCODER_MAP_ENABLE
 
 // This overrides the one in quantum/keymap_common.c
 // uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
@@ -5,9 +5,14 @@
 #include "eeconfig.h"
 
 #if defined(EEPROM_DRIVER)
+#    define EEPROM_WRITE_CACHE_FRONTEND
 #    include "eeprom_driver.h"
 #endif
 
+#if defined(EEPROM_WRITE_CACHE_ENABLE)
+#    include "eeprom_write_cache.h"
+#endif
+
 #if defined(HAPTIC_ENABLE)
 #    include "haptic.h"
 #endif
@@ -44,6 +49,9 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
  * FIXME: needs doc
  */
 void eeconfig_init_quantum(void) {
+#if defined(EEPROM_WRITE_CACHE_ENABLE)
+    eeprom_write_cache_discard();
+#endif
 #if defined(EEPROM_DRIVER)
     eeprom_driver_format(false);
 #endif
@@ -106,6 +114,9 @@ void eeconfig_enable(void) {
  * FIXME: needs doc
  */
 void eeconfig_disable(void) {
+#if defined(EEPROM_WRITE_CACHE_ENABLE)
+    eeprom_write_cache_discard();
+#endif
 #if defined(EEPROM_DRIVER)
     eeprom_driver_format(false);
 #endif
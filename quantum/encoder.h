@@ -120,4 +120,17 @@ extern const uint16_t encoder_map[][NUM_ENCODERS][NUM_DIRECTIONS];
 void encoder_driver_init(void);
 void encoder_driver_task(void);
 
+// Interrupt driven sampling support for the quadrature driver
+typedef struct encoder_quadrature_stats_t {
+    uint32_t samples;            // number of times the encoder pins have been sampled
+    uint32_t events;             // number of events pushed from interrupt context
+    uint32_t overflows;          // number of events dropped because the interrupt queue was full
+    uint16_t sample_interval_us; // configured timer sampling interval
+} encoder_quadrature_stats_t;
+
+void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state);
+void encoder_quadrature_sample_isr(void);
+void encoder_quadrature_sampling_start(void);
+void encoder_quadrature_get_stats(encoder_quadrature_stats_t *stats);
+
 #endif // ENCODER_ENABLE
@@ -0,0 +1,102 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <vector>
+#include <algorithm>
+#include <stdio.h>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock.h"
+}
+
+struct update {
+    int8_t index;
+    bool   clockwise;
+};
+
+uint8_t updates_array_idx = 0;
+update  updates[32];
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates[updates_array_idx % 32] = {index, clockwise};
+    updates_array_idx++;
+    return true;
+}
+
+// Simulates a pin change followed by the sampling interrupt firing, without the main loop running
+void setAndSample(pin_t pin, bool val) {
+    setPin(pin, val);
+    encoder_quadrature_sample_isr();
+}
+
+void spinClockwise(uint8_t steps) {
+    for (uint8_t i = 0; i < steps; i++) {
+        setAndSample(0, false);
+        setAndSample(1, false);
+        setAndSample(0, true);
+        setAndSample(1, true);
+    }
+}
+
+class EncoderIsrTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        updates_array_idx = 0;
+        encoder_init();
+    }
+};
+
+TEST_F(EncoderIsrTest, TestNoEventsUntilTask) {
+    spinClockwise(1);
+    EXPECT_EQ(updates_array_idx, 0);
+
+    encoder_task();
+    EXPECT_EQ(updates_array_idx, 1);
+    EXPECT_EQ(updates[0].index, 0);
+    EXPECT_EQ(updates[0].clockwise, true);
+}
+
+TEST_F(EncoderIsrTest, TestFastSpinBetweenTasks) {
+    // Several detents between main loop iterations are all kept
+    spinClockwise(3);
+    encoder_task();
+    EXPECT_EQ(updates_array_idx, 3);
+
+    encoder_quadrature_stats_t stats;
+    encoder_quadrature_get_stats(&stats);
+    EXPECT_EQ(stats.samples, 12);
+    EXPECT_EQ(stats.events, 3);
+    EXPECT_EQ(stats.overflows, 0);
+}
+
+TEST_F(EncoderIsrTest, TestOverflowIsCounted) {
+    // Ring of 4 holds 3 events, the rest are dropped and counted
+    spinClockwise(5);
+    encoder_task();
+    EXPECT_EQ(updates_array_idx, 3);
+
+    encoder_quadrature_stats_t stats;
+    encoder_quadrature_get_stats(&stats);
+    EXPECT_EQ(stats.events, 3);
+    EXPECT_EQ(stats.overflows, 2);
+
+    // The ring drains fully, so sampling continues afterwards
+    spinClockwise(1);
+    encoder_task();
+    EXPECT_EQ(updates_array_idx, 4);
+}
+
+TEST_F(EncoderIsrTest, TestTaskDoesNotPollPins) {
+    setPin(0, false);
+    encoder_task();
+    setPin(1, false);
+    encoder_task();
+    setPin(0, true);
+    encoder_task();
+    setPin(1, true);
+    encoder_task();
+    EXPECT_EQ(updates_array_idx, 0);
+}
@@ -73,3 +73,13 @@ encoder_split_role_SRC := \
 	$(QUANTUM_PATH)/encoder/tests/mock_split.c \
 	$(QUANTUM_PATH)/encoder/tests/encoder_tests_split_role.cpp \
 	$(QUANTUM_PATH)/encoder.c
+
+encoder_isr_DEFS := -DENCODER_TESTS -DENCODER_ENABLE -DENCODER_MOCK_SINGLE -DENCODER_QUADRATURE_ISR_SAMPLING -DENCODER_QUADRATURE_ISR_QUEUE_SIZE=4
+encoder_isr_CONFIG := $(QUANTUM_PATH)/encoder/tests/config_mock.h
+
+encoder_isr_SRC := \
+	platforms/test/timer.c \
+	drivers/encoder/encoder_quadrature.c \
+	$(QUANTUM_PATH)/encoder/tests/mock.c \
+	$(QUANTUM_PATH)/encoder/tests/encoder_tests_isr.cpp \
+	$(QUANTUM_PATH)/encoder.c
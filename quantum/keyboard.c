@@ -83,6 +83,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef SECURE_ENABLE
 #    include "secure.h"
 #endif
+#ifdef DEFERRED_EXEC_CORE_ENABLE
+#    include "deferred_exec.h"
+#endif
 #ifdef POINTING_DEVICE_ENABLE
 #    include "pointing_device.h"
 #endif
@@ -108,8 +111,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "dip_switch.h"
 #endif
 #ifdef EEPROM_DRIVER
+#    define EEPROM_WRITE_CACHE_FRONTEND
 #    include "eeprom_driver.h"
 #endif
+#ifdef EEPROM_WRITE_CACHE_ENABLE
+#    include "eeprom_write_cache.h"
+#endif
+#if defined(EEPROM_WEAR_LEVELING) && defined(WEAR_LEVELING_BACKGROUND_CONSOLIDATION)
+#    include "wear_leveling.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -143,6 +153,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#ifdef OUTPUT_QUEUE_ENABLE
+#    include "output_queue.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -205,6 +218,9 @@ void matrix_scan_perf_task(void) {
     if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
 #    if defined(CONSOLE_ENABLE)
         dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
+#        ifdef MATRIX_IO_DELAY_CALIBRATE
+        matrix_io_delay_print();
+#        endif
 #    endif
         last_matrix_scan_count = matrix_scan_count;
         matrix_timer           = timer_now;
@@ -376,6 +392,15 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
 void housekeeping_task(void) {
     housekeeping_task_kb();
     housekeeping_task_user();
+
+#ifdef EEPROM_WRITE_CACHE_ENABLE
+    eeprom_write_cache_task();
+#endif
+#if defined(EEPROM_WEAR_LEVELING) && defined(WEAR_LEVELING_BACKGROUND_CONSOLIDATION)
+    if (last_input_activity_elapsed() > WEAR_LEVELING_BACKGROUND_CONSOLIDATION_IDLE_TIME) {
+        wear_leveling_consolidate_background();
+    }
+#endif
 }
 
 /** \brief quantum_init
@@ -572,7 +597,14 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
+#ifdef OUTPUT_QUEUE_ENABLE
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+                    if (!output_queue_hold_event(event)) {
+                        action_exec(event);
+                    }
+#else
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+#endif
                 }
 
                 switch_events(row, col, key_pressed);
@@ -615,6 +647,10 @@ void quantum_task(void) {
     }
 #endif
 
+#ifdef OUTPUT_QUEUE_ENABLE
+    output_queue_task();
+#endif
+
 #if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
     music_task();
 #endif
@@ -635,10 +671,6 @@ void quantum_task(void) {
     combo_task();
 #endif
 
-#ifdef LEADER_ENABLE
-    leader_task();
-#endif
-
 #ifdef WPM_ENABLE
     decay_wpm();
 #endif
@@ -650,18 +682,6 @@ void quantum_task(void) {
 #ifdef AUTO_SHIFT_ENABLE
     autoshift_matrix_scan();
 #endif
-
-#ifdef CAPS_WORD_ENABLE
-    caps_word_task();
-#endif
-
-#ifdef SECURE_ENABLE
-    secure_task();
-#endif
-
-#ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
-#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
@@ -674,6 +694,11 @@ void keyboard_task(void) {
 
     quantum_task();
 
+#ifdef DEFERRED_EXEC_CORE_ENABLE
+    // Timeouts scheduled by core features, such as Caps Word, Leader, Secure and Layer Lock
+    deferred_exec_core_task();
+#endif
+
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
 #endif
@@ -14,6 +14,7 @@
 
 #include "layer_lock.h"
 #include "quantum_keycodes.h"
+#include "deferred_exec.h"
 
 #ifndef NO_ACTION_LAYER
 // The current lock state. The kth bit is on if layer k is locked.
@@ -21,20 +22,31 @@ layer_state_t locked_layers = 0;
 
 // Layer Lock timer to disable layer lock after X seconds inactivity
 #    if defined(LAYER_LOCK_IDLE_TIMEOUT) && LAYER_LOCK_IDLE_TIMEOUT > 0
-uint32_t layer_lock_timer = 0;
+static deferred_token layer_lock_token = INVALID_DEFERRED_TOKEN;
 
-void layer_lock_timeout_task(void) {
-    if (locked_layers && timer_elapsed32(layer_lock_timer) > LAYER_LOCK_IDLE_TIMEOUT) {
+static uint32_t layer_lock_timeout(uint32_t trigger_time, void *cb_arg) {
+    layer_lock_token = INVALID_DEFERRED_TOKEN;
+    if (locked_layers) {
         layer_lock_all_off();
-        layer_lock_timer = timer_read32();
     }
+    return 0;
 }
 void layer_lock_activity_trigger(void) {
-    layer_lock_timer = timer_read32();
+    // Nothing to time out, so nothing is scheduled
+    if (!locked_layers) {
+        return;
+    }
+    if (!extend_deferred_exec_core(layer_lock_token, LAYER_LOCK_IDLE_TIMEOUT + 1)) {
+        layer_lock_token = defer_exec_core(LAYER_LOCK_IDLE_TIMEOUT + 1, layer_lock_timeout, NULL);
+    }
+}
+static void layer_lock_timeout_cancel(void) {
+    cancel_deferred_exec_core(layer_lock_token);
+    layer_lock_token = INVALID_DEFERRED_TOKEN;
 }
 #    else
-void layer_lock_timeout_task(void) {}
 void layer_lock_activity_trigger(void) {}
+static void layer_lock_timeout_cancel(void) {}
 #    endif // LAYER_LOCK_IDLE_TIMEOUT > 0
 
 bool is_layer_locked(uint8_t layer) {
@@ -50,11 +62,16 @@ void layer_lock_invert(uint8_t layer) {
         }
 #    endif // NO_ACTION_ONESHOT
         layer_on(layer);
+        locked_layers |= mask;
         layer_lock_activity_trigger();
     } else { // Layer is being unlocked.
         layer_off(layer);
+        locked_layers &= ~mask;
+        if (!locked_layers) {
+            layer_lock_timeout_cancel();
+        }
     }
-    layer_lock_set_kb(locked_layers ^= mask);
+    layer_lock_set_kb(locked_layers);
 }
 
 // Implement layer_lock_on/off by deferring to layer_lock_invert.
@@ -73,6 +90,7 @@ void layer_lock_off(uint8_t layer) {
 void layer_lock_all_off(void) {
     layer_and(~locked_layers);
     locked_layers = 0;
+    layer_lock_timeout_cancel();
     layer_lock_set_kb(locked_layers);
 }
 
@@ -84,7 +102,6 @@ void layer_lock_on(uint8_t layer) {}
 void layer_lock_off(uint8_t layer) {}
 void layer_lock_all_off(void) {}
 void layer_lock_invert(uint8_t layer) {}
-void layer_lock_timeout_task(void) {}
 void layer_lock_activity_trigger(void) {}
 #endif // NO_ACTION_LAYER
 
@@ -94,7 +111,3 @@ __attribute__((weak)) bool layer_lock_set_kb(layer_state_t locked_layers) {
 __attribute__((weak)) bool layer_lock_set_user(layer_state_t locked_layers) {
     return true;
 }
-
-void layer_lock_task(void) {
-    layer_lock_timeout_task();
-}
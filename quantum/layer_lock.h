@@ -91,8 +91,5 @@ void layer_lock_invert(uint8_t layer);
 bool layer_lock_set_kb(layer_state_t locked_layers);
 bool layer_lock_set_user(layer_state_t locked_layers);
 
-/** Handle various background tasks */
-void layer_lock_task(void);
-
 /** Update any configured timeouts */
 void layer_lock_activity_trigger(void);
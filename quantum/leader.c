@@ -3,6 +3,7 @@
 
 #include "leader.h"
 #include "timer.h"
+#include "deferred_exec.h"
 #include "util.h"
 
 #include <string.h>
@@ -17,6 +18,27 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+static deferred_token leader_timeout_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t leader_timeout(uint32_t trigger_time, void *cb_arg) {
+    if (leader_sequence_active() && !leader_sequence_timed_out()) {
+#if defined(LEADER_NO_TIMEOUT)
+        if (leader_sequence_size == 0) {
+            // Rescheduled by leader_reset_timer() once the first key is added
+            leader_timeout_token = INVALID_DEFERRED_TOKEN;
+            return 0;
+        }
+#endif
+        // The timer was reset without going through leader_reset_timer()
+        return LEADER_TIMEOUT + 1 - timer_elapsed(leader_time);
+    }
+    leader_timeout_token = INVALID_DEFERRED_TOKEN;
+    if (leader_sequence_active()) {
+        leader_end();
+    }
+    return 0;
+}
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -27,22 +49,18 @@ void leader_start(void) {
     }
     leader_start_user();
     leading              = true;
-    leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+    leader_reset_timer();
 }
 
 void leader_end(void) {
     leading = false;
+    cancel_deferred_exec_core(leader_timeout_token);
+    leader_timeout_token = INVALID_DEFERRED_TOKEN;
     leader_end_user();
 }
 
-void leader_task(void) {
-    if (leader_sequence_active() && leader_sequence_timed_out()) {
-        leader_end();
-    }
-}
-
 bool leader_sequence_active(void) {
     return leading;
 }
@@ -74,6 +92,9 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    if (!extend_deferred_exec_core(leader_timeout_token, LEADER_TIMEOUT + 1)) {
+        leader_timeout_token = defer_exec_core(LEADER_TIMEOUT + 1, leader_timeout, NULL);
+    }
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
@@ -31,8 +31,6 @@ void leader_start(void);
  */
 void leader_end(void);
 
-void leader_task(void);
-
 /**
  * Whether the leader sequence is active.
  */
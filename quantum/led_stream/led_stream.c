@@ -0,0 +1,151 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "led_stream.h"
+
+static led_stream_rgb_t frames[2][LED_STREAM_LED_COUNT];
+static led_stream_rgb_t palette[LED_STREAM_PALETTE_SIZE];
+static uint8_t          front       = 0;
+static uint16_t         frame_count = 0;
+static uint8_t          status      = LED_STREAM_OK;
+
+static inline uint16_t led_stream_get_u16(const uint8_t *data) {
+    return ((uint16_t)data[0] << 8) | data[1];
+}
+
+static inline void led_stream_error(led_stream_status_t error) {
+    if (status == LED_STREAM_OK) {
+        status = error;
+    }
+}
+
+static void led_stream_palette(const uint8_t *data) {
+    uint8_t first = data[2];
+    uint8_t count = data[3];
+    if (count > LED_STREAM_PALETTE_MAX) {
+        led_stream_error(LED_STREAM_ERROR_LENGTH);
+        return;
+    }
+    if (first >= LED_STREAM_PALETTE_SIZE || count > LED_STREAM_PALETTE_SIZE - first) {
+        led_stream_error(LED_STREAM_ERROR_RANGE);
+        return;
+    }
+    memcpy(&palette[first], &data[4], count * sizeof(led_stream_rgb_t));
+}
+
+static void led_stream_runs(const uint8_t *data) {
+    led_stream_rgb_t *back  = frames[front ^ 1];
+    uint16_t          led   = led_stream_get_u16(&data[2]);
+    uint8_t           count = data[4];
+    if (count > LED_STREAM_RUNS_MAX) {
+        led_stream_error(LED_STREAM_ERROR_LENGTH);
+        return;
+    }
+    for (const uint8_t *run = &data[5]; count > 0; count--, run += 2) {
+        uint8_t length = run[0];
+        uint8_t index  = run[1];
+        if (led > LED_STREAM_LED_COUNT || length > LED_STREAM_LED_COUNT - led) {
+            led_stream_error(LED_STREAM_ERROR_RANGE);
+            return;
+        }
+        if (index != LED_STREAM_RUN_KEEP) {
+            if (index >= LED_STREAM_PALETTE_SIZE) {
+                led_stream_error(LED_STREAM_ERROR_PALETTE);
+                return;
+            }
+            led_stream_rgb_t color = palette[index];
+            for (uint8_t i = 0; i < length; i++) {
+                back[led + i] = color;
+            }
+        }
+        led += length;
+    }
+}
+
+static void led_stream_raw(const uint8_t *data) {
+    uint16_t led   = led_stream_get_u16(&data[2]);
+    uint8_t  count = data[4];
+    if (count > LED_STREAM_RAW_MAX) {
+        led_stream_error(LED_STREAM_ERROR_LENGTH);
+        return;
+    }
+    if (led > LED_STREAM_LED_COUNT || count > LED_STREAM_LED_COUNT - led) {
+        led_stream_error(LED_STREAM_ERROR_RANGE);
+        return;
+    }
+    memcpy(&frames[front ^ 1][led], &data[5], count * sizeof(led_stream_rgb_t));
+}
+
+/**
+ * @brief Handles a stream packet
+ *
+ * @param[in,out] data stream packet, overwritten with the reply if one is due
+ * @param[in] length report length
+ * @return true if data holds a reply that should be sent back
+ */
+bool led_stream_receive(uint8_t *data, uint8_t length) {
+    switch (data[1]) {
+        case LED_STREAM_OP_INFO:
+            memset(&data[1], 0, length - 1);
+            data[1] = LED_STREAM_OK;
+            data[2] = LED_STREAM_LED_COUNT >> 8;
+            data[3] = LED_STREAM_LED_COUNT & 0xFF;
+            data[4] = LED_STREAM_PALETTE_SIZE;
+            data[5] = LED_STREAM_VERSION;
+            return true;
+        case LED_STREAM_OP_PALETTE:
+            led_stream_palette(data);
+            return false;
+        case LED_STREAM_OP_RUNS:
+            led_stream_runs(data);
+            return false;
+        case LED_STREAM_OP_RAW:
+            led_stream_raw(data);
+            return false;
+        case LED_STREAM_OP_COMMIT: {
+            bool ack = data[2] & 1;
+            front ^= 1;
+            // The next frame starts from this one so that it only has to carry changes
+            memcpy(frames[front ^ 1], frames[front], sizeof(frames[0]));
+            frame_count++;
+            if (!ack) {
+                status = LED_STREAM_OK;
+                return false;
+            }
+            memset(&data[1], 0, length - 1);
+            data[1] = status;
+            data[2] = frame_count >> 8;
+            data[3] = frame_count & 0xFF;
+            status  = LED_STREAM_OK;
+            return true;
+        }
+        default:
+            led_stream_error(LED_STREAM_ERROR_OP);
+            return false;
+    }
+}
+
+/**
+ * @brief The frame on show, LED_STREAM_LED_COUNT colors in LED order
+ */
+const led_stream_rgb_t *led_stream_frame(void) {
+    return frames[front];
+}
+
+/**
+ * @brief Number of frames committed so far, wrapping at 16 bits
+ */
+uint16_t led_stream_frame_count(void) {
+    return frame_count;
+}
+
+/**
+ * @brief Blanks both frames and the palette, and restarts the frame count
+ */
+void led_stream_clear(void) {
+    memset(frames, 0, sizeof(frames));
+    memset(palette, 0, sizeof(palette));
+    frame_count = 0;
+    status      = LED_STREAM_OK;
+}
@@ -0,0 +1,72 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Host driven per-LED frames over fixed size raw HID reports.
+ *
+ * Every packet keeps the caller's command id in data[0] and the operation in data[1]. Layouts of the remaining bytes:
+ *
+ *   info:     request  []
+ *             reply    [status] [led count hi] [led count lo] [palette size] [version]
+ *   palette:  [first index] [count] [r g b]...                       sets palette entries
+ *   runs:     [led hi] [led lo] [count] [length, index]...           paints runs of palette colors, index 0xFF keeps the LEDs as they are
+ *   raw:      [led hi] [led lo] [count] [r g b]...                   sets LEDs directly
+ *   commit:   request  [flags]                                       shows the frame, bit 0 of flags asks for a reply
+ *             reply    [status] [frame hi] [frame lo]
+ *
+ * Frames are drawn into a back buffer that starts as a copy of the frame on show, so a frame only has to carry the LEDs
+ * that changed. Nothing is sent back except for info and acknowledged commits; the first error since the last commit is
+ * reported in the commit reply.
+ */
+
+#ifndef LED_STREAM_PACKET_SIZE
+#    define LED_STREAM_PACKET_SIZE 32
+#endif
+
+#ifndef LED_STREAM_LED_COUNT
+#    define LED_STREAM_LED_COUNT RGB_MATRIX_LED_COUNT
+#endif
+
+#ifndef LED_STREAM_PALETTE_SIZE
+#    define LED_STREAM_PALETTE_SIZE 32
+#endif
+
+#define LED_STREAM_VERSION 1
+#define LED_STREAM_RUN_KEEP 0xFF
+
+// command id, operation, and for runs and raw a 16-bit LED index and a count
+#define LED_STREAM_PALETTE_MAX ((LED_STREAM_PACKET_SIZE - 4) / 3)
+#define LED_STREAM_RUNS_MAX ((LED_STREAM_PACKET_SIZE - 5) / 2)
+#define LED_STREAM_RAW_MAX ((LED_STREAM_PACKET_SIZE - 5) / 3)
+
+typedef enum {
+    LED_STREAM_OP_INFO    = 0x00,
+    LED_STREAM_OP_PALETTE = 0x01,
+    LED_STREAM_OP_RUNS    = 0x02,
+    LED_STREAM_OP_RAW     = 0x03,
+    LED_STREAM_OP_COMMIT  = 0x04,
+} led_stream_op_t;
+
+typedef enum {
+    LED_STREAM_OK            = 0x00,
+    LED_STREAM_ERROR_OP      = 0x01, // Unknown operation
+    LED_STREAM_ERROR_RANGE   = 0x02, // LEDs or palette entries past the end, the rest of the packet was dropped
+    LED_STREAM_ERROR_PALETTE = 0x03, // Run of a palette entry that doesn't exist
+    LED_STREAM_ERROR_LENGTH  = 0x04, // Count too large for one packet
+} led_stream_status_t;
+
+typedef struct {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} led_stream_rgb_t;
+
+bool                    led_stream_receive(uint8_t *data, uint8_t length);
+const led_stream_rgb_t *led_stream_frame(void);
+uint16_t                led_stream_frame_count(void);
+void                    led_stream_clear(void);
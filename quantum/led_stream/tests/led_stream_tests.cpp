@@ -0,0 +1,273 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <deque>
+#include <map>
+#include <vector>
+
+extern "C" {
+#include "led_stream.h"
+}
+
+enum {
+    CMD_STREAM = 0xE3,
+};
+
+typedef std::array<uint8_t, LED_STREAM_PACKET_SIZE> packet_t;
+typedef std::vector<led_stream_rgb_t>               frame_t;
+
+static bool operator==(const led_stream_rgb_t &a, const led_stream_rgb_t &b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+static bool operator<(const led_stream_rgb_t &a, const led_stream_rgb_t &b) {
+    return (a.r << 16 | a.g << 8 | a.b) < (b.r << 16 | b.g << 8 | b.b);
+}
+
+/* Reports travelling from the keyboard to the host */
+static std::deque<packet_t> replies;
+
+/* Mirrors the VIA command dispatch for the stream command */
+static void device_receive(packet_t packet) {
+    if (led_stream_receive(packet.data(), packet.size())) {
+        replies.push_back(packet);
+    }
+}
+
+static frame_t device_frame(void) {
+    const led_stream_rgb_t *frame = led_stream_frame();
+    return frame_t(frame, frame + LED_STREAM_LED_COUNT);
+}
+
+class Host {
+   public:
+    uint32_t reports_out = 0;
+    frame_t  shown       = frame_t(LED_STREAM_LED_COUNT, led_stream_rgb_t{0, 0, 0});
+
+    void send(const packet_t &packet) {
+        reports_out++;
+        device_receive(packet);
+    }
+
+    packet_t receive(void) {
+        EXPECT_FALSE(replies.empty());
+        packet_t packet = replies.front();
+        replies.pop_front();
+        return packet;
+    }
+
+    uint8_t commit(bool ack) {
+        packet_t packet = {CMD_STREAM, LED_STREAM_OP_COMMIT, (uint8_t)ack};
+        send(packet);
+        return ack ? receive()[1] : LED_STREAM_OK;
+    }
+
+    void send_raw(const frame_t &frame, uint16_t led, uint8_t count) {
+        packet_t packet = {CMD_STREAM, LED_STREAM_OP_RAW, (uint8_t)(led >> 8), (uint8_t)led, count};
+        memcpy(&packet[5], &frame[led], count * sizeof(led_stream_rgb_t));
+        send(packet);
+    }
+
+    // Palette and runs while the changed LEDs use few enough colors, raw packets of the changed spans otherwise
+    void send_frame(const frame_t &frame) {
+        std::map<led_stream_rgb_t, uint8_t> palette;
+        for (uint16_t i = 0; i < LED_STREAM_LED_COUNT; i++) {
+            if (!(frame[i] == shown[i]) && !palette.count(frame[i])) {
+                uint8_t index     = palette.size();
+                palette[frame[i]] = index;
+            }
+        }
+
+        if (palette.size() > LED_STREAM_PALETTE_SIZE) {
+            for (uint16_t i = 0; i < LED_STREAM_LED_COUNT;) {
+                if (frame[i] == shown[i]) {
+                    i++;
+                    continue;
+                }
+                uint16_t end = i;
+                while (end < LED_STREAM_LED_COUNT && end - i < LED_STREAM_RAW_MAX && !(frame[end] == shown[end])) {
+                    end++;
+                }
+                send_raw(frame, i, end - i);
+                i = end;
+            }
+        } else {
+            std::vector<led_stream_rgb_t> colors(palette.size());
+            for (auto &entry : palette) {
+                colors[entry.second] = entry.first;
+            }
+            for (uint8_t first = 0; first < colors.size(); first += LED_STREAM_PALETTE_MAX) {
+                uint8_t  count  = std::min<size_t>(LED_STREAM_PALETTE_MAX, colors.size() - first);
+                packet_t packet = {CMD_STREAM, LED_STREAM_OP_PALETTE, first, count};
+                memcpy(&packet[4], &colors[first], count * sizeof(led_stream_rgb_t));
+                send(packet);
+            }
+
+            // Runs of one color or of unchanged LEDs, trailing unchanged LEDs are left out
+            std::vector<std::pair<uint8_t, uint8_t>> runs;
+            uint16_t                                 painted = 0;
+            for (uint16_t i = 0; i < LED_STREAM_LED_COUNT;) {
+                bool     keep = frame[i] == shown[i];
+                uint16_t end  = i + 1;
+                while (end < LED_STREAM_LED_COUNT && end - i < 255 && (keep ? frame[end] == shown[end] : !(frame[end] == shown[end]) && frame[end] == frame[i])) {
+                    end++;
+                }
+                runs.push_back({(uint8_t)(end - i), keep ? (uint8_t)LED_STREAM_RUN_KEEP : palette[frame[i]]});
+                if (!keep) {
+                    painted = runs.size();
+                }
+                i = end;
+            }
+            runs.resize(painted);
+
+            uint16_t led = 0;
+            for (size_t first = 0; first < runs.size(); first += LED_STREAM_RUNS_MAX) {
+                uint8_t  count  = std::min<size_t>(LED_STREAM_RUNS_MAX, runs.size() - first);
+                packet_t packet = {CMD_STREAM, LED_STREAM_OP_RUNS, (uint8_t)(led >> 8), (uint8_t)led, count};
+                for (uint8_t j = 0; j < count; j++) {
+                    packet[5 + j * 2] = runs[first + j].first;
+                    packet[6 + j * 2] = runs[first + j].second;
+                    led += runs[first + j].first;
+                }
+                send(packet);
+            }
+        }
+        shown = frame;
+    }
+};
+
+class LedStreamTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        replies.clear();
+        led_stream_clear();
+    }
+
+    frame_t solid(led_stream_rgb_t color) {
+        return frame_t(LED_STREAM_LED_COUNT, color);
+    }
+
+    // Bands of a few colors scrolling along the LEDs, like an ambient light integration would send
+    frame_t bands(uint16_t step) {
+        static const led_stream_rgb_t colors[] = {{255, 0, 0}, {255, 128, 0}, {255, 255, 0}, {0, 255, 0}, {0, 0, 255}, {128, 0, 255}};
+        frame_t                       frame(LED_STREAM_LED_COUNT);
+        for (uint16_t i = 0; i < LED_STREAM_LED_COUNT; i++) {
+            frame[i] = colors[((i + step) / 9) % 6];
+        }
+        return frame;
+    }
+
+    frame_t noise(uint32_t seed) {
+        frame_t frame(LED_STREAM_LED_COUNT);
+        for (auto &led : frame) {
+            seed = seed * 1103515245 + 12345;
+            led  = {(uint8_t)(seed >> 24), (uint8_t)(seed >> 16), (uint8_t)(seed >> 8)};
+        }
+        return frame;
+    }
+};
+
+TEST_F(LedStreamTest, InfoReportsLayout) {
+    Host     host;
+    packet_t packet = {CMD_STREAM, LED_STREAM_OP_INFO};
+    host.send(packet);
+    packet_t reply = host.receive();
+    EXPECT_EQ(reply[0], CMD_STREAM);
+    EXPECT_EQ(reply[1], LED_STREAM_OK);
+    EXPECT_EQ((reply[2] << 8) | reply[3], LED_STREAM_LED_COUNT);
+    EXPECT_EQ(reply[4], LED_STREAM_PALETTE_SIZE);
+    EXPECT_EQ(reply[5], LED_STREAM_VERSION);
+}
+
+TEST_F(LedStreamTest, FrameIsHiddenUntilCommitted) {
+    Host host;
+    host.send_frame(solid({10, 20, 30}));
+    EXPECT_EQ(device_frame(), solid({0, 0, 0}));
+    EXPECT_TRUE(replies.empty());
+
+    EXPECT_EQ(host.commit(true), LED_STREAM_OK);
+    EXPECT_EQ(device_frame(), solid({10, 20, 30}));
+    EXPECT_EQ(led_stream_frame_count(), 1);
+}
+
+TEST_F(LedStreamTest, PaletteFramesMatch) {
+    Host host;
+    for (uint16_t step = 0; step < 40; step++) {
+        frame_t frame = bands(step);
+        host.send_frame(frame);
+        host.commit(false);
+        ASSERT_EQ(device_frame(), frame) << "step " << step;
+    }
+    EXPECT_TRUE(replies.empty());
+}
+
+TEST_F(LedStreamTest, DeltaOnlyCarriesChanges) {
+    Host    host;
+    frame_t frame = bands(0);
+    host.send_frame(frame);
+    host.commit(false);
+
+    frame[3]  = {1, 2, 3};
+    frame[50] = {1, 2, 3};
+    frame[51] = {4, 5, 6};
+    uint32_t before = host.reports_out;
+    host.send_frame(frame);
+    EXPECT_EQ(host.commit(true), LED_STREAM_OK);
+    EXPECT_EQ(device_frame(), frame);
+    // one palette packet, one runs packet and the commit
+    EXPECT_EQ(host.reports_out - before, 3u);
+}
+
+TEST_F(LedStreamTest, RawFramesWhenColorsDontFitPalette) {
+    Host host;
+    for (uint32_t seed = 1; seed < 10; seed++) {
+        frame_t frame = noise(seed);
+        host.send_frame(frame);
+        EXPECT_EQ(host.commit(true), LED_STREAM_OK);
+        ASSERT_EQ(device_frame(), frame) << "seed " << seed;
+    }
+}
+
+TEST_F(LedStreamTest, ErrorsAreReportedOnCommit) {
+    Host     host;
+    packet_t runs = {CMD_STREAM, LED_STREAM_OP_RUNS, 0, LED_STREAM_LED_COUNT - 2, 1, 4, 0};
+    host.send(runs);
+    packet_t unknown = {CMD_STREAM, 0x7F};
+    host.send(unknown);
+    EXPECT_TRUE(replies.empty());
+    EXPECT_EQ(host.commit(true), LED_STREAM_ERROR_RANGE);
+    EXPECT_EQ(device_frame(), solid({0, 0, 0}));
+
+    packet_t palette = {CMD_STREAM, LED_STREAM_OP_PALETTE, LED_STREAM_PALETTE_SIZE - 1, 2};
+    host.send(palette);
+    EXPECT_EQ(host.commit(true), LED_STREAM_ERROR_RANGE);
+
+    runs = {CMD_STREAM, LED_STREAM_OP_RUNS, 0, 0, 1, 4, LED_STREAM_PALETTE_SIZE};
+    host.send(runs);
+    EXPECT_EQ(host.commit(true), LED_STREAM_ERROR_PALETTE);
+
+    packet_t raw = {CMD_STREAM, LED_STREAM_OP_RAW, 0, 0, LED_STREAM_RAW_MAX + 1};
+    host.send(raw);
+    EXPECT_EQ(host.commit(true), LED_STREAM_ERROR_LENGTH);
+
+    EXPECT_EQ(host.commit(true), LED_STREAM_OK);
+}
+
+TEST_F(LedStreamTest, Throughput) {
+    const uint16_t frames = 600;
+    Host           host;
+
+    for (uint16_t step = 0; step < frames; step++) {
+        host.send_frame(bands(step / 2));
+        host.commit(false);
+    }
+    double per_frame = (double)host.reports_out / frames;
+    double raw_frame = (LED_STREAM_LED_COUNT + LED_STREAM_RAW_MAX - 1) / LED_STREAM_RAW_MAX + 1;
+
+    // Full speed interrupt endpoints move one report per 1 ms frame
+    EXPECT_GE(1000 / per_frame, 60);
+    EXPECT_LT(per_frame, raw_frame);
+}
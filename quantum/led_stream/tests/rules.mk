@@ -0,0 +1,7 @@
+led_stream_DEFS := -DNO_PRINT -DLED_STREAM_LED_COUNT=104
+
+led_stream_SRC := \
+	$(QUANTUM_PATH)/led_stream/tests/led_stream_tests.cpp \
+	$(QUANTUM_PATH)/led_stream/led_stream.c
+
+led_stream_INC := $(QUANTUM_PATH)/led_stream
@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#include "wait.h"
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -51,6 +52,30 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define MATRIX_INPUT_PRESSED_STATE 0
 #endif
 
+#ifdef MATRIX_IO_DELAY_CALIBRATE
+#    ifndef MATRIX_IO_DELAY
+#        define MATRIX_IO_DELAY 30
+#    endif
+#    ifndef MATRIX_IO_DELAY_CALIBRATE_SAMPLES
+#        define MATRIX_IO_DELAY_CALIBRATE_SAMPLES 8
+#    endif
+#    ifndef MATRIX_IO_DELAY_MARGIN
+#        define MATRIX_IO_DELAY_MARGIN 1
+#    endif
+#endif
+
+// Read the col pins a whole GPIO port at a time where the platform allows it
+#if defined(gpio_read_port) && !defined(MATRIX_READ_PINS_INDIVIDUALLY) && !defined(DIRECT_PINS) && defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS) && defined(DIODE_DIRECTION) && (DIODE_DIRECTION == COL2ROW)
+#    define MATRIX_READ_PORTS
+#endif
+
+#ifdef MATRIX_DMA_ENABLE
+#    ifndef MATRIX_READ_PORTS
+#        error "MATRIX_DMA_ENABLE requires a COL2ROW matrix with MATRIX_ROW_PINS and MATRIX_COL_PINS, read a port at a time"
+#    endif
+#    include "matrix_dma.h"
+#endif
+
 #ifdef DIRECT_PINS
 static SPLIT_MUTABLE pin_t direct_pins[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
@@ -104,6 +129,94 @@ static inline uint8_t readMatrixPin(pin_t pin) {
     }
 }
 
+#ifdef MATRIX_READ_PORTS
+// Consecutive columns wired to consecutive bits of one port, copied into the row with one shift and mask
+typedef struct {
+    uint8_t      port;  // index into col_ports
+    uint8_t      shift; // port bit of the first column
+    uint8_t      col;   // first column
+    matrix_row_t mask;  // one bit per column, from bit 0
+} col_run_t;
+
+static gpio_port_t col_ports[MATRIX_COLS];
+static uint8_t     col_port_count;
+static col_run_t   col_runs[MATRIX_COLS];
+static uint8_t     col_run_count;
+
+static void init_col_runs(void) {
+    col_port_count = 0;
+    col_run_count  = 0;
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        pin_t pin = col_pins[col];
+        if (pin == NO_PIN) {
+            continue;
+        }
+
+        gpio_port_t port  = gpio_pin_port(pin);
+        uint8_t     index = 0;
+        while (index < col_port_count && col_ports[index] != port) {
+            index++;
+        }
+        if (index == col_port_count) {
+            col_ports[col_port_count++] = port;
+        }
+
+        uint8_t bit = gpio_pin_port_bit(pin);
+        if (col_run_count > 0) {
+            col_run_t *run    = &col_runs[col_run_count - 1];
+            uint8_t    length = bitpop32(run->mask);
+            if (run->port == index && run->col + length == col && run->shift + length == bit) {
+                run->mask = (run->mask << 1) | 1;
+                continue;
+            }
+        }
+        col_runs[col_run_count++] = (col_run_t){.port = index, .shift = bit, .col = col, .mask = 1};
+    }
+}
+
+static matrix_row_t decode_cols(const gpio_port_value_t values[]) {
+    matrix_row_t row_value = 0;
+    for (uint8_t i = 0; i < col_run_count; i++) {
+        const col_run_t  *run   = &col_runs[i];
+        gpio_port_value_t value = values[run->port];
+#    if MATRIX_INPUT_PRESSED_STATE == 0
+        value = ~value;
+#    endif
+        row_value |= ((matrix_row_t)(value >> run->shift) & run->mask) << run->col;
+    }
+    return row_value;
+}
+
+static matrix_row_t read_cols(void) {
+    gpio_port_value_t values[MATRIX_COLS];
+    for (uint8_t i = 0; i < col_port_count; i++) {
+        values[i] = gpio_read_port(col_ports[i]);
+    }
+    return decode_cols(values);
+}
+#endif // MATRIX_READ_PORTS
+
+#ifdef MATRIX_DMA_ENABLE
+static bool matrix_dma_running;
+
+static void matrix_dma_init(void) {
+    // The hardware samples a single column port
+    matrix_dma_running = col_port_count == 1 && matrix_dma_start(row_pins, ROWS_PER_HAND, col_ports[0]);
+}
+
+// Decode the last scan completed by the hardware, or keep the previous one until there is a new one
+static void matrix_dma_read_cols(matrix_row_t current_matrix[]) {
+    gpio_port_value_t samples[ROWS_PER_HAND];
+    if (!matrix_dma_read(samples)) {
+        memcpy(current_matrix, raw_matrix, sizeof(matrix_row_t) * ROWS_PER_HAND);
+        return;
+    }
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        current_matrix[row] = decode_cols(&samples[row]);
+    }
+}
+#endif // MATRIX_DMA_ENABLE
+
 // matrix code
 
 #ifdef DIRECT_PINS
@@ -181,6 +294,9 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_READ_PORTS
+    current_row_value = read_cols();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -189,6 +305,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
@@ -265,6 +382,84 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #        else
 #            error DIODE_DIRECTION must be one of COL2ROW or ROW2COL!
 #        endif
+
+#        ifdef MATRIX_IO_DELAY_CALIBRATE
+static bool inputs_released(const pin_t inputs[], uint8_t input_count) {
+    for (uint8_t i = 0; i < input_count; i++) {
+        if (inputs[i] != NO_PIN && gpio_read_pin(inputs[i]) == MATRIX_INPUT_PRESSED_STATE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Drive the inputs to their pressed level through the selected line, then time how long they take to read released again once both are let go
+static uint16_t measure_line_settle(uint8_t line) {
+#            if (DIODE_DIRECTION == COL2ROW)
+    const pin_t  *inputs      = col_pins;
+    const uint8_t input_count = MATRIX_COLS;
+    if (!select_row(line)) {
+        return 0; // skip NO_PIN row
+    }
+#            else
+    const pin_t  *inputs      = row_pins;
+    const uint8_t input_count = ROWS_PER_HAND;
+    if (!select_col(line)) {
+        return 0; // skip NO_PIN col
+    }
+#            endif
+    for (uint8_t i = 0; i < input_count; i++) {
+        if (inputs[i] != NO_PIN) {
+#            if MATRIX_INPUT_PRESSED_STATE == 0
+            gpio_atomic_set_pin_output_low(inputs[i]);
+#            else
+            gpio_atomic_set_pin_output_high(inputs[i]);
+#            endif
+        }
+    }
+    wait_us(1);
+
+    ATOMIC_BLOCK_FORCEON {
+#            if (DIODE_DIRECTION == COL2ROW)
+        unselect_row(line);
+#            else
+        unselect_col(line);
+#            endif
+        for (uint8_t i = 0; i < input_count; i++) {
+            if (inputs[i] != NO_PIN) {
+                gpio_set_pin_input_high(inputs[i]);
+            }
+        }
+    }
+
+    uint16_t us = 0;
+    while (!inputs_released(inputs, input_count) && us < MATRIX_IO_DELAY) {
+        wait_us(1);
+        us++;
+    }
+    return us;
+}
+
+static void matrix_io_delay_calibrate(void) {
+#            if (DIODE_DIRECTION == COL2ROW)
+    const uint8_t line_count = ROWS_PER_HAND;
+#            else
+    const uint8_t line_count = MATRIX_COLS;
+#            endif
+    for (uint8_t line = 0; line < line_count; line++) {
+        uint16_t settle = 0;
+        for (uint8_t sample = 0; sample < MATRIX_IO_DELAY_CALIBRATE_SAMPLES; sample++) {
+            settle = MAX(settle, measure_line_settle(line));
+        }
+        // A line which did not settle in time, such as one with a key held down, keeps the fixed delay
+        if (settle < MATRIX_IO_DELAY) {
+            settle = MIN(settle * 2 + MATRIX_IO_DELAY_MARGIN, MATRIX_IO_DELAY);
+        }
+        matrix_io_delay_set(line, settle);
+    }
+    matrix_io_delay_print();
+}
+#        endif // MATRIX_IO_DELAY_CALIBRATE
 #    endif // defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #else
 #    error DIODE_DIRECTION is not defined!
@@ -302,6 +497,15 @@ void matrix_init(void) {
 
     // initialize key pins
     matrix_init_pins();
+#if defined(MATRIX_IO_DELAY_CALIBRATE) && !defined(DIRECT_PINS) && defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+    matrix_io_delay_calibrate();
+#endif
+#ifdef MATRIX_READ_PORTS
+    init_col_runs();
+#endif
+#ifdef MATRIX_DMA_ENABLE
+    matrix_dma_init();
+#endif
 
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
@@ -312,6 +516,22 @@ void matrix_init(void) {
     matrix_init_kb();
 }
 
+#ifdef MATRIX_DMA_ENABLE
+void matrix_dma_suspend(void) {
+    if (matrix_dma_running) {
+        matrix_dma_stop();
+        matrix_dma_running = false;
+        matrix_init_pins();
+    }
+}
+
+void matrix_dma_resume(void) {
+    if (!matrix_dma_running) {
+        matrix_dma_init();
+    }
+}
+#endif
+
 #ifdef SPLIT_KEYBOARD
 // Fallback implementation for keyboards not using the standard split_util.c
 __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -323,7 +543,15 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
-#if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
+#if defined(MATRIX_DMA_ENABLE)
+    if (matrix_dma_running) {
+        matrix_dma_read_cols(curr_matrix);
+    } else {
+        for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
+            matrix_read_cols_on_row(curr_matrix, current_row);
+        }
+    }
+#elif defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
         matrix_read_cols_on_row(curr_matrix, current_row);
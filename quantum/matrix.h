@@ -64,10 +64,21 @@ void matrix_output_select_delay(void);
 void matrix_output_unselect_delay(uint8_t line, bool key_pressed);
 /* only for backwards compatibility. delay between changing matrix pin state and reading values */
 void matrix_io_delay(void);
+#ifdef MATRIX_IO_DELAY_CALIBRATE
+/* settle time of each line measured at init, used by matrix_output_unselect_delay() */
+void     matrix_io_delay_set(uint8_t line, uint16_t us);
+uint16_t matrix_io_delay_get(uint8_t line);
+void     matrix_io_delay_print(void);
+#endif
 
 /* power control */
 void matrix_power_up(void);
 void matrix_power_down(void);
+#ifdef MATRIX_DMA_ENABLE
+/* stop the hardware scan while suspended, scanning in software until it is resumed */
+void matrix_dma_suspend(void);
+void matrix_dma_resume(void);
+#endif
 
 void matrix_init_kb(void);
 void matrix_scan_kb(void);
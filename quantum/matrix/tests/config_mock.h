@@ -0,0 +1,25 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 3
+#define MATRIX_COLS 10
+
+/* Here, "pins" are port << 4 | bit, with 16 bits per port. */
+#define DIODE_DIRECTION COL2ROW
+#define MATRIX_ROW_PINS \
+    { 0x30, NO_PIN, 0x31 }
+// Runs of consecutive bits, a reversed pair, a gap and the top bit of a port
+#define MATRIX_COL_PINS \
+    { 0x00, 0x01, 0x02, 0x05, 0x06, 0x13, 0x12, NO_PIN, 0x14, 0x0F }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock_gpio.h"
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,92 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+class Matrix : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reset();
+        matrix_init();
+    }
+
+    // What reading each col pin on its own reports for the keys held down
+    matrix_row_t expected_row(uint8_t row) {
+        matrix_row_t value = 0;
+        if (row_pins[row] == NO_PIN) {
+            return 0;
+        }
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (col_pins[col] != NO_PIN && mock_keys[row][col]) {
+                value |= (matrix_row_t)1 << col;
+            }
+        }
+        return value;
+    }
+};
+
+TEST_F(Matrix, NothingPressed) {
+    matrix_scan();
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(matrix_get_row(row), 0) << "row " << (int)row;
+    }
+}
+
+TEST_F(Matrix, ScanMatchesPerPinReads) {
+    uint32_t seed = 1;
+    for (uint16_t scan = 0; scan < 500; scan++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                seed                = seed * 1103515245 + 12345;
+                mock_keys[row][col] = (seed >> 16) % 3 == 0;
+            }
+        }
+        matrix_scan();
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            ASSERT_EQ(matrix_get_row(row), expected_row(row)) << "scan " << scan << " row " << (int)row;
+        }
+    }
+}
+
+TEST_F(Matrix, EveryKeyOnItsOwn) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            mock_keys[row][col] = true;
+            matrix_scan();
+            for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+                ASSERT_EQ(matrix_get_row(r), expected_row(r)) << "key " << (int)row << "," << (int)col;
+            }
+            mock_keys[row][col] = false;
+        }
+    }
+}
+
+TEST_F(Matrix, ReadsEachPortOncePerRow) {
+    mock_pin_reads  = 0;
+    mock_port_reads = 0;
+    matrix_scan();
+#ifdef MATRIX_READ_PINS_INDIVIDUALLY
+    EXPECT_EQ(mock_port_reads, 0);
+    EXPECT_GT(mock_pin_reads, 0);
+#else
+    // Two rows with a pin, col pins on two ports
+    EXPECT_EQ(mock_port_reads, 2 * 2);
+    EXPECT_EQ(mock_pin_reads, 0);
+#endif
+}
+
+#ifdef MATRIX_IO_DELAY_CALIBRATE
+TEST_F(Matrix, CalibratedLinesSettle) {
+    // The mock inputs read released as soon as they are let go, so no line needs the full delay
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_LT(matrix_io_delay_get(row), MATRIX_IO_DELAY) << "row " << (int)row;
+    }
+}
+#endif
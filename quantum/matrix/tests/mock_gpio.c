@@ -0,0 +1,80 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gpio.h"
+
+#ifndef MATRIX_INPUT_PRESSED_STATE
+#    define MATRIX_INPUT_PRESSED_STATE 0
+#endif
+
+#define MOCK_PIN_COUNT (MOCK_PORT_COUNT * 16)
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+bool     mock_keys[MATRIX_ROWS][MATRIX_COLS];
+uint32_t mock_pin_reads;
+uint32_t mock_port_reads;
+
+static bool pin_is_output[MOCK_PIN_COUNT];
+static bool pin_level[MOCK_PIN_COUNT];
+
+void mock_set_pin_input_high(pin_t pin) {
+    pin_is_output[pin] = false;
+    pin_level[pin]     = true;
+}
+
+void mock_set_pin_output(pin_t pin) {
+    pin_is_output[pin] = true;
+}
+
+void mock_write_pin(pin_t pin, bool level) {
+    pin_level[pin] = level;
+}
+
+static bool level_of(pin_t pin) {
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != pin) {
+            continue;
+        }
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            pin_t row_pin = row_pins[row];
+            if (row_pin != NO_PIN && pin_is_output[row_pin] && !pin_level[row_pin] && mock_keys[row][col]) {
+                return MATRIX_INPUT_PRESSED_STATE;
+            }
+        }
+        return !MATRIX_INPUT_PRESSED_STATE;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (row_pins[row] == pin) {
+            return pin_level[pin];
+        }
+    }
+    // Pins which are not part of the matrix change on every read, so stray bits show up in the scan
+    return (mock_port_reads + mock_pin_reads + pin) & 1;
+}
+
+bool mock_read_pin(pin_t pin) {
+    mock_pin_reads++;
+    return level_of(pin);
+}
+
+gpio_port_value_t mock_read_port(gpio_port_t port) {
+    gpio_port_value_t value = 0;
+    for (uint8_t bit = 0; bit < 16; bit++) {
+        if (level_of((port << 4) | bit)) {
+            value |= (gpio_port_value_t)1 << bit;
+        }
+    }
+    mock_port_reads++;
+    return value;
+}
+
+void mock_reset(void) {
+    memset(mock_keys, 0, sizeof(mock_keys));
+    memset(pin_is_output, 0, sizeof(pin_is_output));
+    memset(pin_level, 0, sizeof(pin_level));
+    mock_pin_reads  = 0;
+    mock_port_reads = 0;
+}
@@ -0,0 +1,36 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t  pin_t;
+typedef uint8_t  gpio_port_t;
+typedef uint16_t gpio_port_value_t;
+
+#define MOCK_PORT_COUNT 4
+
+#define gpio_set_pin_input_high(pin) mock_set_pin_input_high(pin)
+#define gpio_set_pin_output(pin) mock_set_pin_output(pin)
+#define gpio_write_pin_low(pin) mock_write_pin(pin, false)
+#define gpio_write_pin_high(pin) mock_write_pin(pin, true)
+#define gpio_read_pin(pin) mock_read_pin(pin)
+
+#define gpio_pin_port(pin) ((pin) >> 4)
+#define gpio_pin_port_bit(pin) ((pin)&0xF)
+#define gpio_read_port(port) mock_read_port(port)
+
+// Keys held down, a held key connects its row pin to its col pin
+extern bool mock_keys[][MATRIX_COLS];
+
+extern uint32_t mock_pin_reads;
+extern uint32_t mock_port_reads;
+
+void              mock_set_pin_input_high(pin_t pin);
+void              mock_set_pin_output(pin_t pin);
+void              mock_write_pin(pin_t pin, bool level);
+bool              mock_read_pin(pin_t pin);
+gpio_port_value_t mock_read_port(gpio_port_t port);
+void              mock_reset(void);
@@ -0,0 +1,29 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+MATRIX_COMMON_DEFS := -DNO_PRINT -DIGNORE_ATOMIC_BLOCK
+
+MATRIX_COMMON_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/matrix/tests/mock_gpio.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_tests.cpp \
+	$(QUANTUM_PATH)/bitwise.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix_common.c \
+	$(QUANTUM_PATH)/matrix.c
+
+matrix_read_pins_DEFS := $(MATRIX_COMMON_DEFS) -DMATRIX_READ_PINS_INDIVIDUALLY
+matrix_read_pins_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+matrix_read_pins_SRC := $(MATRIX_COMMON_SRC)
+
+matrix_read_ports_DEFS := $(MATRIX_COMMON_DEFS)
+matrix_read_ports_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+matrix_read_ports_SRC := $(MATRIX_COMMON_SRC)
+
+matrix_read_ports_pressed_high_DEFS := $(MATRIX_COMMON_DEFS) -DMATRIX_INPUT_PRESSED_STATE=1
+matrix_read_ports_pressed_high_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+matrix_read_ports_pressed_high_SRC := $(MATRIX_COMMON_SRC)
+
+matrix_io_delay_calibrate_pressed_high_DEFS := $(MATRIX_COMMON_DEFS) -DMATRIX_IO_DELAY_CALIBRATE -DMATRIX_IO_DELAY=30 -DMATRIX_INPUT_PRESSED_STATE=1
+matrix_io_delay_calibrate_pressed_high_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+matrix_io_delay_calibrate_pressed_high_SRC := $(MATRIX_COMMON_SRC)
@@ -0,0 +1,5 @@
+TEST_LIST += \
+	matrix_io_delay_calibrate_pressed_high \
+	matrix_read_pins \
+	matrix_read_ports \
+	matrix_read_ports_pressed_high \
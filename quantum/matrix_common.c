@@ -1,3 +1,4 @@
+#include "util.h"
 #include "matrix.h"
 #include "debounce.h"
 #include "wait.h"
@@ -129,9 +130,46 @@ __attribute__((weak)) void matrix_io_delay(void) {
 __attribute__((weak)) void matrix_output_select_delay(void) {
     waitInputPinDelay();
 }
+
+#ifdef MATRIX_IO_DELAY_CALIBRATE
+#    define MATRIX_IO_DELAY_LINES MAX(ROWS_PER_HAND, MATRIX_COLS)
+
+// Settle time of each line, the fixed delay until the matrix measures them
+static uint16_t matrix_io_delay_line[MATRIX_IO_DELAY_LINES] = {[0 ... MATRIX_IO_DELAY_LINES - 1] = MATRIX_IO_DELAY};
+static uint8_t  matrix_io_delay_line_count;
+
+void matrix_io_delay_set(uint8_t line, uint16_t us) {
+    if (line < MATRIX_IO_DELAY_LINES) {
+        matrix_io_delay_line[line] = us;
+        matrix_io_delay_line_count = MAX(matrix_io_delay_line_count, line + 1);
+    }
+}
+
+uint16_t matrix_io_delay_get(uint8_t line) {
+    return line < MATRIX_IO_DELAY_LINES ? matrix_io_delay_line[line] : MATRIX_IO_DELAY;
+}
+
+void matrix_io_delay_print(void) {
+    uint16_t total = 0;
+    dprint("matrix settle (us):");
+    for (uint8_t line = 0; line < matrix_io_delay_line_count; line++) {
+        dprintf(" %u", matrix_io_delay_line[line]);
+        total += matrix_io_delay_line[line];
+    }
+    dprintf(", %u us per scan with every line pressed, %u us fixed\n", total, matrix_io_delay_line_count * MATRIX_IO_DELAY);
+}
+
+// Only a line with a key down has pulled an input low which then has to recover
+__attribute__((weak)) void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {
+    if (key_pressed) {
+        wait_us(matrix_io_delay_get(line));
+    }
+}
+#else
 __attribute__((weak)) void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {
     matrix_io_delay();
 }
+#endif
 
 // CUSTOM MATRIX 'LITE'
 __attribute__((weak)) void matrix_init_custom(void) {}
@@ -0,0 +1,239 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "output_queue.h"
+#include "action.h"
+#include "timer.h"
+#include "wait.h"
+
+typedef enum {
+    OUTPUT_QUEUE_REGISTER,
+    OUTPUT_QUEUE_UNREGISTER,
+    OUTPUT_QUEUE_WAIT,
+    OUTPUT_QUEUE_STEP,
+} output_queue_type_t;
+
+typedef struct {
+    uint8_t             type;
+    uint8_t             keycode;
+    uint16_t            delay;
+    output_queue_step_t step;
+} output_queue_entry_t;
+
+static output_queue_entry_t queue[OUTPUT_QUEUE_SIZE];
+static uint8_t              queue_head  = 0;
+static uint8_t              queue_count = 0;
+
+// Delay still owed after the last executed entry, counted from wait_timer
+static uint16_t wait_timer = 0;
+static uint16_t wait_delay = 0;
+
+// Set while a step function runs, so anything it sends goes out inline rather than behind itself
+static bool running = false;
+
+static keyevent_t held[OUTPUT_QUEUE_HOLD_SIZE];
+static uint8_t    held_head  = 0;
+static uint8_t    held_count = 0;
+
+/**
+ * @brief Executes the entry at the head of the queue, popping it unless it is a step with more to do
+ *
+ * @param[out] yield set when the caller should return to the main loop before the next entry
+ * @return delay in milliseconds before the next entry
+ */
+static uint16_t output_queue_run_head(bool *yield) {
+    output_queue_entry_t *entry = &queue[queue_head];
+    uint16_t              delay = entry->delay;
+
+    switch (entry->type) {
+        case OUTPUT_QUEUE_REGISTER:
+            register_code(entry->keycode);
+            break;
+        case OUTPUT_QUEUE_UNREGISTER:
+            unregister_code(entry->keycode);
+            break;
+        case OUTPUT_QUEUE_STEP:
+            running = true;
+            delay   = entry->step();
+            running = false;
+            *yield  = true;
+            if (delay != OUTPUT_QUEUE_STEP_DONE) {
+                return delay;
+            }
+            delay = 0;
+            break;
+    }
+
+    queue_head = (queue_head + 1) % OUTPUT_QUEUE_SIZE;
+    queue_count--;
+    return delay;
+}
+
+static void output_queue_start_wait(uint16_t delay) {
+    wait_timer = timer_read();
+    wait_delay = delay;
+}
+
+static void output_queue_finish_wait(void) {
+    if (wait_delay) {
+        uint16_t elapsed = timer_elapsed(wait_timer);
+        if (elapsed < wait_delay) {
+            wait_ms(wait_delay - elapsed);
+        }
+        wait_delay = 0;
+    }
+}
+
+/**
+ * @brief Blocks until no more than `count` entries are left
+ */
+static void output_queue_drain(uint8_t count) {
+    while (queue_count > count) {
+        output_queue_finish_wait();
+        bool     yield = false;
+        uint16_t delay = output_queue_run_head(&yield);
+        if (delay) {
+            output_queue_start_wait(delay);
+        }
+    }
+}
+
+static void output_queue_push(output_queue_entry_t entry) {
+    if (queue_count == OUTPUT_QUEUE_SIZE) {
+        if (running) {
+            // The step at the head cannot be drained from inside itself, so send this one inline
+            switch (entry.type) {
+                case OUTPUT_QUEUE_REGISTER:
+                    register_code(entry.keycode);
+                    break;
+                case OUTPUT_QUEUE_UNREGISTER:
+                    unregister_code(entry.keycode);
+                    break;
+                case OUTPUT_QUEUE_STEP:
+                    for (uint16_t delay = entry.step(); delay != OUTPUT_QUEUE_STEP_DONE; delay = entry.step()) {
+                        wait_ms(delay);
+                    }
+                    return;
+            }
+            wait_ms(entry.delay);
+            return;
+        }
+        output_queue_drain(OUTPUT_QUEUE_SIZE - 1);
+    }
+    queue[(queue_head + queue_count) % OUTPUT_QUEUE_SIZE] = entry;
+    queue_count++;
+}
+
+/**
+ * @brief Queues pressing a basic keycode, then waiting `delay` milliseconds
+ */
+void output_queue_register_code(uint8_t keycode, uint16_t delay) {
+    output_queue_push((output_queue_entry_t){.type = OUTPUT_QUEUE_REGISTER, .keycode = keycode, .delay = delay});
+}
+
+/**
+ * @brief Queues releasing a basic keycode, then waiting `delay` milliseconds
+ */
+void output_queue_unregister_code(uint8_t keycode, uint16_t delay) {
+    output_queue_push((output_queue_entry_t){.type = OUTPUT_QUEUE_UNREGISTER, .keycode = keycode, .delay = delay});
+}
+
+/**
+ * @brief Queues a tap held for `delay` milliseconds, like tap_code_delay()
+ */
+void output_queue_tap_code(uint8_t keycode, uint16_t delay) {
+    output_queue_register_code(keycode, delay);
+    output_queue_unregister_code(keycode, 0);
+}
+
+void output_queue_wait(uint16_t delay) {
+    if (delay) {
+        output_queue_push((output_queue_entry_t){.type = OUTPUT_QUEUE_WAIT, .delay = delay});
+    }
+}
+
+/**
+ * @brief Queues a step function, for output that is produced as it plays such as dynamic macros
+ *
+ * The step is called once per keyboard_task() pass while at the head of the queue.
+ */
+void output_queue_step(output_queue_step_t step) {
+    output_queue_push((output_queue_entry_t){.type = OUTPUT_QUEUE_STEP, .step = step});
+}
+
+/**
+ * @brief Whether output is still queued or key events are waiting to be replayed
+ */
+bool output_queue_is_busy(void) {
+    return queue_count > 0 || held_count > 0;
+}
+
+/**
+ * @brief Whether the caller is running inside a queued step function
+ */
+bool output_queue_is_running(void) {
+    return running;
+}
+
+/**
+ * @brief Blocks until everything queued so far has been sent, including the trailing delay
+ *
+ * Does nothing when called from inside a step, which is itself part of the queue.
+ */
+void output_queue_flush(void) {
+    if (running) {
+        return;
+    }
+    output_queue_drain(0);
+    output_queue_finish_wait();
+}
+
+static void output_queue_release_held(void) {
+    while (held_count > 0 && queue_count == 0) {
+        keyevent_t event = held[held_head];
+        held_head        = (held_head + 1) % OUTPUT_QUEUE_HOLD_SIZE;
+        held_count--;
+        action_exec(event);
+    }
+}
+
+/**
+ * @brief Holds a matrix key event back while output is queued
+ *
+ * @return true if the event was held and must not be executed by the caller
+ */
+bool output_queue_hold_event(keyevent_t event) {
+    while (held_count == OUTPUT_QUEUE_HOLD_SIZE) {
+        output_queue_flush();
+        output_queue_release_held();
+    }
+    if (!output_queue_is_busy()) {
+        return false;
+    }
+    held[(held_head + held_count) % OUTPUT_QUEUE_HOLD_SIZE] = event;
+    held_count++;
+    return true;
+}
+
+void output_queue_task(void) {
+    if (running) {
+        return;
+    }
+    while (queue_count > 0) {
+        if (wait_delay) {
+            if (timer_elapsed(wait_timer) < wait_delay) {
+                return;
+            }
+            wait_delay = 0;
+        }
+        bool     yield = false;
+        uint16_t delay = output_queue_run_head(&yield);
+        if (delay) {
+            output_queue_start_wait(delay);
+        }
+        if (yield) {
+            return;
+        }
+    }
+    output_queue_release_held();
+}
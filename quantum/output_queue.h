@@ -0,0 +1,57 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/**
+ * @file output_queue.h
+ * @brief Timed queue of key output, drained from keyboard_task().
+ *
+ * send_string and dynamic macro playback used to wait inline between taps,
+ * which froze matrix scanning, lighting and split sync for the whole
+ * sequence. With the queue enabled they push register, unregister and wait
+ * entries instead, and output_queue_task() executes them as their delays
+ * expire.
+ *
+ * While the queue is busy, matrix key events are held back and replayed in
+ * order once it drains, so keys typed during playback are neither lost nor
+ * mixed into the middle of it.
+ *
+ * The blocking APIs remain: they push their entries and call
+ * output_queue_flush().
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+
+#ifndef OUTPUT_QUEUE_SIZE
+#    define OUTPUT_QUEUE_SIZE 16
+#endif
+
+#ifndef OUTPUT_QUEUE_HOLD_SIZE
+#    define OUTPUT_QUEUE_HOLD_SIZE 8
+#endif
+
+// Returned by a step function once it has nothing left to do
+#define OUTPUT_QUEUE_STEP_DONE UINT16_MAX
+
+/**
+ * @brief Called each time it reaches the head of the queue, until it returns OUTPUT_QUEUE_STEP_DONE
+ *
+ * @return delay in milliseconds before the next call
+ */
+typedef uint16_t (*output_queue_step_t)(void);
+
+void output_queue_register_code(uint8_t keycode, uint16_t delay);
+void output_queue_unregister_code(uint8_t keycode, uint16_t delay);
+void output_queue_tap_code(uint8_t keycode, uint16_t delay);
+void output_queue_wait(uint16_t delay);
+void output_queue_step(output_queue_step_t step);
+
+bool output_queue_is_busy(void);
+bool output_queue_is_running(void);
+void output_queue_flush(void);
+
+bool output_queue_hold_event(keyevent_t event);
+void output_queue_task(void);
@@ -79,6 +79,13 @@ uint16_t pointing_device_get_shared_cpi(void) {
 static report_mouse_t local_mouse_report         = {};
 static bool           pointing_device_force_send = false;
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+static pointing_device_accel_state_t local_accel_state = {};
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+static pointing_device_accel_state_t shared_accel_state = {};
+#    endif
+#endif
+
 #define POINTING_DEVICE_DRIVER_CONCAT(name) name##_pointing_device_driver
 #define POINTING_DEVICE_DRIVER(name) POINTING_DEVICE_DRIVER_CONCAT(name)
 
@@ -177,6 +184,10 @@ __attribute__((weak)) void pointing_device_init(void) {
 #endif
     }
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+    pointing_device_accel_init();
+#endif
+
     pointing_device_init_kb();
     pointing_device_init_user();
 }
@@ -294,6 +305,14 @@ __attribute__((weak)) bool pointing_device_task(void) {
     }
 #endif
 
+    // apply acceleration curve to raw sensor movement
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+    local_mouse_report = pointing_device_accel_apply(&local_accel_state, local_mouse_report);
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+    shared_mouse_report = pointing_device_accel_apply(&shared_accel_state, shared_mouse_report);
+#    endif
+#endif
+
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
     if (is_keyboard_left()) {
@@ -0,0 +1,200 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+
+#    include <string.h>
+#    include "pointing_device_accel.h"
+#    include "pointing_device.h"
+
+/* Curve is stored as Q12.4 segment start points plus a precomputed Q8 slope per segment,
+ * so that evaluating it is a single multiply and shift with no division at report time. */
+typedef struct {
+    uint16_t speed[POINTING_DEVICE_ACCEL_CURVE_MAX_POINTS];
+    uint16_t gain[POINTING_DEVICE_ACCEL_CURVE_MAX_POINTS];
+    int32_t  slope[POINTING_DEVICE_ACCEL_CURVE_MAX_POINTS];
+    uint8_t  count;
+    bool     enabled;
+} pointing_device_accel_curve_t;
+
+static pointing_device_accel_curve_t accel_curve = {0};
+
+static const pointing_device_accel_point_t default_curve[] = POINTING_DEVICE_ACCEL_CURVE;
+
+_Static_assert(sizeof(default_curve) / sizeof(default_curve[0]) <= POINTING_DEVICE_ACCEL_CURVE_MAX_POINTS, "POINTING_DEVICE_ACCEL_CURVE has more points than POINTING_DEVICE_ACCEL_CURVE_MAX_POINTS");
+
+/**
+ * @brief Loads the default acceleration curve and enables acceleration
+ */
+void pointing_device_accel_init(void) {
+    pointing_device_accel_set_curve(default_curve, sizeof(default_curve) / sizeof(default_curve[0]));
+    accel_curve.enabled = true;
+}
+
+/**
+ * @brief Replaces the active acceleration curve
+ *
+ * Points must be ordered by strictly increasing speed, no higher than POINTING_DEVICE_ACCEL_SPEED_MAX. Below the first point the first gain is
+ * used, above the last point the last gain is used, and gains are linearly interpolated between.
+ *
+ * @param[in] points array of pointing_device_accel_point_t
+ * @param[in] count number of points, 1 to POINTING_DEVICE_ACCEL_CURVE_MAX_POINTS
+ * @return true if the curve was accepted
+ */
+bool pointing_device_accel_set_curve(const pointing_device_accel_point_t *points, uint8_t count) {
+    if (count == 0 || count > POINTING_DEVICE_ACCEL_CURVE_MAX_POINTS) {
+        return false;
+    }
+    if (points[count - 1].speed > POINTING_DEVICE_ACCEL_SPEED_MAX) {
+        return false;
+    }
+    for (uint8_t i = 1; i < count; i++) {
+        if (points[i].speed <= points[i - 1].speed) {
+            return false;
+        }
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        accel_curve.speed[i] = points[i].speed << POINTING_DEVICE_ACCEL_SPEED_SHIFT;
+        accel_curve.gain[i]  = points[i].gain;
+        accel_curve.slope[i] = 0;
+        if (i + 1 < count) {
+            int32_t rise         = (int32_t)points[i + 1].gain - points[i].gain;
+            int32_t run          = (int32_t)(points[i + 1].speed - points[i].speed) << POINTING_DEVICE_ACCEL_SPEED_SHIFT;
+            accel_curve.slope[i] = (rise << POINTING_DEVICE_ACCEL_GAIN_SHIFT) / run;
+        }
+    }
+    accel_curve.count = count;
+    return true;
+}
+
+/**
+ * @brief Enables or disables acceleration, reports pass through unmodified while disabled
+ *
+ * @param[in] enable bool
+ */
+void pointing_device_accel_set_enabled(bool enable) {
+    accel_curve.enabled = enable;
+}
+
+/**
+ * @brief Gets the current acceleration enable state
+ *
+ * @return bool
+ */
+bool pointing_device_accel_get_enabled(void) {
+    return accel_curve.enabled;
+}
+
+/**
+ * @brief Toggles acceleration on and off
+ */
+void pointing_device_accel_toggle(void) {
+    accel_curve.enabled = !accel_curve.enabled;
+}
+
+/**
+ * @brief Evaluates the active curve
+ *
+ * @param[in] speed Q12.4 speed in counts per report
+ * @return uint16_t Q8.8 gain
+ */
+uint16_t pointing_device_accel_get_gain(uint16_t speed) {
+    if (accel_curve.count == 0) {
+        return POINTING_DEVICE_ACCEL_GAIN(1);
+    }
+
+    uint8_t last = accel_curve.count - 1;
+    if (speed <= accel_curve.speed[0]) {
+        return accel_curve.gain[0];
+    }
+    if (speed >= accel_curve.speed[last]) {
+        return accel_curve.gain[last];
+    }
+
+    uint8_t i = 0;
+    while (speed >= accel_curve.speed[i + 1]) {
+        i++;
+    }
+    // speed - speed[i] is bounded by the segment length, so this cannot overflow
+    int32_t offset = ((int32_t)(speed - accel_curve.speed[i]) * accel_curve.slope[i]) >> POINTING_DEVICE_ACCEL_GAIN_SHIFT;
+    return (uint16_t)((int32_t)accel_curve.gain[i] + offset);
+}
+
+/**
+ * @brief Scales one axis, carrying the fractional part into the next report
+ *
+ * @param[in] delta raw axis movement
+ * @param[in] gain Q8.8 gain
+ * @param[in,out] remainder Q8 sub-pixel remainder
+ * @return mouse_xy_report_t scaled and clamped movement
+ */
+static mouse_xy_report_t pointing_device_accel_scale(mouse_xy_report_t delta, uint16_t gain, int16_t *remainder) {
+    // drop the leftover fraction when the axis changes direction
+    if ((delta < 0 && *remainder > 0) || (delta > 0 && *remainder < 0)) {
+        *remainder = 0;
+    }
+
+    int32_t scaled = (int32_t)delta * gain + *remainder;
+    // truncate towards zero so both directions round the same way, the signed remainder keeps the rest
+    int32_t whole = scaled / (1 << POINTING_DEVICE_ACCEL_GAIN_SHIFT);
+
+    if (whole < XY_REPORT_MIN || whole > XY_REPORT_MAX) {
+        *remainder = 0;
+        return CONSTRAIN_HID_XY(whole);
+    }
+    *remainder = (int16_t)(scaled - whole * (1 << POINTING_DEVICE_ACCEL_GAIN_SHIFT));
+    return (mouse_xy_report_t)whole;
+}
+
+/**
+ * @brief Applies the acceleration curve to the x and y movement of a report
+ *
+ * Speed is estimated with an alpha max plus beta min approximation of the vector length (max + 3/8 min),
+ * which is within ~7% of the true magnitude and needs no square root. It is then smoothed with an
+ * exponential moving average of weight 1/2^POINTING_DEVICE_ACCEL_SMOOTHING.
+ *
+ * @param[in,out] state per device pointing_device_accel_state_t
+ * @param[in] mouse_report report_mouse_t to be adjusted
+ * @return report_mouse_t with adjusted x and y values
+ */
+report_mouse_t pointing_device_accel_apply(pointing_device_accel_state_t *state, report_mouse_t mouse_report) {
+    if (!accel_curve.enabled) {
+        return mouse_report;
+    }
+
+    uint16_t ax    = mouse_report.x < 0 ? -mouse_report.x : mouse_report.x;
+    uint16_t ay    = mouse_report.y < 0 ? -mouse_report.y : mouse_report.y;
+    uint32_t hi    = ax > ay ? ax : ay;
+    uint32_t lo    = ax > ay ? ay : ax;
+    uint32_t speed = (hi << POINTING_DEVICE_ACCEL_SPEED_SHIFT) + (((lo * 3) << POINTING_DEVICE_ACCEL_SPEED_SHIFT) >> 3);
+    if (speed > UINT16_MAX) {
+        speed = UINT16_MAX;
+    }
+
+#    if POINTING_DEVICE_ACCEL_SMOOTHING > 0
+    state->speed = (uint16_t)((int32_t)state->speed + (((int32_t)speed - state->speed) >> POINTING_DEVICE_ACCEL_SMOOTHING));
+#    else
+    state->speed = speed;
+#    endif
+
+    if (mouse_report.x == 0 && mouse_report.y == 0) {
+        return mouse_report;
+    }
+
+    uint16_t gain  = pointing_device_accel_get_gain(state->speed);
+    mouse_report.x = pointing_device_accel_scale(mouse_report.x, gain, &state->x_remainder);
+    mouse_report.y = pointing_device_accel_scale(mouse_report.y, gain, &state->y_remainder);
+    return mouse_report;
+}
+
+/**
+ * @brief Clears smoothing history and sub-pixel remainders
+ *
+ * @param[in,out] state per device pointing_device_accel_state_t
+ */
+void pointing_device_accel_reset(pointing_device_accel_state_t *state) {
+    memset(state, 0, sizeof(pointing_device_accel_state_t));
+}
+
+#endif // POINTING_DEVICE_ACCEL_ENABLE
@@ -0,0 +1,65 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+#ifndef POINTING_DEVICE_ACCEL_ENABLE
+#    error "POINTING_DEVICE_ACCEL_ENABLE not defined! check config settings"
+#endif
+
+/* Gains are unsigned Q8.8 fixed point, 256 == 1.0x */
+#define POINTING_DEVICE_ACCEL_GAIN_SHIFT 8
+#define POINTING_DEVICE_ACCEL_GAIN(x) ((uint16_t)((x) * (1 << POINTING_DEVICE_ACCEL_GAIN_SHIFT)))
+
+/* Speeds are tracked internally as Q12.4 counts per report */
+#define POINTING_DEVICE_ACCEL_SPEED_SHIFT 4
+#define POINTING_DEVICE_ACCEL_SPEED_MAX (UINT16_MAX >> POINTING_DEVICE_ACCEL_SPEED_SHIFT)
+
+#ifndef POINTING_DEVICE_ACCEL_CURVE_MAX_POINTS
+#    define POINTING_DEVICE_ACCEL_CURVE_MAX_POINTS 8
+#endif
+#ifndef POINTING_DEVICE_ACCEL_SMOOTHING
+#    define POINTING_DEVICE_ACCEL_SMOOTHING 2
+#endif
+#ifndef POINTING_DEVICE_ACCEL_CURVE
+// clang-format off
+#    define POINTING_DEVICE_ACCEL_CURVE { \
+        { 0,  POINTING_DEVICE_ACCEL_GAIN(1.0) }, \
+        { 2,  POINTING_DEVICE_ACCEL_GAIN(1.0) }, \
+        { 16, POINTING_DEVICE_ACCEL_GAIN(2.0) }, \
+        { 48, POINTING_DEVICE_ACCEL_GAIN(3.0) }  \
+    }
+// clang-format on
+#endif
+
+#if POINTING_DEVICE_ACCEL_SMOOTHING > 7
+#    error "POINTING_DEVICE_ACCEL_SMOOTHING must be between 0 and 7"
+#endif
+
+/* data structure */
+typedef struct {
+    uint16_t speed; /* Input speed in counts per report */
+    uint16_t gain;  /* Output gain at that speed, Q8.8 */
+} pointing_device_accel_point_t;
+
+typedef struct {
+    uint16_t speed;       /* Smoothed input speed, Q12.4 */
+    int16_t  x_remainder; /* Sub-pixel remainder carried to the next report, Q8 */
+    int16_t  y_remainder;
+} pointing_device_accel_state_t;
+
+/* ----------Setup Functions----------------------------------------------------------------------------- */
+void pointing_device_accel_init(void);
+bool pointing_device_accel_set_curve(const pointing_device_accel_point_t *points, uint8_t count);
+void pointing_device_accel_set_enabled(bool enable);
+bool pointing_device_accel_get_enabled(void);
+void pointing_device_accel_toggle(void);
+
+/* ----------Core Functions------------------------------------------------------------------------------ */
+uint16_t       pointing_device_accel_get_gain(uint16_t speed);
+report_mouse_t pointing_device_accel_apply(pointing_device_accel_state_t *state, report_mouse_t mouse_report);
+void           pointing_device_accel_reset(pointing_device_accel_state_t *state);
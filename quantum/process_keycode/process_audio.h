@@ -6,6 +6,8 @@
 
 float compute_freq_for_midi_note(uint8_t note);
 
+#define PROCESS_AUDIO_KEYCODES QK_AUDIO, QK_AUDIO_MAX
+
 bool process_audio(uint16_t keycode, keyrecord_t *record);
 void process_audio_noteon(uint8_t note);
 void process_audio_noteoff(uint8_t note);
@@ -20,4 +20,6 @@
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_BACKLIGHT_KEYCODES QK_BACKLIGHT_ON, QK_BACKLIGHT_TOGGLE_BREATHING
+
 bool process_backlight(uint16_t keycode, keyrecord_t *record);
@@ -6,4 +6,6 @@
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_CONNECTION_KEYCODES QK_CONNECTION, QK_CONNECTION_MAX
+
 bool process_connection(uint16_t keycode, keyrecord_t *record);
@@ -22,6 +22,8 @@
 
 #if !defined(NO_ACTION_LAYER)
 
+#define PROCESS_DEFAULT_LAYER_KEYCODES QK_PERSISTENT_DEF_LAYER, QK_PERSISTENT_DEF_LAYER_MAX
+
 bool process_default_layer(uint16_t keycode, keyrecord_t *record);
 
 #endif // !defined(NO_ACTION_LAYER)
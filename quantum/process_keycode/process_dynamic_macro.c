@@ -18,10 +18,16 @@
 /* Author: Wojciech Siewierski < wojciech dot siewierski at onet dot pl > */
 #include "process_dynamic_macro.h"
 #include <stddef.h>
+#include <string.h>
 #include "action_layer.h"
 #include "keycodes.h"
 #include "debug.h"
 #include "wait.h"
+#include "timer.h"
+
+#ifdef OUTPUT_QUEUE_ENABLE
+#    include "output_queue.h"
+#endif
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -89,13 +95,148 @@ __attribute__((weak)) bool dynamic_macro_valid_key_user(uint16_t keycode, keyrec
 #define DYNAMIC_MACRO_CURRENT_LENGTH(BEGIN, POINTER) ((int)(direction * ((POINTER) - (BEGIN))))
 #define DYNAMIC_MACRO_CURRENT_CAPACITY(BEGIN, END2) ((int)(direction * ((END2) - (BEGIN)) + 1))
 
+/* Each recorded event is packed into a few bytes instead of a whole
+ * keyrecord_t, usually three:
+ *
+ *   header  [pressed:1][tap follows:1][more delta:1][delta bits 0-4:5]
+ *   delta   the remaining delta bits, 7 per byte with the top bit set
+ *           on all but the last byte, if "more delta" is set
+ *   key     row * MATRIX_COLS + col, or DYNAMIC_MACRO_KEY_LONG followed
+ *           by row, col, event type and keycode (low byte first) for
+ *           combos, encoders and anything else outside the matrix
+ *   tap     the tap_t state, if "tap follows" is set
+ *
+ * The delta is the time in milliseconds since the previous event of the
+ * macro. Bytes are laid out in the direction the macro grows, so macro 2
+ * is read right-to-left just like it is written.
+ */
+#define DYNAMIC_MACRO_PRESSED 0x80
+#define DYNAMIC_MACRO_TAP 0x40
+#define DYNAMIC_MACRO_MORE_DELTA 0x20
+#define DYNAMIC_MACRO_DELTA_MASK 0x1F
+#define DYNAMIC_MACRO_DELTA_BITS 5
+#define DYNAMIC_MACRO_KEY_LONG 0xFF
+#define DYNAMIC_MACRO_MAX_EVENT_SIZE 10
+
+static inline uint8_t dynamic_macro_read(uint8_t **pointer, int8_t direction) {
+    uint8_t value = **pointer;
+    *pointer += direction;
+    return value;
+}
+
+/**
+ * Pack a key event.
+ *
+ * @param[in]  record The event to pack.
+ * @param[in]  delta  Milliseconds since the previous event.
+ * @param[out] data   At least DYNAMIC_MACRO_MAX_EVENT_SIZE bytes.
+ * @return The number of bytes used.
+ */
+static uint8_t dynamic_macro_encode(keyrecord_t *record, uint16_t delta, uint8_t *data) {
+    uint8_t  size    = 1;
+    uint8_t  tap     = 0;
+    uint16_t keycode = 0;
+    uint8_t  row     = record->event.key.row;
+    uint8_t  col     = record->event.key.col;
+
+#ifndef NO_ACTION_TAPPING
+    memcpy(&tap, &record->tap, sizeof(tap));
+#endif
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+    keycode = record->keycode;
+#endif
+
+    data[0] = (record->event.pressed ? DYNAMIC_MACRO_PRESSED : 0) | (tap ? DYNAMIC_MACRO_TAP : 0) | (delta & DYNAMIC_MACRO_DELTA_MASK);
+    delta >>= DYNAMIC_MACRO_DELTA_BITS;
+    if (delta) {
+        data[0] |= DYNAMIC_MACRO_MORE_DELTA;
+        for (; delta > 0x7F; delta >>= 7) {
+            data[size++] = (delta & 0x7F) | 0x80;
+        }
+        data[size++] = delta;
+    }
+
+    if (record->event.type == KEY_EVENT && keycode == 0 && row < MATRIX_ROWS && col < MATRIX_COLS && (uint16_t)row * MATRIX_COLS + col < DYNAMIC_MACRO_KEY_LONG) {
+        data[size++] = row * MATRIX_COLS + col;
+    } else {
+        data[size++] = DYNAMIC_MACRO_KEY_LONG;
+        data[size++] = row;
+        data[size++] = col;
+        data[size++] = record->event.type;
+        data[size++] = keycode & 0xFF;
+        data[size++] = keycode >> 8;
+    }
+
+    if (tap) {
+        data[size++] = tap;
+    }
+    return size;
+}
+
+/**
+ * Unpack the key event at the macro buffer iterator and advance it.
+ *
+ * @param[in,out] pointer   The macro buffer iterator.
+ * @param[in]     direction Either +1 or -1, which way to iterate the buffer.
+ * @param[out]    record    The unpacked event, timestamped with the current time.
+ * @return Milliseconds between the recorded event and the one before it.
+ */
+static uint16_t dynamic_macro_decode(uint8_t **pointer, int8_t direction, keyrecord_t *record) {
+    uint8_t  header = dynamic_macro_read(pointer, direction);
+    uint16_t delta  = header & DYNAMIC_MACRO_DELTA_MASK;
+
+    if (header & DYNAMIC_MACRO_MORE_DELTA) {
+        uint8_t shift = DYNAMIC_MACRO_DELTA_BITS;
+        uint8_t value;
+        do {
+            value = dynamic_macro_read(pointer, direction);
+            delta |= (uint16_t)(value & 0x7F) << shift;
+            shift += 7;
+        } while (value & 0x80);
+    }
+
+    memset(record, 0, sizeof(keyrecord_t));
+    record->event.type    = KEY_EVENT;
+    record->event.pressed = header & DYNAMIC_MACRO_PRESSED;
+
+    uint8_t key = dynamic_macro_read(pointer, direction);
+    if (key == DYNAMIC_MACRO_KEY_LONG) {
+        record->event.key.row = dynamic_macro_read(pointer, direction);
+        record->event.key.col = dynamic_macro_read(pointer, direction);
+        record->event.type    = dynamic_macro_read(pointer, direction);
+        uint16_t keycode      = dynamic_macro_read(pointer, direction);
+        keycode |= (uint16_t)dynamic_macro_read(pointer, direction) << 8;
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+        record->keycode = keycode;
+#endif
+    } else {
+        record->event.key.row = key / MATRIX_COLS;
+        record->event.key.col = key % MATRIX_COLS;
+    }
+
+    if (header & DYNAMIC_MACRO_TAP) {
+        uint8_t tap = dynamic_macro_read(pointer, direction);
+#ifndef NO_ACTION_TAPPING
+        memcpy(&record->tap, &tap, sizeof(tap));
+#else
+        (void)tap;
+#endif
+    }
+
+    record->event.time = timer_read() | 1;
+    return delta;
+}
+
+/* Time of the last recorded event, for the next event's delta. */
+static uint16_t macro_last_event_time = 0;
+
 /**
  * Start recording of the dynamic macro.
  *
  * @param[out] macro_pointer The new macro buffer iterator.
  * @param[in]  macro_buffer  The macro buffer used to initialize macro_pointer.
  */
-void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_buffer, int8_t direction) {
+void dynamic_macro_record_start(uint8_t **macro_pointer, uint8_t *macro_buffer, int8_t direction) {
     dprintln("dynamic macro recording: started");
 
     dynamic_macro_record_start_kb(direction);
@@ -105,34 +246,123 @@ void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_
     *macro_pointer = macro_buffer;
 }
 
+static layer_state_t dynamic_macro_play_start(int8_t direction) {
+    dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
+
+    layer_state_t saved_layer_state = layer_state;
+
+    clear_keyboard();
+    layer_clear();
+
+    return saved_layer_state;
+}
+
+static void dynamic_macro_play_finish(layer_state_t saved_layer_state, int8_t direction) {
+    clear_keyboard();
+
+    layer_state_set(saved_layer_state);
+
+    dynamic_macro_play_kb(direction);
+}
+
+#ifdef OUTPUT_QUEUE_ENABLE
+/* The macro queued for playback, NULL in pos when there is none.
+ * Starting is deferred to the first step so earlier queued output is
+ * not cut short by clear_keyboard(). */
+static struct {
+    uint8_t      *pos;
+    uint8_t      *end;
+    int8_t        direction;
+    bool          started;
+    bool          pending;
+    layer_state_t saved_layer_state;
+    keyrecord_t   record;
+} playback = {0};
+
+static uint16_t dynamic_macro_play_step(void) {
+    if (!playback.started) {
+        playback.saved_layer_state = dynamic_macro_play_start(playback.direction);
+        playback.started           = true;
+    }
+
+    if (!playback.pending) {
+        if (playback.pos == playback.end) {
+            playback.pos = NULL;
+            dynamic_macro_play_finish(playback.saved_layer_state, playback.direction);
+            return OUTPUT_QUEUE_STEP_DONE;
+        }
+
+        uint16_t delta   = dynamic_macro_decode(&playback.pos, playback.direction, &playback.record);
+        playback.pending = true;
+#    ifdef DYNAMIC_MACRO_KEEP_TIMING
+        if (delta) {
+            return delta;
+        }
+#    else
+        (void)delta;
+#    endif
+    }
+
+    playback.pending           = false;
+    playback.record.event.time = timer_read() | 1;
+    process_record(&playback.record);
+#    ifdef DYNAMIC_MACRO_DELAY
+    return DYNAMIC_MACRO_DELAY;
+#    else
+    return 0;
+#    endif
+}
+#endif
+
 /**
  * Play the dynamic macro.
  *
+ * With OUTPUT_QUEUE_ENABLE the macro is queued and played one record
+ * per keyboard_task() pass, so scanning carries on and keys pressed
+ * meanwhile are replayed once it is done.
+ *
  * @param macro_buffer[in] The beginning of the macro buffer being played.
  * @param macro_end[in]    The element after the last macro buffer element.
  * @param direction[in]    Either +1 or -1, which way to iterate the buffer.
  */
-void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_t direction) {
-    dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
-
-    layer_state_t saved_layer_state = layer_state;
+void dynamic_macro_play(uint8_t *macro_buffer, uint8_t *macro_end, int8_t direction) {
+#ifdef OUTPUT_QUEUE_ENABLE
+    /* A macro played from inside another one's playback runs inline,
+     * in its place, as it always has. */
+    if (!output_queue_is_running()) {
+        if (playback.pos != NULL) {
+            output_queue_flush();
+        }
+        playback.pos       = macro_buffer;
+        playback.end       = macro_end;
+        playback.direction = direction;
+        playback.started   = false;
+        playback.pending   = false;
+        output_queue_step(&dynamic_macro_play_step);
+        return;
+    }
+#endif
 
-    clear_keyboard();
-    layer_clear();
+    layer_state_t saved_layer_state = dynamic_macro_play_start(direction);
 
     while (macro_buffer != macro_end) {
-        process_record(macro_buffer);
-        macro_buffer += direction;
+        keyrecord_t record;
+        uint16_t    delta = dynamic_macro_decode(&macro_buffer, direction, &record);
+#ifdef DYNAMIC_MACRO_KEEP_TIMING
+        if (delta) {
+            wait_ms(delta);
+            record.event.time = timer_read() | 1;
+        }
+#else
+        (void)delta;
+#endif
+        process_record(&record);
 #ifdef DYNAMIC_MACRO_DELAY
         wait_ms(DYNAMIC_MACRO_DELAY);
 #endif
     }
 
-    clear_keyboard();
-
-    layer_state_set(saved_layer_state);
-
-    dynamic_macro_play_kb(direction);
+    dynamic_macro_play_finish(saved_layer_state, direction);
 }
 
 /**
@@ -144,41 +374,63 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
  * @param direction[in]  Either +1 or -1, which way to iterate the buffer.
  * @param record[in]     The current keypress.
  */
-void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_pointer, keyrecord_t *macro2_end, int8_t direction, keyrecord_t *record) {
+void dynamic_macro_record_key(uint8_t *macro_buffer, uint8_t **macro_pointer, uint8_t *macro2_end, int8_t direction, keyrecord_t *record) {
     /* If we've just started recording, ignore all the key releases. */
     if (!record->event.pressed && *macro_pointer == macro_buffer) {
         dprintln("dynamic macro: ignoring a leading key-up event");
         return;
     }
 
+    uint16_t delta = 0;
+    if (*macro_pointer != macro_buffer) {
+        uint16_t elapsed = TIMER_DIFF_16(record->event.time, macro_last_event_time);
+        /* UINT16_MAX would read as the end of a queued playback step. */
+        delta = elapsed < UINT16_MAX ? elapsed : UINT16_MAX - 1;
+    }
+
+    uint8_t data[DYNAMIC_MACRO_MAX_EVENT_SIZE];
+    uint8_t size = dynamic_macro_encode(record, delta, data);
+
     /* The other end of the other macro is the last buffer element it
      * is safe to use before overwriting the other macro.
      */
-    if (*macro_pointer - direction != macro2_end) {
-        **macro_pointer = *record;
-        *macro_pointer += direction;
+    if (direction * (macro2_end - *macro_pointer) + 1 >= size) {
+        for (uint8_t i = 0; i < size; i++) {
+            **macro_pointer = data[i];
+            *macro_pointer += direction;
+        }
+        macro_last_event_time = record->event.time;
     }
     dynamic_macro_record_key_kb(direction, record);
 
-    dprintf("dynamic macro: slot %d length: %d/%d\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, *macro_pointer), DYNAMIC_MACRO_CURRENT_CAPACITY(macro_buffer, macro2_end));
+    dprintf("dynamic macro: slot %d length: %d/%d bytes\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, *macro_pointer), DYNAMIC_MACRO_CURRENT_CAPACITY(macro_buffer, macro2_end));
 }
 
 /**
  * End recording of the dynamic macro. Essentially just update the
  * pointer to the end of the macro.
  */
-void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_pointer, int8_t direction, keyrecord_t **macro_end) {
+void dynamic_macro_record_end(uint8_t *macro_buffer, uint8_t *macro_pointer, int8_t direction, uint8_t **macro_end) {
     dynamic_macro_record_end_kb(direction);
 
     /* Do not save the keys being held when stopping the recording,
-     * i.e. the keys used to access the layer DM_RSTP is on.
+     * i.e. the keys used to access the layer DM_RSTP is on. Events
+     * can only be walked forwards, so find the end of the last release.
      */
-    while (macro_pointer != macro_buffer && (macro_pointer - direction)->event.pressed) {
-        dprintln("dynamic macro: trimming a trailing key-down event");
-        macro_pointer -= direction;
+    uint8_t *trimmed = macro_buffer;
+    for (uint8_t *pointer = macro_buffer; pointer != macro_pointer;) {
+        keyrecord_t record;
+        dynamic_macro_decode(&pointer, direction, &record);
+        if (!record.event.pressed) {
+            trimmed = pointer;
+        }
     }
+    if (trimmed != macro_pointer) {
+        dprintln("dynamic macro: trimming trailing key-down events");
+    }
+    macro_pointer = trimmed;
 
-    dprintf("dynamic macro: slot %d saved, length: %d\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, macro_pointer));
+    dprintf("dynamic macro: slot %d saved, length: %d bytes\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, macro_pointer));
 
     *macro_end = macro_pointer;
 }
@@ -206,24 +458,27 @@ void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_poin
  * each other: for example one can either have two medium sized
  * macros or one long macro and one short macro. Or even one empty
  * and one using the whole buffer.
+ *
+ * The buffer takes as much RAM as DYNAMIC_MACRO_SIZE keyrecord_t
+ * used to, and holds several times as many packed events.
  */
-static keyrecord_t macro_buffer[DYNAMIC_MACRO_SIZE];
+static uint8_t macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE];
 
 /* Pointer to the first buffer element after the first macro.
  * Initially points to the very beginning of the buffer since the
  * macro is empty. */
-static keyrecord_t *macro_end = macro_buffer;
+static uint8_t *macro_end = macro_buffer;
 
 /* The other end of the macro buffer. Serves as the beginning of
  * the second macro. */
-static keyrecord_t *const r_macro_buffer = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
+static uint8_t *const r_macro_buffer = macro_buffer + DYNAMIC_MACRO_BUFFER_SIZE - 1;
 
 /* Like macro_end but for the second macro. */
-static keyrecord_t *r_macro_end = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
+static uint8_t *r_macro_end = macro_buffer + DYNAMIC_MACRO_BUFFER_SIZE - 1;
 
 /* A persistent pointer to the current macro position (iterator)
  * used during the recording. */
-static keyrecord_t *macro_pointer = NULL;
+static uint8_t *macro_pointer = NULL;
 
 /* 0   - no macro is being recorded right now
  * 1,2 - either macro 1 or 2 is being recorded */
@@ -22,10 +22,11 @@
 #include <stdbool.h>
 #include "action.h"
 
-/* May be overridden with a custom value. Be aware that the effective
- * macro length is half of this value: each keypress is recorded twice
- * because of the down-event and up-event. This is not a bug, it's the
- * intended behavior.
+/* May be overridden with a custom value. The buffer takes as much RAM
+ * as this many keyrecord_t, shared by both macros. Recorded events are
+ * packed into about three bytes each, and each keypress is recorded
+ * twice because of the down-event and up-event, so on ARM the default
+ * holds roughly 300 keypresses.
  *
  * Usually it should be fine to set the macro size to at least 256 but
  * there have been reports of it being too much in some users' cases,
@@ -35,6 +36,8 @@
 #    define DYNAMIC_MACRO_SIZE 128
 #endif
 
+#define DYNAMIC_MACRO_BUFFER_SIZE (DYNAMIC_MACRO_SIZE * sizeof(keyrecord_t))
+
 void dynamic_macro_led_blink(void);
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_record_start_kb(int8_t direction);
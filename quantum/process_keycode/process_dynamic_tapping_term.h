@@ -24,4 +24,6 @@
 #    define DYNAMIC_TAPPING_TERM_INCREMENT 5
 #endif
 
+#define PROCESS_DYNAMIC_TAPPING_TERM_KEYCODES QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN
+
 bool process_dynamic_tapping_term(uint16_t keycode, keyrecord_t *record);
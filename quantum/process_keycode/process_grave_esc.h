@@ -19,4 +19,6 @@
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_GRAVE_ESC_KEYCODES QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE
+
 bool process_grave_esc(uint16_t keycode, keyrecord_t *record);
@@ -20,4 +20,6 @@
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_JOYSTICK_KEYCODES QK_JOYSTICK, QK_JOYSTICK_MAX
+
 bool process_joystick(uint16_t keycode, keyrecord_t *record);
@@ -7,4 +7,6 @@
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_LED_MATRIX_KEYCODES QK_BACKLIGHT_ON, QK_LED_MATRIX_SPEED_DOWN
+
 bool process_led_matrix(uint16_t keycode, keyrecord_t *record);
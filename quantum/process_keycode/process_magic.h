@@ -19,4 +19,6 @@
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_MAGIC_KEYCODES QK_MAGIC, QK_MAGIC_MAX
+
 bool process_magic(uint16_t keycode, keyrecord_t *record);
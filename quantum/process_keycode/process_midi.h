@@ -46,6 +46,9 @@ typedef union {
 extern midi_config_t midi_config;
 
 void midi_init(void);
+
+#        define PROCESS_MIDI_KEYCODES QK_MIDI, QK_MIDI_MAX
+
 bool process_midi(uint16_t keycode, keyrecord_t *record);
 
 #        define MIDI_INVALID_NOTE 0xFF
@@ -21,4 +21,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_PROGRAMMABLE_BUTTON_KEYCODES QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX
+
 bool process_programmable_button(uint16_t keycode, keyrecord_t *record);
@@ -7,4 +7,6 @@
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_RGB_MATRIX_KEYCODES QK_RGB_MATRIX_ON, QK_RGB_MATRIX_SPEED_DOWN
+
 bool process_rgb_matrix(uint16_t keycode, keyrecord_t *record);
@@ -20,4 +20,6 @@
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_SEQUENCER_KEYCODES QK_SEQUENCER, QK_SEQUENCER_MAX
+
 bool process_sequencer(uint16_t keycode, keyrecord_t *record);
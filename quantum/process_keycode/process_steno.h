@@ -35,6 +35,8 @@ typedef enum {
     STENO_MODE_BOLT,
 } steno_mode_t;
 
+#define PROCESS_STENO_KEYCODES QK_STENO, QK_STENO_MAX
+
 bool process_steno(uint16_t keycode, keyrecord_t *record);
 #ifdef STENO_ENABLE_ALL
 void steno_init(void);
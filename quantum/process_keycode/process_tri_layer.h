@@ -15,4 +15,6 @@
  * @return true continue handling keycodes
  * @return false stop handling keycodes
  */
+#define PROCESS_TRI_LAYER_KEYCODES QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER
+
 bool process_tri_layer(uint16_t keycode, keyrecord_t *record);
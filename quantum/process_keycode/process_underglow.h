@@ -7,4 +7,6 @@
 #include <stdbool.h>
 #include "action.h"
 
+#define PROCESS_UNDERGLOW_KEYCODES QK_UNDERGLOW_TOGGLE, QK_UNDERGLOW_SPEED_DOWN
+
 bool process_underglow(uint16_t keycode, keyrecord_t *record);
@@ -84,6 +84,10 @@
 #    include "process_layer_lock.h"
 #endif
 
+#ifdef EEPROM_WRITE_CACHE_ENABLE
+#    include "eeprom_write_cache.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -210,6 +214,9 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#ifdef EEPROM_WRITE_CACHE_ENABLE
+    eeprom_write_cache_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -271,6 +278,13 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
+/* Handlers that register the keycodes they own as PROCESS_<FEATURE>_KEYCODES
+    are only called for keycodes inside that range. The bounds are constants,
+    so any other event costs a pair of compares instead of a call. Handlers
+    without a range observe every event. Either way the chain order holds. */
+#define PROCESS_KEYCODES(handler, range) PROCESS_KEYCODE_RANGE(handler, range)
+#define PROCESS_KEYCODE_RANGE(handler, min, max) ((keycode < (min) || keycode > (max)) || handler(keycode, record))
+
 /* Core keycode function, hands off handling to other functions,
     then processes internal quantum keycodes, and then processes
     ACTIONs.                                                      */
@@ -330,7 +344,7 @@ bool process_record_quantum(keyrecord_t *record) {
             process_haptic(keycode, record) &&
 #endif
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+            PROCESS_KEYCODES(process_record_via, PROCESS_RECORD_VIA_KEYCODES) &&
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
             process_auto_mouse(keycode, record) &&
@@ -340,22 +354,22 @@ bool process_record_quantum(keyrecord_t *record) {
             process_secure(keycode, record) &&
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+            PROCESS_KEYCODES(process_sequencer, PROCESS_SEQUENCER_KEYCODES) &&
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+            PROCESS_KEYCODES(process_midi, PROCESS_MIDI_KEYCODES) &&
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+            PROCESS_KEYCODES(process_audio, PROCESS_AUDIO_KEYCODES) &&
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+            PROCESS_KEYCODES(process_backlight, PROCESS_BACKLIGHT_KEYCODES) &&
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+            PROCESS_KEYCODES(process_led_matrix, PROCESS_LED_MATRIX_KEYCODES) &&
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+            PROCESS_KEYCODES(process_steno, PROCESS_STENO_KEYCODES) &&
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
             process_music(keycode, record) &&
@@ -379,43 +393,43 @@ bool process_record_quantum(keyrecord_t *record) {
             process_auto_shift(keycode, record) &&
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+            PROCESS_KEYCODES(process_dynamic_tapping_term, PROCESS_DYNAMIC_TAPPING_TERM_KEYCODES) &&
 #endif
 #ifdef SPACE_CADET_ENABLE
             process_space_cadet(keycode, record) &&
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+            PROCESS_KEYCODES(process_magic, PROCESS_MAGIC_KEYCODES) &&
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+            PROCESS_KEYCODES(process_grave_esc, PROCESS_GRAVE_ESC_KEYCODES) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+            PROCESS_KEYCODES(process_underglow, PROCESS_UNDERGLOW_KEYCODES) &&
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+            PROCESS_KEYCODES(process_rgb_matrix, PROCESS_RGB_MATRIX_KEYCODES) &&
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+            PROCESS_KEYCODES(process_joystick, PROCESS_JOYSTICK_KEYCODES) &&
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+            PROCESS_KEYCODES(process_programmable_button, PROCESS_PROGRAMMABLE_BUTTON_KEYCODES) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
             process_autocorrect(keycode, record) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+            PROCESS_KEYCODES(process_tri_layer, PROCESS_TRI_LAYER_KEYCODES) &&
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+            PROCESS_KEYCODES(process_default_layer, PROCESS_DEFAULT_LAYER_KEYCODES) &&
 #endif
 #ifdef LAYER_LOCK_ENABLE
             process_layer_lock(keycode, record) &&
 #endif
 #ifdef BLUETOOTH_ENABLE
-            process_connection(keycode, record) &&
+            PROCESS_KEYCODES(process_connection, PROCESS_CONNECTION_KEYCODES) &&
 #endif
             true)) {
         return false;
@@ -527,6 +541,9 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 
 void suspend_power_down_quantum(void) {
     suspend_power_down_kb();
+#ifdef EEPROM_WRITE_CACHE_ENABLE
+    eeprom_write_cache_flush();
+#endif
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
@@ -570,10 +587,19 @@ void suspend_power_down_quantum(void) {
     // run to ensure scanning occurs while suspended
     pointing_device_task();
 #    endif
+
+// Stop the timer and DMA, wakeup keys are found by scanning in software
+#    ifdef MATRIX_DMA_ENABLE
+    matrix_dma_suspend();
+#    endif
 #endif
 }
 
 __attribute__((weak)) void suspend_wakeup_init_quantum(void) {
+#ifdef MATRIX_DMA_ENABLE
+    matrix_dma_resume();
+#endif
+
 // Turn on backlight
 #ifdef BACKLIGHT_ENABLE
     backlight_init();
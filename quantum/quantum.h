@@ -244,6 +244,10 @@ extern layer_state_t layer_state;
 #    include "layer_lock.h"
 #endif
 
+#ifdef OUTPUT_QUEUE_ENABLE
+#    include "output_queue.h"
+#endif
+
 void set_single_default_layer(uint8_t default_layer);
 void set_single_persistent_default_layer(uint8_t default_layer);
 
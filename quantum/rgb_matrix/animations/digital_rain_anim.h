@@ -7,6 +7,29 @@ RGB_MATRIX_EFFECT(DIGITAL_RAIN)
 #            define RGB_DIGITAL_RAIN_DROPS 24
 #        endif
 
+// The LED each LED takes its drops from: the nearest LED above it in the same matrix column,
+// NO_LED at the top of a column, or the LED itself when it isn't mapped to a key (it never lights)
+static uint8_t digital_rain_above[RGB_MATRIX_LED_COUNT];
+
+static void digital_rain_init(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        digital_rain_above[i] = i;
+    }
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        uint8_t above = NO_LED;
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            uint8_t led[LED_HITS_TO_REMEMBER];
+            uint8_t led_count = rgb_matrix_map_row_column_to_led(row, col, led);
+            for (uint8_t k = 0; k < led_count; k++) {
+                digital_rain_above[led[k]] = above;
+            }
+            if (led_count > 0) {
+                above = led[0];
+            }
+        }
+    }
+}
+
 bool DIGITAL_RAIN(effect_params_t* params) {
     // algorithm ported from https://github.com/tremby/Kaleidoscope-LEDEffect-DigitalRain
     const uint8_t drop_ticks           = 28;
@@ -25,33 +48,25 @@ bool DIGITAL_RAIN(effect_params_t* params) {
     }
 
     decay++;
-    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-            if (row == 0 && drop == 0 && rand() < RAND_MAX / RGB_DIGITAL_RAIN_DROPS) {
-                // top row, pixels have just fallen and we're
-                // making a new rain drop in this column
-                g_rgb_frame_buffer[row][col] = max_intensity;
-            } else if (g_rgb_frame_buffer[row][col] > 0 && g_rgb_frame_buffer[row][col] < max_intensity) {
-                // neither fully bright nor dark, decay it
-                if (decay == decay_ticks) {
-                    g_rgb_frame_buffer[row][col]--;
-                }
-            }
-            // set the pixel colour
-            uint8_t led[LED_HITS_TO_REMEMBER];
-            uint8_t led_count = rgb_matrix_map_row_column_to_led(row, col, led);
-
-            // TODO: multiple leds are supported mapped to the same row/column
-            if (led_count > 0) {
-                if (g_rgb_frame_buffer[row][col] > pure_green_intensity) {
-                    const uint8_t boost = (uint8_t)((uint16_t)max_brightness_boost * (g_rgb_frame_buffer[row][col] - pure_green_intensity) / (max_intensity - pure_green_intensity));
-                    rgb_matrix_set_color(led[0], boost, max_intensity, boost);
-                } else {
-                    const uint8_t green = (uint8_t)((uint16_t)max_intensity * g_rgb_frame_buffer[row][col] / pure_green_intensity);
-                    rgb_matrix_set_color(led[0], 0, green, 0);
-                }
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (digital_rain_above[i] == NO_LED && drop == 0 && rand() < RAND_MAX / RGB_DIGITAL_RAIN_DROPS) {
+            // top of a column, pixels have just fallen and we're
+            // making a new rain drop in this column
+            g_rgb_frame_buffer[i] = max_intensity;
+        } else if (g_rgb_frame_buffer[i] > 0 && g_rgb_frame_buffer[i] < max_intensity) {
+            // neither fully bright nor dark, decay it
+            if (decay == decay_ticks) {
+                g_rgb_frame_buffer[i]--;
             }
         }
+        // set the pixel colour
+        if (g_rgb_frame_buffer[i] > pure_green_intensity) {
+            const uint8_t boost = (uint8_t)((uint16_t)max_brightness_boost * (g_rgb_frame_buffer[i] - pure_green_intensity) / (max_intensity - pure_green_intensity));
+            rgb_matrix_set_color(i, boost, max_intensity, boost);
+        } else {
+            const uint8_t green = (uint8_t)((uint16_t)max_intensity * g_rgb_frame_buffer[i] / pure_green_intensity);
+            rgb_matrix_set_color(i, 0, green, 0);
+        }
     }
     if (decay == decay_ticks) {
         decay = 0;
@@ -60,19 +75,22 @@ bool DIGITAL_RAIN(effect_params_t* params) {
     if (++drop > drop_ticks) {
         // reset drop timer
         drop = 0;
-        for (uint8_t row = MATRIX_ROWS - 1; row > 0; row--) {
-            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-                // if ths is on the bottom row and bright allow decay
-                if (row == MATRIX_ROWS - 1 && g_rgb_frame_buffer[row][col] == max_intensity) {
-                    g_rgb_frame_buffer[row][col]--;
-                }
-                // check if the pixel above is bright
-                if (g_rgb_frame_buffer[row - 1][col] >= max_intensity) { // Note: can be larger than max_intensity if val was recently decreased
-                    // allow old bright pixel to decay
-                    g_rgb_frame_buffer[row - 1][col] = max_intensity - 1;
-                    // make this pixel bright
-                    g_rgb_frame_buffer[row][col] = max_intensity;
-                }
+        // note which pixels are bright before any of them move, so the LEDs can be visited in any order
+        // Note: can be larger than max_intensity if val was recently decreased
+        uint8_t bright[(RGB_MATRIX_LED_COUNT + 7) / 8] = {0};
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            if (g_rgb_frame_buffer[i] >= max_intensity) {
+                bright[i >> 3] |= 1 << (i & 7);
+            }
+        }
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            uint8_t above = digital_rain_above[i];
+            if (above != NO_LED && (bright[above >> 3] & (1 << (above & 7)))) {
+                // the pixel above was bright, make this pixel bright
+                g_rgb_frame_buffer[i] = max_intensity;
+            } else if (bright[i >> 3] & (1 << (i & 7))) {
+                // allow old bright pixel to decay, its drop has moved on
+                g_rgb_frame_buffer[i] = max_intensity - 1;
             }
         }
     }
@@ -0,0 +1,19 @@
+#ifdef RGB_MATRIX_STREAM_ENABLE
+RGB_MATRIX_EFFECT(HOST_STREAM)
+#    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+
+// Shows the last frame streamed from the host, see led_stream.h
+bool HOST_STREAM(effect_params_t* params) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    const led_stream_rgb_t* frame = led_stream_frame();
+    uint8_t                 val   = rgb_matrix_config.hsv.v;
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        rgb_matrix_set_color(i, scale8(frame[i].r, val), scale8(frame[i].g, val), scale8(frame[i].b, val));
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#endif     // RGB_MATRIX_STREAM_ENABLE
@@ -4,7 +4,154 @@
 
 typedef hsv_t (*reactive_splash_f)(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
 
-bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) {
+// Returns the furthest distance a hit of the given age can still light, or a negative value once it has faded out
+typedef int16_t (*reactive_splash_reach_f)(uint16_t tick);
+
+// The grid and the chunk buffer take 4 * RGB_MATRIX_LED_COUNT + 65 bytes of RAM, so they are only kept when an effect
+// that culls by reach is enabled. Custom effects calling effect_runner_reactive_splash_reach() can define
+// RGB_MATRIX_REACTIVE_SPLASH_GRID to use them too, otherwise every LED is visited for every hit.
+#    if defined(ENABLE_RGB_MATRIX_SOLID_SPLASH) || defined(ENABLE_RGB_MATRIX_SOLID_MULTISPLASH) || defined(ENABLE_RGB_MATRIX_SPLASH) || defined(ENABLE_RGB_MATRIX_MULTISPLASH) || defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE_NEXUS) || defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS) || defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE_CROSS) || defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTICROSS) || defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE_WIDE) || defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE)
+#        define RGB_MATRIX_REACTIVE_SPLASH_GRID
+#    endif
+
+// LEDs are bucketed into square cells of (1 << REACTIVE_SPLASH_GRID_SHIFT) units so each hit only visits the cells it can reach
+#    define REACTIVE_SPLASH_GRID_SHIFT 5
+#    define REACTIVE_SPLASH_GRID_SIZE (256 >> REACTIVE_SPLASH_GRID_SHIFT)
+#    define REACTIVE_SPLASH_GRID_CELLS (REACTIVE_SPLASH_GRID_SIZE * REACTIVE_SPLASH_GRID_SIZE)
+
+#    if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#        define REACTIVE_SPLASH_CHUNK_SIZE RGB_MATRIX_LED_PROCESS_LIMIT
+#    else
+#        define REACTIVE_SPLASH_CHUNK_SIZE RGB_MATRIX_LED_COUNT
+#    endif
+
+#    ifdef RGB_MATRIX_REACTIVE_SPLASH_GRID
+// LEDs of cell c are reactive_splash_grid_leds[reactive_splash_grid_start[c] .. reactive_splash_grid_start[c + 1]), in index order
+static uint8_t reactive_splash_grid_start[REACTIVE_SPLASH_GRID_CELLS + 1];
+static uint8_t reactive_splash_grid_leds[RGB_MATRIX_LED_COUNT];
+static hsv_t   reactive_splash_hsv[REACTIVE_SPLASH_CHUNK_SIZE];
+#    endif
+
+// sqrt16(a * a + b * b) for 0 <= b <= a < 32, stored as a triangle at a * (a + 1) / 2 + b
+#    define REACTIVE_SPLASH_DIST_LUT_SIZE 32
+static const uint8_t reactive_splash_dist_lut[] PROGMEM = {
+    0,
+    1, 1,
+    2, 2, 2,
+    3, 3, 3, 4,
+    4, 4, 4, 5, 5,
+    5, 5, 5, 5, 6, 7,
+    6, 6, 6, 6, 7, 7, 8,
+    7, 7, 7, 7, 8, 8, 9, 9,
+    8, 8, 8, 8, 8, 9, 10, 10, 11,
+    9, 9, 9, 9, 9, 10, 10, 11, 12, 12,
+    10, 10, 10, 10, 10, 11, 11, 12, 12, 13, 14,
+    11, 11, 11, 11, 11, 12, 12, 13, 13, 14, 14, 15,
+    12, 12, 12, 12, 12, 13, 13, 13, 14, 15, 15, 16, 16,
+    13, 13, 13, 13, 13, 13, 14, 14, 15, 15, 16, 17, 17, 18,
+    14, 14, 14, 14, 14, 14, 15, 15, 16, 16, 17, 17, 18, 19, 19,
+    15, 15, 15, 15, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20, 21,
+    16, 16, 16, 16, 16, 16, 17, 17, 17, 18, 18, 19, 20, 20, 21, 21, 22,
+    17, 17, 17, 17, 17, 17, 18, 18, 18, 19, 19, 20, 20, 21, 22, 22, 23, 24,
+    18, 18, 18, 18, 18, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 24, 24, 25,
+    19, 19, 19, 19, 19, 19, 19, 20, 20, 21, 21, 21, 22, 23, 23, 24, 24, 25, 26, 26,
+    20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 22, 22, 23, 23, 24, 25, 25, 26, 26, 27, 28,
+    21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 23, 23, 24, 24, 25, 25, 26, 27, 27, 28, 29, 29,
+    22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 28, 29, 29, 30, 31,
+    23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 25, 25, 25, 26, 26, 27, 28, 28, 29, 29, 30, 31, 31, 32,
+    24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 26, 26, 26, 27, 27, 28, 28, 29, 30, 30, 31, 31, 32, 33, 33,
+    25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 32, 32, 33, 33, 34, 35,
+    26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 28, 28, 29, 29, 30, 30, 31, 31, 32, 32, 33, 34, 34, 35, 36, 36,
+    27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 31, 31, 32, 33, 33, 34, 34, 35, 36, 36, 37, 38,
+    28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 32, 32, 33, 33, 34, 35, 35, 36, 36, 37, 38, 38, 39,
+    29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32, 32, 33, 33, 34, 34, 35, 35, 36, 37, 37, 38, 38, 39, 40, 41,
+    30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 33, 33, 34, 34, 34, 35, 36, 36, 37, 37, 38, 39, 39, 40, 41, 41, 42,
+    31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 33, 33, 34, 34, 34, 35, 35, 36, 36, 37, 38, 38, 39, 39, 40, 41, 41, 42, 43, 43,
+};
+
+static inline uint8_t reactive_splash_dist(int16_t dx, int16_t dy) {
+    uint16_t a = dx < 0 ? -dx : dx;
+    uint16_t b = dy < 0 ? -dy : dy;
+    if (a < b) {
+        uint16_t t = a;
+        a          = b;
+        b          = t;
+    }
+    if (a < REACTIVE_SPLASH_DIST_LUT_SIZE) {
+        return pgm_read_byte(&reactive_splash_dist_lut[a * (a + 1) / 2 + b]);
+    }
+    return sqrt16(dx * dx + dy * dy);
+}
+
+#    ifdef RGB_MATRIX_REACTIVE_SPLASH_GRID
+static inline uint8_t reactive_splash_cell(uint8_t x, uint8_t y) {
+    return (y >> REACTIVE_SPLASH_GRID_SHIFT) * REACTIVE_SPLASH_GRID_SIZE + (x >> REACTIVE_SPLASH_GRID_SHIFT);
+}
+
+static void effect_runner_reactive_splash_init(void) {
+    uint8_t n = 0;
+    for (uint8_t c = 0; c < REACTIVE_SPLASH_GRID_CELLS; c++) {
+        reactive_splash_grid_start[c] = n;
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            if (reactive_splash_cell(g_led_config.point[i].x, g_led_config.point[i].y) == c) {
+                reactive_splash_grid_leds[n++] = i;
+            }
+        }
+    }
+    reactive_splash_grid_start[REACTIVE_SPLASH_GRID_CELLS] = n;
+}
+
+bool effect_runner_reactive_splash_reach(uint8_t start, effect_params_t* params, reactive_splash_f effect_func, reactive_splash_reach_f reach_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    for (uint8_t i = led_min; i < led_max; i++) {
+        reactive_splash_hsv[i - led_min]   = rgb_matrix_config.hsv;
+        reactive_splash_hsv[i - led_min].v = 0;
+    }
+
+    uint8_t count = g_last_hit_tracker.count;
+    for (uint8_t j = start; j < count; j++) {
+        uint16_t tick  = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
+        int16_t  reach = reach_func ? reach_func(tick) : 255;
+        if (reach < 0) {
+            continue;
+        }
+
+        uint8_t x      = g_last_hit_tracker.x[j];
+        uint8_t y      = g_last_hit_tracker.y[j];
+        uint8_t cx_min = (x > reach ? x - reach : 0) >> REACTIVE_SPLASH_GRID_SHIFT;
+        uint8_t cx_max = (x + reach > 255 ? 255 : x + reach) >> REACTIVE_SPLASH_GRID_SHIFT;
+        uint8_t cy_min = (y > reach ? y - reach : 0) >> REACTIVE_SPLASH_GRID_SHIFT;
+        uint8_t cy_max = (y + reach > 255 ? 255 : y + reach) >> REACTIVE_SPLASH_GRID_SHIFT;
+
+        for (uint8_t cy = cy_min; cy <= cy_max; cy++) {
+            for (uint8_t cx = cx_min; cx <= cx_max; cx++) {
+                uint8_t c = cy * REACTIVE_SPLASH_GRID_SIZE + cx;
+                for (uint8_t k = reactive_splash_grid_start[c]; k < reactive_splash_grid_start[c + 1]; k++) {
+                    uint8_t i = reactive_splash_grid_leds[k];
+                    if (i < led_min) continue;
+                    if (i >= led_max) break;
+                    RGB_MATRIX_TEST_LED_FLAGS();
+                    int16_t dx = g_led_config.point[i].x - x;
+                    int16_t dy = g_led_config.point[i].y - y;
+                    if (dx > reach || dx < -reach || dy > reach || dy < -reach) continue;
+                    reactive_splash_hsv[i - led_min] = effect_func(reactive_splash_hsv[i - led_min], dx, dy, reactive_splash_dist(dx, dy), tick);
+                }
+            }
+        }
+    }
+
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        hsv_t hsv = reactive_splash_hsv[i - led_min];
+        hsv.v     = scale8(hsv.v, rgb_matrix_config.hsv.v);
+        rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
+#    else
+bool effect_runner_reactive_splash_reach(uint8_t start, effect_params_t* params, reactive_splash_f effect_func, reactive_splash_reach_f reach_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
     uint8_t count = g_last_hit_tracker.count;
@@ -13,11 +160,12 @@ bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, react
         hsv_t hsv = rgb_matrix_config.hsv;
         hsv.v     = 0;
         for (uint8_t j = start; j < count; j++) {
-            int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
-            int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
-            uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
-            hsv           = effect_func(hsv, dx, dy, dist, tick);
+            uint16_t tick  = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
+            int16_t  reach = reach_func ? reach_func(tick) : 255;
+            int16_t  dx    = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+            int16_t  dy    = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+            if (dx > reach || dx < -reach || dy > reach || dy < -reach) continue;
+            hsv = effect_func(hsv, dx, dy, reactive_splash_dist(dx, dy), tick);
         }
         hsv.v     = scale8(hsv.v, rgb_matrix_config.hsv.v);
         rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
@@ -25,5 +173,11 @@ bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, react
     }
     return rgb_matrix_check_finished_leds(led_max);
 }
+#    endif // RGB_MATRIX_REACTIVE_SPLASH_GRID
+
+// Effects that cannot say how far a hit reaches visit every LED for every hit
+bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) {
+    return effect_runner_reactive_splash_reach(start, params, effect_func, NULL);
+}
 
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
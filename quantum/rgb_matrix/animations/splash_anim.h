@@ -19,15 +19,21 @@ hsv_t SPLASH_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick
     return hsv;
 }
 
+// tick - dist only lights LEDs with dist <= tick, and nothing once tick passes 254 + the furthest dist
+static int16_t SPLASH_reach(uint16_t tick) {
+    if (tick > 255 + 254) return -1;
+    return tick > 255 ? 255 : tick;
+}
+
 #            ifdef ENABLE_RGB_MATRIX_SPLASH
 bool SPLASH(effect_params_t* params) {
-    return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SPLASH_math);
+    return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SPLASH_math, &SPLASH_reach);
 }
 #            endif
 
 #            ifdef ENABLE_RGB_MATRIX_MULTISPLASH
 bool MULTISPLASH(effect_params_t* params) {
-    return effect_runner_reactive_splash(0, params, &SPLASH_math);
+    return effect_runner_reactive_splash_reach(0, params, &SPLASH_math, &SPLASH_reach);
 }
 #            endif
 
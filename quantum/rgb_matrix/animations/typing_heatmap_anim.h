@@ -16,34 +16,111 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
 #            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
 #        endif
-void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
-#        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
-    // Limit effect to pressed keys
-    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
-#        else
-    if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
-        return;
+
+// Number of (led, amount) pairs kept for the spread, LEDs past the point where it ran out measure distances on each press
+#        if !defined(RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS) || defined(RGB_MATRIX_TYPING_HEATMAP_SLIM)
+#            undef RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS
+#            define RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS 0
+#        endif
+
+#        ifndef RGB_MATRIX_TYPING_HEATMAP_SLIM
+// LEDs mapped to a key, the only ones heat spreads to
+static uint8_t typing_heatmap_key_leds[(RGB_MATRIX_LED_COUNT + 7) / 8];
+
+static inline bool typing_heatmap_is_key_led(uint8_t i) {
+    return typing_heatmap_key_leds[i >> 3] & (1 << (i & 7));
+}
+
+static uint8_t typing_heatmap_spread_amount(uint8_t led_a, uint8_t led_b) {
+    int16_t dx       = g_led_config.point[led_a].x - g_led_config.point[led_b].x;
+    int16_t dy       = g_led_config.point[led_a].y - g_led_config.point[led_b].y;
+    uint8_t distance = sqrt16((dx * dx) + (dy * dy));
+    if (distance > RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+        return 0;
     }
-    for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
-        for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
-            if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
-                continue;
+    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+    }
+    return amount;
+}
+
+#            if RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS > 0
+typedef struct {
+    uint8_t led;
+    uint8_t amount;
+} typing_heatmap_neighbor_t;
+
+// Neighbors of LED i are typing_heatmap_neighbors[typing_heatmap_neighbor_start[i] .. typing_heatmap_neighbor_start[i + 1]), for i < typing_heatmap_neighbor_leds
+static uint16_t                  typing_heatmap_neighbor_start[RGB_MATRIX_LED_COUNT + 1];
+static typing_heatmap_neighbor_t typing_heatmap_neighbors[RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS];
+static uint8_t                   typing_heatmap_neighbor_leds;
+#            endif
+#        endif
+
+static void typing_heatmap_init(void) {
+#        ifndef RGB_MATRIX_TYPING_HEATMAP_SLIM
+    memset(typing_heatmap_key_leds, 0, sizeof typing_heatmap_key_leds);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led[LED_HITS_TO_REMEMBER];
+            uint8_t led_count = rgb_matrix_map_row_column_to_led(row, col, led);
+            for (uint8_t k = 0; k < led_count; k++) {
+                typing_heatmap_key_leds[led[k] >> 3] |= 1 << (led[k] & 7);
             }
-            if (i_row == row && i_col == col) {
-                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
-            } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
-                uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
-                if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
-                    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
-                    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
-                        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
-                    }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
-                }
+        }
+    }
+
+#            if RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS > 0
+    uint16_t n                   = 0;
+    typing_heatmap_neighbor_leds = RGB_MATRIX_LED_COUNT;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        typing_heatmap_neighbor_start[i] = n;
+        if (!typing_heatmap_is_key_led(i)) continue;
+        for (uint8_t j = 0; j < RGB_MATRIX_LED_COUNT; j++) {
+            if (j == i || !typing_heatmap_is_key_led(j)) continue;
+            uint8_t amount = typing_heatmap_spread_amount(i, j);
+            if (amount == 0) continue;
+            if (n == RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS) {
+                // Out of room, this LED and the ones after it fall back to measuring
+                typing_heatmap_neighbor_leds = i;
+                n                            = typing_heatmap_neighbor_start[i];
+                break;
             }
+            typing_heatmap_neighbors[n++] = (typing_heatmap_neighbor_t){j, amount};
+        }
+        if (typing_heatmap_neighbor_leds != RGB_MATRIX_LED_COUNT) break;
+    }
+    typing_heatmap_neighbor_start[typing_heatmap_neighbor_leds] = n;
+#            endif
+#        endif
+}
+
+void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
+    uint8_t led[LED_HITS_TO_REMEMBER];
+    uint8_t led_count = rgb_matrix_map_row_column_to_led(row, col, led);
+    if (led_count == 0) { // skip as pressed key doesn't have an led position
+        return;
+    }
+    for (uint8_t k = 0; k < led_count; k++) {
+        g_rgb_frame_buffer[led[k]] = qadd8(g_rgb_frame_buffer[led[k]], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+    }
+#        ifndef RGB_MATRIX_TYPING_HEATMAP_SLIM
+    // Spread from the key's first LED, its other LEDs have already been heated
+    uint8_t source = led[0];
+#            if RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS > 0
+    if (source < typing_heatmap_neighbor_leds) {
+        for (uint16_t n = typing_heatmap_neighbor_start[source]; n < typing_heatmap_neighbor_start[source + 1]; n++) {
+            uint8_t i = typing_heatmap_neighbors[n].led;
+            if (led_count > 1 && memchr(led, i, led_count)) continue;
+            g_rgb_frame_buffer[i] = qadd8(g_rgb_frame_buffer[i], typing_heatmap_neighbors[n].amount);
         }
+        return;
+    }
+#            endif
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (!typing_heatmap_is_key_led(i) || memchr(led, i, led_count)) continue;
+        g_rgb_frame_buffer[i] = qadd8(g_rgb_frame_buffer[i], typing_heatmap_spread_amount(source, i));
     }
 #        endif
 }
@@ -74,22 +151,16 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     }
 
     // Render heatmap & decrease
-    uint8_t count = 0;
-    for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
-            if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
-                count++;
-                uint8_t val = g_rgb_frame_buffer[row][col];
-                if (!HAS_ANY_FLAGS(g_led_config.flags[g_led_config.matrix_co[row][col]], params->flags)) continue;
-
-                hsv_t hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
-                rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
-                rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
-
-                if (decrease_heatmap_values) {
-                    g_rgb_frame_buffer[row][col] = qsub8(val, 1);
-                }
-            }
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        uint8_t val = g_rgb_frame_buffer[i];
+
+        hsv_t hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
+        rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+
+        if (decrease_heatmap_values) {
+            g_rgb_frame_buffer[i] = qsub8(val, 1);
         }
     }
 
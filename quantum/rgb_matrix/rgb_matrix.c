@@ -29,6 +29,10 @@
 
 #include <lib/lib8tion/lib8tion.h>
 
+#ifdef RGB_MATRIX_STREAM_ENABLE
+#    include "led_stream.h"
+#endif
+
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
 #else
@@ -39,6 +43,39 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Set by rgb_matrix_led_config_changed() once g_rgb_matrix_led_polar is known to match g_led_config and k_rgb_matrix_center
+static bool led_polar_valid = false;
+
+static void rgb_matrix_check_led_polar(void) {
+    led_polar_valid = false;
+    if (g_rgb_matrix_led_polar == NULL) {
+        return;
+    }
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        led_polar_t polar;
+        memcpy_P(&polar, &g_rgb_matrix_led_polar[i], sizeof(polar));
+        if (polar.dx != g_led_config.point[i].x - k_rgb_matrix_center.x || polar.dy != g_led_config.point[i].y - k_rgb_matrix_center.y) {
+            dprintf("rgb_matrix: g_rgb_matrix_led_polar does not match g_led_config at LED %u, ignoring it\n", i);
+            return;
+        }
+    }
+    led_polar_valid = true;
+}
+
+static inline uint8_t rgb_matrix_led_dist(uint8_t i, int16_t dx, int16_t dy) {
+    if (led_polar_valid) {
+        return pgm_read_byte(&g_rgb_matrix_led_polar[i].dist);
+    }
+    return sqrt16(dx * dx + dy * dy);
+}
+
+static inline uint8_t rgb_matrix_led_angle(uint8_t i, int16_t dx, int16_t dy) {
+    if (led_polar_valid) {
+        return pgm_read_byte(&g_rgb_matrix_led_polar[i].angle);
+    }
+    return atan2_8(dy, dx);
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -64,7 +101,7 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
 rgb_config_t rgb_matrix_config; // TODO: would like to prefix this with g_ for global consistancy, do this in another pr
 uint32_t     g_rgb_timer;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
-uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+uint8_t g_rgb_frame_buffer[RGB_MATRIX_LED_COUNT] = {0};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
@@ -452,6 +489,23 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+/**
+ * Brings the tables derived from g_led_config up to date. Keyboards that change g_led_config or the center point at
+ * runtime must call this afterwards, rgb_matrix_init() calls it at startup.
+ */
+void rgb_matrix_led_config_changed(void) {
+    rgb_matrix_check_led_polar();
+#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(RGB_MATRIX_REACTIVE_SPLASH_GRID)
+    effect_runner_reactive_splash_init();
+#endif
+#if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
+    typing_heatmap_init();
+#endif
+#if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_DIGITAL_RAIN)
+    digital_rain_init();
+#endif
+}
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
@@ -467,6 +521,8 @@ void rgb_matrix_init(void) {
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+    rgb_matrix_led_config_changed();
+
     eeconfig_init_rgb_matrix();
     if (!rgb_matrix_config.mode) {
         dprintf("rgb_matrix_init_drivers rgb_matrix_config.mode = 0. Write default values to EEPROM.\n");
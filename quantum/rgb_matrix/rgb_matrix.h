@@ -165,6 +165,7 @@ bool rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
+void rgb_matrix_led_config_changed(void);
 
 void rgb_matrix_reload_from_eeprom(void);
 
@@ -274,9 +275,12 @@ extern rgb_config_t rgb_matrix_config;
 
 extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
+// Generated from info.json alongside g_led_config, in flash
+extern const led_polar_t g_rgb_matrix_led_polar[RGB_MATRIX_LED_COUNT] __attribute__((weak));
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
-extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
+// Indexed by LED, see rgb_matrix_map_row_column_to_led() for the LEDs of a key
+extern uint8_t g_rgb_frame_buffer[RGB_MATRIX_LED_COUNT];
 #endif
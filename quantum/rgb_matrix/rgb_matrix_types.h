@@ -16,6 +16,10 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "color.h"
@@ -67,6 +71,14 @@ typedef struct PACKED {
 
 #define NO_LED 255
 
+// Position of an LED relative to k_rgb_matrix_center, with dist = sqrt16(dx * dx + dy * dy) and angle = atan2_8(dy, dx)
+typedef struct PACKED {
+    int16_t dx;
+    int16_t dy;
+    uint8_t dist;
+    uint8_t angle;
+} led_polar_t;
+
 typedef struct PACKED {
     uint8_t     matrix_co[MATRIX_ROWS][MATRIX_COLS];
     led_point_t point[RGB_MATRIX_LED_COUNT];
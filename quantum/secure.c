@@ -2,7 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "secure.h"
-#include "timer.h"
+#include "deferred_exec.h"
 #include "util.h"
 
 #ifndef SECURE_UNLOCK_TIMEOUT
@@ -21,40 +21,61 @@
 #endif
 
 static secure_status_t secure_status = SECURE_LOCKED;
-static uint32_t        unlock_time   = 0;
-static uint32_t        idle_time     = 0;
+static deferred_token  timeout_token = INVALID_DEFERRED_TOKEN;
 
 static void secure_hook(secure_status_t secure_status) {
     secure_hook_quantum(secure_status);
     secure_hook_kb(secure_status);
 }
 
+static uint32_t secure_timeout(uint32_t trigger_time, void *cb_arg) {
+    timeout_token = INVALID_DEFERRED_TOKEN;
+    secure_lock();
+    return 0;
+}
+
+/**
+ * @brief Locks again after `timeout` milliseconds, replacing any timeout already scheduled; 0 never locks
+ */
+static void secure_schedule_timeout(uint32_t timeout) {
+    if (!timeout) {
+        cancel_deferred_exec_core(timeout_token);
+        timeout_token = INVALID_DEFERRED_TOKEN;
+        return;
+    }
+    if (!extend_deferred_exec_core(timeout_token, timeout)) {
+        timeout_token = defer_exec_core(timeout, secure_timeout, NULL);
+    }
+}
+
 secure_status_t secure_get_status(void) {
     return secure_status;
 }
 
 void secure_lock(void) {
     secure_status = SECURE_LOCKED;
+    cancel_deferred_exec_core(timeout_token);
+    timeout_token = INVALID_DEFERRED_TOKEN;
     secure_hook(secure_status);
 }
 
 void secure_unlock(void) {
     secure_status = SECURE_UNLOCKED;
-    idle_time     = timer_read32();
+    secure_schedule_timeout(SECURE_IDLE_TIMEOUT);
     secure_hook(secure_status);
 }
 
 void secure_request_unlock(void) {
     if (secure_status == SECURE_LOCKED) {
         secure_status = SECURE_PENDING;
-        unlock_time   = timer_read32();
+        secure_schedule_timeout(SECURE_UNLOCK_TIMEOUT);
     }
     secure_hook(secure_status);
 }
 
 void secure_activity_event(void) {
     if (secure_status == SECURE_UNLOCKED) {
-        idle_time = timer_read32();
+        secure_schedule_timeout(SECURE_IDLE_TIMEOUT);
     }
 }
 
@@ -75,26 +96,6 @@ void secure_keypress_event(uint8_t row, uint8_t col) {
     }
 }
 
-void secure_task(void) {
-#if SECURE_UNLOCK_TIMEOUT != 0
-    // handle unlock timeout
-    if (secure_status == SECURE_PENDING) {
-        if (timer_elapsed32(unlock_time) >= SECURE_UNLOCK_TIMEOUT) {
-            secure_lock();
-        }
-    }
-#endif
-
-#if SECURE_IDLE_TIMEOUT != 0
-    // handle idle timeout
-    if (secure_status == SECURE_UNLOCKED) {
-        if (timer_elapsed32(idle_time) >= SECURE_IDLE_TIMEOUT) {
-            secure_lock();
-        }
-    }
-#endif
-}
-
 __attribute__((weak)) bool secure_hook_user(secure_status_t secure_status) {
     return true;
 }
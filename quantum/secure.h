@@ -67,10 +67,6 @@ void secure_activity_event(void);
  */
 void secure_keypress_event(uint8_t row, uint8_t col);
 
-/** \brief Handle various secure subsystem background tasks
- */
-void secure_task(void);
-
 /** \brief quantum hook called when changing secure status device
  */
 void secure_hook_quantum(secure_status_t secure_status);
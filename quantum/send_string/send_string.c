@@ -24,6 +24,10 @@
 #include "action.h"
 #include "wait.h"
 
+#ifdef OUTPUT_QUEUE_ENABLE
+#    include "output_queue.h"
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -146,57 +150,91 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
-void send_string(const char *string) {
-    send_string_with_delay(string, TAP_CODE_DELAY);
-}
+#ifdef OUTPUT_QUEUE_ENABLE
+// Set while an async call is running, routing taps and waits to the output queue
+static bool send_string_queued = false;
+#endif
 
-void send_string_with_delay(const char *string, uint8_t interval) {
-    while (1) {
-        char ascii_code = *string;
-        if (!ascii_code) break;
-        if (ascii_code == SS_QMK_PREFIX) {
-            ascii_code = *(++string);
+static void send_string_register_code(uint8_t keycode, uint16_t delay) {
+#ifdef OUTPUT_QUEUE_ENABLE
+    if (send_string_queued) {
+        output_queue_register_code(keycode, delay);
+        return;
+    }
+#endif
+    register_code(keycode);
+    wait_ms(delay);
+}
 
-            if (ascii_code == SS_TAP_CODE) {
-                // tap
-                uint8_t keycode = *(++string);
-                tap_code(keycode);
-            } else if (ascii_code == SS_DOWN_CODE) {
-                // down
-                uint8_t keycode = *(++string);
-                register_code(keycode);
-            } else if (ascii_code == SS_UP_CODE) {
-                // up
-                uint8_t keycode = *(++string);
-                unregister_code(keycode);
-            } else if (ascii_code == SS_DELAY_CODE) {
-                // delay
-                int     ms      = 0;
-                uint8_t keycode = *(++string);
+static void send_string_unregister_code(uint8_t keycode, uint16_t delay) {
+#ifdef OUTPUT_QUEUE_ENABLE
+    if (send_string_queued) {
+        output_queue_unregister_code(keycode, delay);
+        return;
+    }
+#endif
+    unregister_code(keycode);
+    wait_ms(delay);
+}
 
-                while (isdigit(keycode)) {
-                    ms *= 10;
-                    ms += keycode - '0';
-                    keycode = *(++string);
-                }
+static void send_string_tap_code_delay(uint8_t keycode, uint16_t delay) {
+#ifdef OUTPUT_QUEUE_ENABLE
+    if (send_string_queued) {
+        output_queue_tap_code(keycode, delay);
+        return;
+    }
+#endif
+    tap_code_delay(keycode, delay);
+}
 
-                wait_ms(ms);
-            }
+static void send_string_tap_code(uint8_t keycode) {
+#ifdef OUTPUT_QUEUE_ENABLE
+    if (send_string_queued) {
+        output_queue_tap_code(keycode, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+        return;
+    }
+#endif
+    tap_code(keycode);
+}
 
-            wait_ms(interval);
-        } else {
-            send_char_with_delay(ascii_code, interval);
-        }
+static void send_string_wait(uint16_t delay) {
+#ifdef OUTPUT_QUEUE_ENABLE
+    if (send_string_queued) {
+        output_queue_wait(delay);
+        return;
+    }
+#endif
+    wait_ms(delay);
+}
 
-        ++string;
+/**
+ * @brief Blocking calls first wait for any queued output, so everything is sent in call order
+ *
+ * @return whether output was being queued before, to be handed back to send_string_end()
+ */
+static inline bool send_string_begin(bool queued) {
+#ifdef OUTPUT_QUEUE_ENABLE
+    bool was_queued = send_string_queued;
+    if (!queued) {
+        output_queue_flush();
     }
+    send_string_queued = queued;
+    return was_queued;
+#else
+    return false;
+#endif
 }
 
-void send_char(char ascii_code) {
-    send_char_with_delay(ascii_code, TAP_CODE_DELAY);
+/**
+ * @brief Restores the state from before send_string_begin(), as a blocking call may run from a step queued by an async one
+ */
+static inline void send_string_end(bool was_queued) {
+#ifdef OUTPUT_QUEUE_ENABLE
+    send_string_queued = was_queued;
+#endif
 }
 
-void send_char_with_delay(char ascii_code, uint8_t interval) {
+static void send_char_internal(char ascii_code, uint8_t interval) {
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') { // BEL
         PLAY_SONG(bell_song);
@@ -210,34 +248,117 @@ void send_char_with_delay(char ascii_code, uint8_t interval) {
     bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
 
     if (is_shifted) {
-        register_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
+        send_string_register_code(KC_LEFT_SHIFT, interval);
     }
 
     if (is_altgred) {
-        register_code(KC_RIGHT_ALT);
-        wait_ms(interval);
+        send_string_register_code(KC_RIGHT_ALT, interval);
     }
 
-    tap_code_delay(keycode, interval);
-    wait_ms(interval);
+    send_string_tap_code_delay(keycode, interval);
+    send_string_wait(interval);
 
     if (is_altgred) {
-        unregister_code(KC_RIGHT_ALT);
-        wait_ms(interval);
+        send_string_unregister_code(KC_RIGHT_ALT, interval);
     }
 
     if (is_shifted) {
-        unregister_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
+        send_string_unregister_code(KC_LEFT_SHIFT, interval);
     }
 
     if (is_dead) {
-        tap_code(KC_SPACE);
-        wait_ms(interval);
+        send_string_tap_code(KC_SPACE);
+        send_string_wait(interval);
     }
 }
 
+/**
+ * @brief Parses a string, from RAM or from PROGMEM, into taps and waits
+ *
+ * PROGMEM strings do not wait `interval` after SS_TAP and friends, as before.
+ */
+static void send_string_internal(const char *string, uint8_t interval, bool progmem) {
+#define SEND_STRING_READ(p) (progmem ? (char)pgm_read_byte(p) : *(p))
+    while (1) {
+        char ascii_code = SEND_STRING_READ(string);
+        if (!ascii_code) break;
+        if (ascii_code == SS_QMK_PREFIX) {
+            ascii_code = SEND_STRING_READ(++string);
+
+            if (ascii_code == SS_TAP_CODE) {
+                // tap
+                uint8_t keycode = SEND_STRING_READ(++string);
+                send_string_tap_code(keycode);
+            } else if (ascii_code == SS_DOWN_CODE) {
+                // down
+                uint8_t keycode = SEND_STRING_READ(++string);
+                send_string_register_code(keycode, 0);
+            } else if (ascii_code == SS_UP_CODE) {
+                // up
+                uint8_t keycode = SEND_STRING_READ(++string);
+                send_string_unregister_code(keycode, 0);
+            } else if (ascii_code == SS_DELAY_CODE) {
+                // delay
+                int     ms      = 0;
+                uint8_t keycode = SEND_STRING_READ(++string);
+
+                while (isdigit(keycode)) {
+                    ms *= 10;
+                    ms += keycode - '0';
+                    keycode = SEND_STRING_READ(++string);
+                }
+
+                send_string_wait(ms);
+            }
+
+            if (!progmem) {
+                send_string_wait(interval);
+            }
+        } else {
+            send_char_internal(ascii_code, interval);
+        }
+
+        ++string;
+    }
+#undef SEND_STRING_READ
+}
+
+void send_string(const char *string) {
+    send_string_with_delay(string, TAP_CODE_DELAY);
+}
+
+void send_string_with_delay(const char *string, uint8_t interval) {
+    bool was_queued = send_string_begin(false);
+    send_string_internal(string, interval, false);
+    send_string_end(was_queued);
+}
+
+/**
+ * @brief Queues a string and returns straight away, leaving keyboard_task() to type it out
+ *
+ * The string is parsed immediately, so it may live on the stack.
+ * Without OUTPUT_QUEUE_ENABLE this is the same as send_string().
+ */
+void send_string_async(const char *string) {
+    send_string_with_delay_async(string, TAP_CODE_DELAY);
+}
+
+void send_string_with_delay_async(const char *string, uint8_t interval) {
+    bool was_queued = send_string_begin(true);
+    send_string_internal(string, interval, false);
+    send_string_end(was_queued);
+}
+
+void send_char(char ascii_code) {
+    send_char_with_delay(ascii_code, TAP_CODE_DELAY);
+}
+
+void send_char_with_delay(char ascii_code, uint8_t interval) {
+    bool was_queued = send_string_begin(false);
+    send_char_internal(ascii_code, interval);
+    send_string_end(was_queued);
+}
+
 void send_dword(uint32_t number) {
     send_word(number >> 16);
     send_word(number & 0xFFFFUL);
@@ -298,41 +419,18 @@ void send_string_P(const char *string) {
 }
 
 void send_string_with_delay_P(const char *string, uint8_t interval) {
-    while (1) {
-        char ascii_code = pgm_read_byte(string);
-        if (!ascii_code) break;
-        if (ascii_code == SS_QMK_PREFIX) {
-            ascii_code = pgm_read_byte(++string);
-
-            if (ascii_code == SS_TAP_CODE) {
-                // tap
-                uint8_t keycode = pgm_read_byte(++string);
-                tap_code(keycode);
-            } else if (ascii_code == SS_DOWN_CODE) {
-                // down
-                uint8_t keycode = pgm_read_byte(++string);
-                register_code(keycode);
-            } else if (ascii_code == SS_UP_CODE) {
-                // up
-                uint8_t keycode = pgm_read_byte(++string);
-                unregister_code(keycode);
-            } else if (ascii_code == SS_DELAY_CODE) {
-                // delay
-                int     ms      = 0;
-                uint8_t keycode = pgm_read_byte(++string);
+    bool was_queued = send_string_begin(false);
+    send_string_internal(string, interval, true);
+    send_string_end(was_queued);
+}
 
-                while (isdigit(keycode)) {
-                    ms *= 10;
-                    ms += keycode - '0';
-                    keycode = pgm_read_byte(++string);
-                }
-                wait_ms(ms);
-            }
-        } else {
-            send_char_with_delay(ascii_code, interval);
-        }
+void send_string_async_P(const char *string) {
+    send_string_with_delay_async_P(string, TAP_CODE_DELAY);
+}
 
-        ++string;
-    }
+void send_string_with_delay_async_P(const char *string, uint8_t interval) {
+    bool was_queued = send_string_begin(true);
+    send_string_internal(string, interval, true);
+    send_string_end(was_queued);
 }
 #endif
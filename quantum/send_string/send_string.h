@@ -65,6 +65,23 @@ void send_string(const char *string);
  */
 void send_string_with_delay(const char *string, uint8_t interval);
 
+/**
+ * \brief Queue a string of ASCII characters to be typed out by the main loop, and return immediately.
+ *
+ * Requires `OUTPUT_QUEUE_ENABLE`, otherwise this is the same as `send_string()`. Keys pressed while the string is being typed are held back until it is done.
+ *
+ * \param string The string to type out. It is parsed before returning, so it may be a temporary buffer.
+ */
+void send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters, with a delay between each character, and return immediately.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ */
+void send_string_with_delay_async(const char *string, uint8_t interval);
+
 /**
  * \brief Type out an ASCII character.
  *
@@ -142,9 +159,30 @@ void send_string_P(const char *string);
  * \param interval The amount of time, in milliseconds, to wait before typing the next character.
  */
 void send_string_with_delay_P(const char *string, uint8_t interval);
+
+/**
+ * \brief Queue a PROGMEM string of ASCII characters, and return immediately.
+ *
+ * On ARM devices, this function is simply an alias for send_string_with_delay_async(string, 0).
+ *
+ * \param string The string to type out.
+ */
+void send_string_async_P(const char *string);
+
+/**
+ * \brief Queue a PROGMEM string of ASCII characters, with a delay between each character, and return immediately.
+ *
+ * On ARM devices, this function is simply an alias for send_string_with_delay_async(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ */
+void send_string_with_delay_async_P(const char *string, uint8_t interval);
 #else
 #    define send_string_P(string) send_string_with_delay(string, 0)
 #    define send_string_with_delay_P(string, interval) send_string_with_delay(string, interval)
+#    define send_string_async_P(string) send_string_with_delay_async(string, 0)
+#    define send_string_with_delay_async_P(string, interval) send_string_with_delay_async(string, interval)
 #endif
 
 /**
@@ -161,4 +199,14 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 #define SEND_STRING_DELAY(string, interval) send_string_with_delay_P(PSTR(string), interval)
 
+/**
+ * \brief Shortcut macro for send_string_with_delay_async_P(PSTR(string), 0).
+ */
+#define SEND_STRING_ASYNC(string) send_string_with_delay_async_P(PSTR(string), 0)
+
+/**
+ * \brief Shortcut macro for send_string_with_delay_async_P(PSTR(string), interval).
+ */
+#define SEND_STRING_DELAY_ASYNC(string, interval) send_string_with_delay_async_P(PSTR(string), interval)
+
 /** \} */
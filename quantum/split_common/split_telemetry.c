@@ -0,0 +1,193 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_telemetry.h"
+#include "debug.h"
+#include "timer.h"
+
+#ifdef PROTOCOL_CHIBIOS
+#    include <ch.h>
+
+// System ticks, resolution depends on CH_CFG_ST_FREQUENCY
+typedef systime_t telemetry_time_t;
+#    define telemetry_now() chVTGetSystemTimeX()
+#    define telemetry_elapsed_us(start) TIME_I2US(chTimeDiffX(start, chVTGetSystemTimeX()))
+#else
+// Millisecond resolution only
+typedef uint32_t telemetry_time_t;
+#    define telemetry_now() timer_read32()
+#    define telemetry_elapsed_us(start) (timer_elapsed32(start) * 1000)
+#endif
+
+static split_telemetry_t telemetry[NUM_TOTAL_TRANSACTIONS];
+static telemetry_time_t  started;
+static int8_t            last_failed = -1;
+
+#define saturating_inc(counter)        \
+    do {                               \
+        if ((counter) != UINT16_MAX) { \
+            (counter)++;               \
+        }                              \
+    } while (0)
+
+/**
+ * @brief Marks the start of a transaction's round trip
+ */
+void split_telemetry_begin(void) {
+    started = telemetry_now();
+}
+
+/**
+ * @brief Records the round trip started by split_telemetry_begin()
+ */
+void split_telemetry_end(int8_t transaction_id, uint16_t bytes, bool okay) {
+    uint32_t           elapsed = telemetry_elapsed_us(started);
+    split_telemetry_t *entry   = &telemetry[transaction_id];
+
+    if (entry->count != UINT32_MAX) {
+        entry->count++;
+    }
+    entry->bytes = entry->bytes > UINT32_MAX - bytes ? UINT32_MAX : entry->bytes + bytes;
+    if (!okay) {
+        saturating_inc(entry->failed);
+        last_failed = transaction_id;
+        return;
+    }
+
+    uint8_t bucket = 0;
+    while (bucket < SPLIT_TELEMETRY_BUCKETS - 1 && elapsed >= ((uint32_t)1 << (SPLIT_TELEMETRY_BUCKET_SHIFT + bucket))) {
+        bucket++;
+    }
+    saturating_inc(entry->latency[bucket]);
+    if (elapsed > entry->max_us) {
+        entry->max_us = elapsed > UINT16_MAX ? UINT16_MAX : elapsed;
+    }
+}
+
+/**
+ * @brief Records data that did not match the checksum it was fetched against
+ */
+void split_telemetry_checksum_failed(int8_t transaction_id) {
+    saturating_inc(telemetry[transaction_id].checksum_failed);
+    last_failed = transaction_id;
+}
+
+/**
+ * @brief Records a retry, against the transaction that last failed
+ */
+void split_telemetry_retry(void) {
+    if (last_failed >= 0) {
+        saturating_inc(telemetry[last_failed].retries);
+    }
+}
+
+/**
+ * @brief Records a state sync pushed back to the next scan
+ */
+void split_telemetry_deferred(int8_t transaction_id) {
+    saturating_inc(telemetry[transaction_id].deferred);
+}
+
+const split_telemetry_t *split_telemetry_get(int8_t transaction_id) {
+    return &telemetry[transaction_id];
+}
+
+void split_telemetry_reset(void) {
+    memset(telemetry, 0, sizeof(telemetry));
+    last_failed = -1;
+}
+
+void split_telemetry_print(void) {
+    uint32_t total = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        total += telemetry[id].bytes;
+    }
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_telemetry_t *entry = &telemetry[id];
+        if (entry->count == 0 && entry->deferred == 0) {
+            continue;
+        }
+        dprintf("split %2d: %lu runs, %lu bytes (%lu%%), %u failed, %u checksum, %u retries, %u deferred, max %uus, us<", id, entry->count, entry->bytes, total ? entry->bytes * 100 / total : 0, entry->failed, entry->checksum_failed, entry->retries, entry->deferred, entry->max_us);
+        for (uint8_t bucket = 0; bucket < SPLIT_TELEMETRY_BUCKETS; bucket++) {
+            dprintf(" %u", entry->latency[bucket]);
+        }
+        dprintf("\n");
+    }
+}
+
+/**
+ * @brief Prints the telemetry every SPLIT_TELEMETRY_PRINT_INTERVAL milliseconds, if set
+ */
+void split_telemetry_task(void) {
+#ifdef SPLIT_TELEMETRY_PRINT_INTERVAL
+    static uint32_t last_print = 0;
+    if (timer_elapsed32(last_print) >= SPLIT_TELEMETRY_PRINT_INTERVAL) {
+        last_print = timer_read32();
+        split_telemetry_print();
+    }
+#endif
+}
+
+static void put_u16(uint8_t *data, uint16_t value) {
+    data[0] = value >> 8;
+    data[1] = value & 0xFF;
+}
+
+static void put_u32(uint8_t *data, uint32_t value) {
+    put_u16(&data[0], value >> 16);
+    put_u16(&data[2], value & 0xFFFF);
+}
+
+/**
+ * @brief Handles a telemetry query
+ *
+ * @param[in,out] data query report, overwritten with the reply
+ * @param[in] length report length
+ * @return true if data holds a reply that should be sent back
+ */
+bool split_telemetry_receive(uint8_t *data, uint8_t length) {
+    uint8_t op = data[1];
+    uint8_t id = data[2];
+    memset(&data[1], 0, length - 1);
+
+    switch (op) {
+        case SPLIT_TELEMETRY_OP_INFO:
+            data[2] = NUM_TOTAL_TRANSACTIONS;
+            data[3] = SPLIT_TELEMETRY_BUCKETS;
+            data[4] = SPLIT_TELEMETRY_BUCKET_SHIFT;
+            data[5] = SPLIT_TELEMETRY_VERSION;
+            break;
+        case SPLIT_TELEMETRY_OP_COUNTERS:
+        case SPLIT_TELEMETRY_OP_HISTOGRAM: {
+            if (id >= NUM_TOTAL_TRANSACTIONS) {
+                data[1] = SPLIT_TELEMETRY_ERROR_RANGE;
+                break;
+            }
+            split_telemetry_t *entry = &telemetry[id];
+            data[2]                  = id;
+            if (op == SPLIT_TELEMETRY_OP_COUNTERS) {
+                put_u32(&data[3], entry->count);
+                put_u32(&data[7], entry->bytes);
+                put_u16(&data[11], entry->failed);
+                put_u16(&data[13], entry->checksum_failed);
+                put_u16(&data[15], entry->retries);
+                put_u16(&data[17], entry->deferred);
+                put_u16(&data[19], entry->max_us);
+            } else {
+                for (uint8_t bucket = 0; bucket < SPLIT_TELEMETRY_BUCKETS; bucket++) {
+                    put_u16(&data[3 + bucket * 2], entry->latency[bucket]);
+                }
+            }
+            break;
+        }
+        case SPLIT_TELEMETRY_OP_RESET:
+            split_telemetry_reset();
+            break;
+        default:
+            data[1] = SPLIT_TELEMETRY_ERROR_OP;
+            break;
+    }
+    return true;
+}
@@ -0,0 +1,85 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "transaction_id_define.h"
+
+/*
+ * Split link telemetry, kept by the master for each transaction it runs.
+ *
+ * Raw HID queries keep the caller's command id in data[0] and the operation in data[1], replies put a status in
+ * data[1]. Multi-byte values are big endian.
+ *
+ *   info:       request  []
+ *               reply    [status] [transactions] [buckets] [bucket shift] [version]
+ *   counters:   request  [transaction id]
+ *               reply    [status] [id] [count x4] [bytes x4] [failed x2] [checksum failed x2] [retries x2] [deferred x2] [max us x2]
+ *   histogram:  request  [transaction id]
+ *               reply    [status] [id] [bucket x2]...
+ *   reset:      request  []
+ *               reply    [status]
+ *
+ * Latency bucket n counts round trips under (1 << (bucket shift + n)) microseconds, the last bucket everything longer.
+ */
+
+#ifndef SPLIT_TELEMETRY_PACKET_SIZE
+#    define SPLIT_TELEMETRY_PACKET_SIZE 32
+#endif
+
+#ifndef SPLIT_TELEMETRY_BUCKETS
+#    define SPLIT_TELEMETRY_BUCKETS 8
+#endif
+
+#ifndef SPLIT_TELEMETRY_BUCKET_SHIFT
+#    define SPLIT_TELEMETRY_BUCKET_SHIFT 6
+#endif
+
+#define SPLIT_TELEMETRY_VERSION 1
+
+_Static_assert(3 + SPLIT_TELEMETRY_BUCKETS * 2 <= SPLIT_TELEMETRY_PACKET_SIZE, "SPLIT_TELEMETRY_BUCKETS do not fit in one report");
+
+typedef enum {
+    SPLIT_TELEMETRY_OP_INFO      = 0x00,
+    SPLIT_TELEMETRY_OP_COUNTERS  = 0x01,
+    SPLIT_TELEMETRY_OP_HISTOGRAM = 0x02,
+    SPLIT_TELEMETRY_OP_RESET     = 0x03,
+} split_telemetry_op_t;
+
+typedef enum {
+    SPLIT_TELEMETRY_OK          = 0x00,
+    SPLIT_TELEMETRY_ERROR_OP    = 0x01, // Unknown operation
+    SPLIT_TELEMETRY_ERROR_RANGE = 0x02, // No such transaction
+} split_telemetry_status_t;
+
+// Counters saturate rather than wrap
+typedef struct split_telemetry_t {
+    uint32_t count;
+    uint32_t bytes; // Payloads plus the transaction ID
+    uint16_t failed;
+    uint16_t checksum_failed;
+    uint16_t retries;
+    uint16_t deferred;
+    uint16_t max_us;
+    uint16_t latency[SPLIT_TELEMETRY_BUCKETS];
+} split_telemetry_t;
+
+void split_telemetry_begin(void);
+void split_telemetry_end(int8_t transaction_id, uint16_t bytes, bool okay);
+void split_telemetry_checksum_failed(int8_t transaction_id);
+void split_telemetry_retry(void);
+void split_telemetry_deferred(int8_t transaction_id);
+
+const split_telemetry_t *split_telemetry_get(int8_t transaction_id);
+void                     split_telemetry_reset(void);
+void                     split_telemetry_print(void);
+void                     split_telemetry_task(void);
+
+bool split_telemetry_receive(uint8_t *data, uint8_t length);
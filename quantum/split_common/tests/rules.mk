@@ -0,0 +1,16 @@
+split_common_DEFS := -DNO_PRINT -DSPLIT_COMMON_TRANSACTIONS
+split_common_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_split.h
+split_common_INC := $(QUANTUM_PATH)/split_common $(QUANTUM_PATH)/split_common/tests
+
+split_common_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/split_common_tests.cpp \
+	$(QUANTUM_PATH)/split_common/tests/split_sim.c \
+	$(QUANTUM_PATH)/split_common/tests/split_sim_master.c \
+	$(QUANTUM_PATH)/split_common/tests/split_sim_slave.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+split_common_batch_DEFS := $(split_common_DEFS) -DSPLIT_TRANSACTION_BATCH_ENABLE -DSPLIT_TELEMETRY_ENABLE
+split_common_batch_CONFIG := $(split_common_CONFIG)
+split_common_batch_INC := $(split_common_INC)
+split_common_batch_SRC := $(split_common_SRC) $(QUANTUM_PATH)/split_common/split_telemetry.c
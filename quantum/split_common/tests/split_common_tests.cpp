@@ -0,0 +1,283 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_sim.h"
+#include "transaction_id_define.h"
+#ifdef SPLIT_TELEMETRY_ENABLE
+#    include "split_telemetry.h"
+#endif
+}
+
+// Soft serial at its default speed, and a hardware USART at 1Mbit
+static const split_sim_link_t serial_link = {.bitrate = 115200, .latency_us = 10, .timeout_us = 1000, .seed = 1};
+static const split_sim_link_t usart_link  = {.bitrate = 1000000, .latency_us = 2, .timeout_us = 1000, .seed = 1};
+
+static split_sim_half_t &master = split_sim_master;
+static split_sim_half_t &slave  = split_sim_slave;
+
+// Answers with each request byte plus one
+static void user_sync_a_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    const uint8_t *in  = (const uint8_t *)in_data;
+    uint8_t       *out = (uint8_t *)out_data;
+    for (uint8_t i = 0; i < in_buflen && i < out_buflen; i++) {
+        out[i] = in[i] + 1;
+    }
+}
+
+class SplitCommonTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        start(usart_link);
+    }
+
+    // Resets both halves, then lets the forced syncs settle before anything is measured
+    void start(const split_sim_link_t &link) {
+        split_sim_init(&link);
+        scan_ms(250);
+        split_sim_reset_stats();
+#ifdef SPLIT_TELEMETRY_ENABLE
+        split_telemetry_reset();
+#endif
+    }
+
+    // Scans at 1kHz, or as fast as the link allows when that is slower
+    void scan_ms(uint32_t ms) {
+        uint64_t end = split_sim_now_us() + (uint64_t)ms * 1000;
+        while (split_sim_now_us() < end) {
+            uint64_t started = split_sim_now_us();
+            split_sim_scan();
+            if (split_sim_now_us() - started < 1000) {
+                split_sim_advance_us(1000 - (split_sim_now_us() - started));
+            }
+        }
+    }
+
+    void expect_in_sync(void) {
+        for (uint8_t row = 0; row < MATRIX_ROWS / 2; row++) {
+            EXPECT_EQ(master.matrix[MATRIX_ROWS / 2 + row], slave.matrix[row]) << "slave row " << (int)row;
+            EXPECT_EQ(slave.matrix[MATRIX_ROWS / 2 + row], master.matrix[row]) << "master row " << (int)row;
+        }
+        EXPECT_EQ(*slave.layers, *master.layers);
+        EXPECT_EQ(*slave.default_layers, *master.default_layers);
+        EXPECT_EQ(slave.mods, master.mods);
+        EXPECT_EQ(slave.weak_mods, master.weak_mods);
+        EXPECT_EQ(slave.oneshot_mods, master.oneshot_mods);
+        EXPECT_EQ(slave.oneshot_locked_mods, master.oneshot_locked_mods);
+        EXPECT_EQ(slave.host_leds, master.host_leds);
+    }
+};
+
+TEST_F(SplitCommonTest, SlaveMatrixReachesMaster) {
+    slave.matrix[0] = 0x05;
+    slave.matrix[3] = 0x80;
+    split_sim_scan();
+    EXPECT_EQ(master.matrix[MATRIX_ROWS / 2], 0x05);
+    EXPECT_EQ(master.matrix[MATRIX_ROWS / 2 + 3], 0x80);
+}
+
+TEST_F(SplitCommonTest, MasterMatrixMirrored) {
+    master.matrix[1] = 0x42;
+    // Sent by the master's scan, picked up by the slave's next one
+    split_sim_scan();
+    split_sim_scan();
+    EXPECT_EQ(slave.matrix[MATRIX_ROWS / 2 + 1], 0x42);
+}
+
+TEST_F(SplitCommonTest, StateSyncsToSlave) {
+    *master.layers         = 1 << 2;
+    *master.default_layers = 1 << 1;
+    master.mods            = 0x02;
+    master.weak_mods       = 0x01;
+    master.oneshot_mods    = 0x10;
+    master.host_leds       = 0x03;
+    scan_ms(5);
+    expect_in_sync();
+}
+
+TEST_F(SplitCommonTest, SyncTimerFollowsMaster) {
+    master.sync_timer_skew = 12345;
+    scan_ms(150);
+    // The slave takes the master's time plus the transfer offset, against a clock that has moved on since
+    EXPECT_NEAR((double)slave.sync_timer_skew, (double)master.sync_timer_skew, 5);
+}
+
+TEST_F(SplitCommonTest, BudgetDefersToNextScan) {
+    *master.layers = 1 << 3;
+    master.mods    = 0x04;
+    split_sim_scan();
+    EXPECT_EQ(slave.shmem->layers.layer_state, *master.layers);
+    EXPECT_NE(slave.shmem->mods.real_mods, master.mods);
+
+    split_sim_scan();
+    EXPECT_EQ(slave.shmem->mods.real_mods, master.mods);
+#ifdef SPLIT_TELEMETRY_ENABLE
+    EXPECT_EQ(split_telemetry_get(PUT_MODS)->deferred, 1);
+    EXPECT_EQ(split_telemetry_get(PUT_LAYER_STATE)->deferred, 0);
+#endif
+}
+
+TEST_F(SplitCommonTest, InputIsNotHeldUpBySync) {
+    // More state than the budget allows, and a key press on the slave
+    *master.layers         = 1 << 4;
+    *master.default_layers = 1 << 2;
+    master.mods            = 0x08;
+    master.host_leds       = 0x01;
+    slave.matrix[2]        = 0x10;
+    split_sim_scan();
+    EXPECT_EQ(master.matrix[MATRIX_ROWS / 2 + 2], 0x10);
+    scan_ms(5);
+    expect_in_sync();
+}
+
+TEST_F(SplitCommonTest, RpcRoundTrip) {
+    slave.rpc_register(USER_SYNC_A, user_sync_a_slave_handler);
+    uint8_t request[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint8_t reply[8]   = {0};
+    ASSERT_TRUE(master.rpc_exec(USER_SYNC_A, sizeof(request), request, sizeof(reply), reply));
+    for (uint8_t i = 0; i < sizeof(reply); i++) {
+        EXPECT_EQ(reply[i], request[i] + 1);
+    }
+}
+
+TEST_F(SplitCommonTest, DroppedTransactionsAreRetried) {
+    split_sim_link()->drop_ppm = 200000;
+    slave.matrix[1]            = 0x21;
+    *master.layers             = 1 << 5;
+    for (uint8_t i = 0; i < 20; i++) {
+        split_sim_scan();
+    }
+    EXPECT_GT(split_sim_stats()->failed, 0u);
+    EXPECT_EQ(master.matrix[MATRIX_ROWS / 2 + 1], 0x21);
+    EXPECT_EQ(slave.shmem->layers.layer_state, *master.layers);
+}
+
+TEST_F(SplitCommonTest, CorruptLinkRecovers) {
+    split_sim_link()->corrupt_ppm = 5000;
+    split_sim_link()->drop_ppm    = 5000;
+
+    uint32_t seed = 7;
+    for (uint16_t step = 0; step < 100; step++) {
+        seed = seed * 1103515245 + 12345;
+        switch ((seed >> 16) % 5) {
+            case 0:
+                slave.matrix[(seed >> 8) % (MATRIX_ROWS / 2)] ^= 1 << (seed % MATRIX_COLS);
+                break;
+            case 1:
+                master.matrix[(seed >> 8) % (MATRIX_ROWS / 2)] ^= 1 << (seed % MATRIX_COLS);
+                break;
+            case 2:
+                *master.layers = 1 << (seed % 8);
+                break;
+            case 3:
+                master.mods = seed >> 24;
+                break;
+            case 4:
+                master.host_leds = seed & 0x1F;
+                break;
+        }
+        scan_ms(5);
+    }
+    EXPECT_GT(split_sim_stats()->corrupted, 0u);
+    EXPECT_GT(split_sim_stats()->failed, 0u);
+
+    // Anything that arrived damaged is put right by the next forced sync
+    split_sim_link()->corrupt_ppm = 0;
+    split_sim_link()->drop_ppm    = 0;
+    scan_ms(250);
+    expect_in_sync();
+}
+
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+TEST_F(SplitCommonTest, QuietScanIsOneFrame) {
+    split_sim_scan();
+    EXPECT_EQ(split_sim_stats()->transactions, 1u);
+}
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
+TEST_F(SplitCommonTest, ChangedStateFrames) {
+    master.matrix[0] = 0x01;
+    *master.layers   = 1 << 6;
+    master.host_leds = 0x02;
+    split_sim_scan();
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+    // The checksums, then the master matrix, layer and LED state together
+    EXPECT_EQ(split_sim_stats()->transactions, 2u);
+#else
+    EXPECT_EQ(split_sim_stats()->transactions, 4u);
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+}
+
+#ifdef SPLIT_TELEMETRY_ENABLE
+TEST_F(SplitCommonTest, TelemetryCountsLinkTraffic) {
+    slave.matrix[0] = 0x01;
+    scan_ms(10);
+    const split_sim_stats_t *stats = split_sim_stats();
+    uint32_t                 count = 0;
+    uint32_t                 bytes = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        count += split_telemetry_get(id)->count;
+        bytes += split_telemetry_get(id)->bytes;
+    }
+    EXPECT_EQ(count, stats->transactions);
+    EXPECT_GT(split_telemetry_get(GET_SLAVE_MATRIX_DATA)->count, 0u);
+    // The link also counts the handshake byte
+    EXPECT_EQ(bytes + stats->transactions, stats->bytes);
+}
+#endif // SPLIT_TELEMETRY_ENABLE
+
+// Virtual time from a key going down on the slave to the master seeing it, scanning back to back
+static uint64_t key_press_latency_us(void) {
+    slave.matrix[0] ^= 0x01;
+    uint64_t pressed = split_sim_now_us();
+    while (master.matrix[MATRIX_ROWS / 2] != slave.matrix[0]) {
+        split_sim_scan();
+    }
+    return split_sim_now_us() - pressed;
+}
+
+TEST_F(SplitCommonTest, Latency) {
+    // Bounds on the worst key press, which can land on a scan busy with forced syncs, and on a scan syncing everything
+    const struct {
+        const char             *name;
+        const split_sim_link_t *link;
+        uint64_t                bound_us;
+    } links[] = {{"serial", &serial_link, 2500}, {"usart", &usart_link, 300}};
+
+    for (auto &entry : links) {
+        start(*entry.link);
+        uint64_t worst = 0;
+        for (uint8_t i = 0; i < 20; i++) {
+            uint64_t latency = key_press_latency_us();
+            worst            = latency > worst ? latency : worst;
+            scan_ms(3);
+        }
+
+        // A busy scan, with every piece of state changed at once
+        *master.layers   = 1 << 1;
+        master.mods      = 0x11;
+        master.host_leds = 0x04;
+        master.matrix[0] = 0x80;
+        uint64_t started = split_sim_now_us();
+        split_sim_scan();
+        uint64_t busy = split_sim_now_us() - started;
+
+        // RPC payload throughput with full buffers
+        slave.rpc_register(USER_SYNC_A, user_sync_a_slave_handler);
+        uint8_t  buffer[RPC_M2S_BUFFER_SIZE < RPC_S2M_BUFFER_SIZE ? RPC_M2S_BUFFER_SIZE : RPC_S2M_BUFFER_SIZE] = {0};
+        uint32_t payload                                                                                       = 0;
+        started                                                                                                = split_sim_now_us();
+        while (split_sim_now_us() - started < 100000) {
+            ASSERT_TRUE(master.rpc_exec(USER_SYNC_A, sizeof(buffer), buffer, sizeof(buffer), buffer));
+            payload += 2 * sizeof(buffer);
+        }
+        uint64_t rpc_us = split_sim_now_us() - started;
+
+        EXPECT_LT(worst, entry.bound_us) << entry.name;
+        EXPECT_LT(busy, entry.bound_us) << entry.name;
+        // Full RPC buffers keep at least half the link busy with payload, at ten bits on the wire per byte
+        EXPECT_GT((uint64_t)payload * 10 * 1000000 / rpc_us, entry.link->bitrate / 2) << entry.name;
+    }
+}
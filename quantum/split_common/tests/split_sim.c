@@ -0,0 +1,150 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_sim.h"
+#include "synchronization_util.h"
+#include "timer.h"
+
+// Out-of-line copies of the no-op locks, for when they aren't inlined
+extern inline void split_shared_memory_lock(void);
+extern inline void split_shared_memory_unlock(void);
+
+void advance_time(uint32_t ms);
+
+static split_sim_link_t  sim_link;
+static split_sim_stats_t sim_stats;
+static uint32_t          random_state;
+static uint64_t          now_us;
+
+void split_sim_init(const split_sim_link_t *config) {
+    sim_link     = *config;
+    random_state = sim_link.seed ? sim_link.seed : 1;
+    split_sim_reset_stats();
+
+    split_sim_half_t *halves[] = {&split_sim_master, &split_sim_slave};
+    for (uint8_t i = 0; i < 2; i++) {
+        split_sim_half_t *half = halves[i];
+        memset(half->matrix, 0, sizeof(half->matrix));
+        memset(half->shmem, 0, sizeof(split_shared_memory_t));
+        *half->layers             = 0;
+        *half->default_layers     = 0;
+        half->mods                = 0;
+        half->weak_mods           = 0;
+        half->oneshot_mods        = 0;
+        half->oneshot_locked_mods = 0;
+        half->host_leds           = 0;
+        half->sync_timer_skew     = 0;
+    }
+}
+
+split_sim_link_t *split_sim_link(void) {
+    return &sim_link;
+}
+
+const split_sim_stats_t *split_sim_stats(void) {
+    return &sim_stats;
+}
+
+void split_sim_reset_stats(void) {
+    memset(&sim_stats, 0, sizeof(sim_stats));
+}
+
+uint64_t split_sim_now_us(void) {
+    return now_us;
+}
+
+// Virtual time only ever moves forward, the platform timer follows it a millisecond at a time
+void split_sim_advance_us(uint32_t us) {
+    uint64_t before = now_us / 1000;
+    now_us += us;
+    if (now_us / 1000 != before) {
+        advance_time(now_us / 1000 - before);
+    }
+}
+
+// xorshift32, so that a seed always gives the same run
+static bool chance(uint32_t ppm) {
+    if (ppm == 0) {
+        return false;
+    }
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state % 1000000 < ppm;
+}
+
+static bool corrupt(uint8_t *data, uint16_t length) {
+    bool corrupted = false;
+    for (uint16_t i = 0; i < length; i++) {
+        if (chance(sim_link.corrupt_ppm)) {
+            data[i] ^= 1 << (random_state % 8);
+            corrupted = true;
+        }
+    }
+    if (corrupted) {
+        sim_stats.corrupted++;
+    }
+    return corrupted;
+}
+
+static uint32_t line_time_us(uint32_t bytes, uint32_t turnarounds) {
+    return (uint32_t)((uint64_t)bytes * 10 * 1000000 / sim_link.bitrate) + turnarounds * sim_link.latency_us;
+}
+
+/*
+ * Runs one transaction the way the serial transport does: the master's buffers travel from its shared memory into the
+ * slave's, the slave's callback runs, and the reply travels back.
+ */
+bool split_sim_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans    = &split_sim_master.table[id];
+    split_transaction_desc_t *target   = &split_sim_slave.table[id];
+    uint8_t                  *master   = (uint8_t *)split_sim_master.shmem;
+    uint8_t                  *slave    = (uint8_t *)split_sim_slave.shmem;
+    uint16_t                  i2t_size = trans->initiator2target_buffer_size;
+    uint16_t                  t2i_size = trans->target2initiator_buffer_size;
+
+    if (initiator2target_length > 0) {
+        memcpy(master + trans->initiator2target_offset, initiator2target_buf, initiator2target_length < i2t_size ? initiator2target_length : i2t_size);
+    }
+
+    sim_stats.transactions++;
+    if (chance(sim_link.drop_ppm)) {
+        split_sim_advance_us(sim_link.timeout_us);
+        sim_stats.failed++;
+        return false;
+    }
+
+    // The transaction ID, then the slave's handshake
+    uint8_t handshake[2] = {id, id};
+    sim_stats.bytes += sizeof(handshake) + i2t_size + t2i_size;
+    if (corrupt(handshake, sizeof(handshake))) {
+        split_sim_advance_us(line_time_us(sizeof(handshake), 1) + sim_link.timeout_us);
+        sim_stats.failed++;
+        return false;
+    }
+    split_sim_advance_us(line_time_us(sizeof(handshake) + i2t_size + t2i_size, t2i_size > 0 ? 3 : 2));
+
+    if (i2t_size > 0) {
+        memcpy(slave + target->initiator2target_offset, master + trans->initiator2target_offset, i2t_size);
+        corrupt(slave + target->initiator2target_offset, i2t_size);
+    }
+    if (target->slave_callback) {
+        target->slave_callback(target->initiator2target_buffer_size, slave + target->initiator2target_offset, target->target2initiator_buffer_size, slave + target->target2initiator_offset);
+    }
+    if (t2i_size > 0) {
+        memcpy(master + trans->target2initiator_offset, slave + target->target2initiator_offset, t2i_size);
+        corrupt(master + trans->target2initiator_offset, t2i_size);
+        memcpy(target2initiator_buf, master + trans->target2initiator_offset, target2initiator_length < t2i_size ? target2initiator_length : t2i_size);
+    }
+    return true;
+}
+
+/*
+ * One matrix scan on each half: the slave publishes its rows, then the master runs its transactions.
+ */
+bool split_sim_scan(void) {
+    split_sim_slave.run_slave(&split_sim_slave.matrix[MATRIX_ROWS / 2], &split_sim_slave.matrix[0]);
+    return split_sim_master.run_master(&split_sim_master.matrix[0], &split_sim_master.matrix[MATRIX_ROWS / 2]);
+}
@@ -0,0 +1,73 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+#include "action_layer.h"
+#include "transactions.h"
+
+/*
+ * Two halves of a split keyboard in one process, joined by an in-memory link.
+ *
+ * Each half has its own copy of transactions.c and of the keyboard state it reads and writes, so the master and slave
+ * run the same code as on hardware. The link follows the serial protocol: a transaction ID, a handshake back, the
+ * initiator to target buffer, then the target to initiator buffer, with the slave's callback run in between. Time is
+ * virtual; each transaction advances it by what the bytes and line turnarounds would have taken, which also drives the
+ * platform timer seen by both halves.
+ */
+
+typedef struct split_sim_link_t {
+    uint32_t bitrate;     // Bits per second, ten per byte as on a UART
+    uint32_t latency_us;  // Each time the line changes direction
+    uint32_t timeout_us;  // Spent by the master on a transaction the slave never answers
+    uint32_t corrupt_ppm; // Chance per byte of one flipped bit, in millionths
+    uint32_t drop_ppm;    // Chance per transaction of the slave not answering, in millionths
+    uint32_t seed;
+} split_sim_link_t;
+
+typedef struct split_sim_stats_t {
+    uint32_t transactions;
+    uint32_t failed;
+    uint32_t bytes;
+    uint32_t corrupted;
+    uint64_t busy_us;
+} split_sim_stats_t;
+
+typedef struct split_sim_half_t {
+    // This half's rows first, then the other half's as last received
+    matrix_row_t   matrix[MATRIX_ROWS];
+    layer_state_t *layers;
+    layer_state_t *default_layers;
+    uint8_t        mods;
+    uint8_t        weak_mods;
+    uint8_t        oneshot_mods;
+    uint8_t        oneshot_locked_mods;
+    uint8_t        host_leds;
+    uint32_t       sync_timer_skew;
+
+    // This half's copy of the split code, member names steer clear of what split_sim_half.c renames
+    split_shared_memory_t    *shmem;
+    split_transaction_desc_t *table;
+    bool (*run_master)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+    void (*run_slave)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+    void (*rpc_register)(int8_t transaction_id, slave_callback_t callback);
+    bool (*rpc_exec)(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+} split_sim_half_t;
+
+extern split_sim_half_t split_sim_master;
+extern split_sim_half_t split_sim_slave;
+
+void                     split_sim_init(const split_sim_link_t *link);
+split_sim_link_t        *split_sim_link(void);
+const split_sim_stats_t *split_sim_stats(void);
+void                     split_sim_reset_stats(void);
+
+bool     split_sim_scan(void);
+uint64_t split_sim_now_us(void);
+void     split_sim_advance_us(uint32_t us);
+
+bool split_sim_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
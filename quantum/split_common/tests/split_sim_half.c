@@ -0,0 +1,118 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * One half of the simulated keyboard, included by split_sim_master.c and split_sim_slave.c with SPLIT_SIM_HALF set.
+ * Everything transactions.c defines or reaches outside of itself is renamed with the half's prefix, so that each half
+ * gets its own copy of the split code and of the keyboard state it syncs.
+ */
+
+#define SPLIT_SIM_NAME(name) SPLIT_SIM_NAME_(SPLIT_SIM_HALF, name)
+#define SPLIT_SIM_NAME_(half, name) SPLIT_SIM_NAME__(half, name)
+#define SPLIT_SIM_NAME__(half, name) half##_##name
+#define SPLIT_SIM_STATE SPLIT_SIM_NAME_(split_sim, SPLIT_SIM_HALF)
+
+// Defined by transactions.c
+#define split_transaction_table SPLIT_SIM_NAME(split_transaction_table)
+#define transactions_master SPLIT_SIM_NAME(transactions_master)
+#define transactions_slave SPLIT_SIM_NAME(transactions_slave)
+#define transaction_register_rpc SPLIT_SIM_NAME(transaction_register_rpc)
+#define transaction_rpc_exec SPLIT_SIM_NAME(transaction_rpc_exec)
+#define slave_rpc_info_callback SPLIT_SIM_NAME(slave_rpc_info_callback)
+#define slave_rpc_exec_callback SPLIT_SIM_NAME(slave_rpc_exec_callback)
+
+// Used by transactions.c, defined below
+#define split_shmem SPLIT_SIM_NAME(split_shmem)
+#define transport_execute_transaction SPLIT_SIM_NAME(transport_execute_transaction)
+#define is_transport_connected SPLIT_SIM_NAME(is_transport_connected)
+#define layer_state SPLIT_SIM_NAME(layer_state)
+#define default_layer_state SPLIT_SIM_NAME(default_layer_state)
+#define get_mods SPLIT_SIM_NAME(get_mods)
+#define set_mods SPLIT_SIM_NAME(set_mods)
+#define get_weak_mods SPLIT_SIM_NAME(get_weak_mods)
+#define set_weak_mods SPLIT_SIM_NAME(set_weak_mods)
+#define get_oneshot_mods SPLIT_SIM_NAME(get_oneshot_mods)
+#define set_oneshot_mods SPLIT_SIM_NAME(set_oneshot_mods)
+#define get_oneshot_locked_mods SPLIT_SIM_NAME(get_oneshot_locked_mods)
+#define set_oneshot_locked_mods SPLIT_SIM_NAME(set_oneshot_locked_mods)
+#define host_keyboard_leds SPLIT_SIM_NAME(host_keyboard_leds)
+#define set_split_host_keyboard_leds SPLIT_SIM_NAME(set_split_host_keyboard_leds)
+#define sync_timer_read32 SPLIT_SIM_NAME(sync_timer_read32)
+#define sync_timer_update SPLIT_SIM_NAME(sync_timer_update)
+
+#include "transactions.c"
+#include "split_sim.h"
+#include "timer.h"
+
+static split_shared_memory_t shared_memory;
+split_shared_memory_t *const split_shmem = &shared_memory;
+
+layer_state_t layer_state;
+layer_state_t default_layer_state;
+
+split_sim_half_t SPLIT_SIM_STATE = {
+    .layers         = &layer_state,
+    .default_layers = &default_layer_state,
+    .shmem          = &shared_memory,
+    .table          = split_transaction_table,
+    .run_master     = transactions_master,
+    .run_slave      = transactions_slave,
+    .rpc_register   = transaction_register_rpc,
+    .rpc_exec       = transaction_rpc_exec,
+};
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    return split_sim_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+uint8_t get_mods(void) {
+    return SPLIT_SIM_STATE.mods;
+}
+
+void set_mods(uint8_t mods) {
+    SPLIT_SIM_STATE.mods = mods;
+}
+
+uint8_t get_weak_mods(void) {
+    return SPLIT_SIM_STATE.weak_mods;
+}
+
+void set_weak_mods(uint8_t mods) {
+    SPLIT_SIM_STATE.weak_mods = mods;
+}
+
+uint8_t get_oneshot_mods(void) {
+    return SPLIT_SIM_STATE.oneshot_mods;
+}
+
+void set_oneshot_mods(uint8_t mods) {
+    SPLIT_SIM_STATE.oneshot_mods = mods;
+}
+
+uint8_t get_oneshot_locked_mods(void) {
+    return SPLIT_SIM_STATE.oneshot_locked_mods;
+}
+
+void set_oneshot_locked_mods(uint8_t mods) {
+    SPLIT_SIM_STATE.oneshot_locked_mods = mods;
+}
+
+uint8_t host_keyboard_leds(void) {
+    return SPLIT_SIM_STATE.host_leds;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {
+    SPLIT_SIM_STATE.host_leds = led_state;
+}
+
+uint32_t sync_timer_read32(void) {
+    return timer_read32() + SPLIT_SIM_STATE.sync_timer_skew;
+}
+
+void sync_timer_update(uint32_t time) {
+    SPLIT_SIM_STATE.sync_timer_skew = time - timer_read32();
+}
@@ -0,0 +1,5 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#define SPLIT_SIM_HALF slave
+#include "split_sim_half.c"
@@ -0,0 +1,3 @@
+TEST_LIST += \
+	split_common \
+	split_common_batch
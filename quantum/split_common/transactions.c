@@ -30,6 +30,7 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "util.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -64,6 +65,9 @@
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef SPLIT_TELEMETRY_ENABLE
+#    include "split_telemetry.h"
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -71,12 +75,20 @@
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
 
+#ifndef SPLIT_TRANSACTION_BUDGET
+#    define SPLIT_TRANSACTION_BUDGET 32
+#endif // SPLIT_TRANSACTION_BUDGET
+
 #define sizeof_member(type, member) sizeof(((type *)NULL)->member)
 
 #define trans_initiator2target_initializer_cb(member, cb) \
     { sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), 0, 0, cb }
 #define trans_initiator2target_initializer(member) trans_initiator2target_initializer_cb(member, NULL)
 
+// Sends only the first `size` bytes of the member
+#define trans_initiator2target_initializer_size_cb(member, size, cb) \
+    { size, offsetof(split_shared_memory_t, member), 0, 0, cb }
+
 #define trans_target2initiator_initializer_cb(member, cb) \
     { 0, 0, sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), cb }
 #define trans_target2initiator_initializer(member) trans_target2initiator_initializer_cb(member, NULL)
@@ -84,9 +96,9 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#define transport_write(id, data, length) transaction_execute(id, data, length, NULL, 0)
+#define transport_read(id, data, length) transaction_execute(id, NULL, 0, data, length)
+#define transport_exec(id) transaction_execute(id, NULL, 0, NULL, 0)
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -94,6 +106,108 @@ void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *i
 void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+////////////////////////////////////////////////////
+// Telemetry
+
+#ifndef SPLIT_TELEMETRY_ENABLE
+#    define split_telemetry_begin()
+#    define split_telemetry_end(id, bytes, okay)
+#    define split_telemetry_checksum_failed(id)
+#    define split_telemetry_retry()
+#    define split_telemetry_deferred(id)
+#    define split_telemetry_task()
+#endif // SPLIT_TELEMETRY_ENABLE
+
+static bool transaction_execute_now(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_telemetry_begin();
+    bool okay = transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    // The transaction ID goes over the link along with the payloads
+    split_telemetry_end(id, 1 + initiator2target_length + target2initiator_length, okay);
+    return okay;
+}
+
+////////////////////////////////////////////////////
+// Batching
+
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+/* While the master runs its transactions, writes are packed into one PUT_BATCH frame instead of each being a round
+ * trip of their own, and the input checksums are all fetched by one GET_BATCH_CHECKSUMS frame. Any other transaction
+ * sends the frame first, so the slave still sees everything in the order it was issued.
+ */
+static split_batch_sync_t batch;
+static bool               batch_open;
+static uint32_t           batch_prefetched;
+
+static bool batch_flush(void) {
+    if (batch.length == 0) {
+        return true;
+    }
+    // Transports send a transaction's whole buffer, so pick the shortest frame the batch fits in
+    int8_t id = PUT_BATCH;
+    if (batch.length <= SPLIT_TRANSACTION_BATCH_SIZE / 4) {
+        id = PUT_BATCH_QUARTER;
+    } else if (batch.length <= SPLIT_TRANSACTION_BATCH_SIZE / 2) {
+        id = PUT_BATCH_HALF;
+    }
+    // Left queued on failure, the frame goes out with the next transaction
+    if (!transaction_execute_now(id, &batch, 1 + batch.length, NULL, 0)) {
+        return false;
+    }
+    batch.length = 0;
+    return true;
+}
+
+static bool batch_add(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans  = &split_transaction_table[id];
+    uint8_t                   length = trans->initiator2target_buffer_size;
+    if (!batch_open || id == PUT_BATCH || id == PUT_BATCH_HALF || id == PUT_BATCH_QUARTER || initiator2target_length != length || length == 0 || target2initiator_length > 0 || 1 + length > sizeof(batch.data)) {
+        return false;
+    }
+#    ifndef DISABLE_SYNC_TIMER
+    // The timestamp has to go out when it is read, a frame left queued after a failure would deliver it late
+    if (id == PUT_SYNC_TIMER) {
+        return false;
+    }
+#    endif // DISABLE_SYNC_TIMER
+    if (batch.length + 1 + length > sizeof(batch.data) && !batch_flush()) {
+        return false;
+    }
+
+    // Keep the master's copy up to date, as the transport would
+    memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, length);
+    batch.data[batch.length++] = id;
+    memcpy(&batch.data[batch.length], initiator2target_buf, length);
+    batch.length += length;
+    return true;
+}
+
+static bool batch_take(int8_t id, void *target2initiator_buf, uint16_t target2initiator_length) {
+    uint32_t bit = (uint32_t)1 << id;
+    if (!(batch_prefetched & bit)) {
+        return false;
+    }
+    batch_prefetched &= ~bit;
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), MIN(trans->target2initiator_buffer_size, target2initiator_length));
+    return true;
+}
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
+static bool transaction_execute(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+    if (initiator2target_length == 0 && batch_take(id, target2initiator_buf, target2initiator_length)) {
+        return true;
+    }
+    if (batch_add(id, initiator2target_buf, initiator2target_length, target2initiator_length)) {
+        return true;
+    }
+    if (!batch_flush()) {
+        return false;
+    }
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+    return transaction_execute_now(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+}
+
 ////////////////////////////////////////////////////
 // Helpers
 
@@ -101,6 +215,7 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
     int num_retries = is_transport_connected() ? 10 : 1;
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
+            split_telemetry_retry();
             for (int i = 0; i < iter * iter; ++i) {
                 wait_us(10);
             }
@@ -149,7 +264,10 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
     if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
         okay &= transport_read(trans_id_retrieve, destination, length);
-        okay &= curr_checksum == crc8(equiv_shmem, length);
+        if (okay && curr_checksum != crc8(equiv_shmem, length)) {
+            split_telemetry_checksum_failed(trans_id_retrieve);
+            okay = false;
+        }
         if (okay) {
             *last_update = timer_read32();
         }
@@ -159,20 +277,50 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
     return okay;
 }
 
-inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
-    bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
-        if (okay) {
-            *last_update = timer_read32();
-        }
+////////////////////////////////////////////////////
+// State sync
+
+/* Master to slave state is sent when it changes, or every FORCED_SYNC_THROTTLE_MS. Once the input transactions are
+ * done, each cycle may only send SPLIT_TRANSACTION_BUDGET bytes of it; anything over is deferred to the next cycle,
+ * where it goes ahead regardless of the budget. A failed send is retried the same way.
+ */
+static uint16_t sync_budget;
+static uint32_t sync_pending;
+static uint16_t sync_last_update[NUM_TOTAL_TRANSACTIONS];
+
+inline static bool sync_state_if(int8_t trans_id, bool changed, const void *source) {
+    uint32_t bit    = (uint32_t)1 << trans_id;
+    uint8_t  length = split_transaction_table[trans_id].initiator2target_buffer_size;
+    if (!changed && !(sync_pending & bit) && timer_elapsed(sync_last_update[trans_id]) < FORCED_SYNC_THROTTLE_MS) {
+        return true;
+    }
+    if (!(sync_pending & bit) && length > sync_budget) {
+        sync_pending |= bit;
+        split_telemetry_deferred(trans_id);
+        return true;
+    }
+    sync_budget = length < sync_budget ? sync_budget - length : 0;
+
+    bool okay = transport_write(trans_id, source, length);
+    if (okay) {
+        sync_pending &= ~bit;
+        sync_last_update[trans_id] = timer_read();
+    } else {
+        sync_pending |= bit;
     }
     return okay;
 }
 
-inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update, void *source, const void *equiv_shmem, size_t length) {
-    // Just run a memcmp to compare the source and equivalent shmem location
-    return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
+// The master's shared memory holds what was last sent, so the state is dirty when it differs
+inline static bool sync_state(int8_t trans_id, const void *source) {
+    split_transaction_desc_t *trans = &split_transaction_table[trans_id];
+    return sync_state_if(trans_id, memcmp(source, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size) != 0, source);
+}
+
+// Whether the slave has been sent this state, rather than it being deferred
+inline static bool sync_state_sent(int8_t trans_id, const void *source) {
+    split_transaction_desc_t *trans = &split_transaction_table[trans_id];
+    return !(sync_pending & ((uint32_t)1 << trans_id)) && memcmp(source, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size) == 0;
 }
 
 ////////////////////////////////////////////////////
@@ -212,8 +360,7 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 #ifdef SPLIT_TRANSPORT_MIRROR
 
 static bool master_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    return send_if_data_mismatch(PUT_MASTER_MATRIX, &last_update, master_matrix, split_shmem->mmatrix.matrix, sizeof(split_shmem->mmatrix.matrix));
+    return sync_state(PUT_MASTER_MATRIX, master_matrix);
 }
 
 static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -297,17 +444,9 @@ static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, c
 #ifndef DISABLE_SYNC_TIMER
 
 static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-
-    bool okay = true;
-    if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
-        uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
-        if (okay) {
-            last_update = timer_read32();
-        }
-    }
-    return okay;
+    // Only ever sent on the forced sync
+    uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
+    return sync_state_if(PUT_SYNC_TIMER, false, &sync_timer);
 }
 
 static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -336,12 +475,9 @@ static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 
 static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_layer_state_update         = 0;
-    static uint32_t last_default_layer_state_update = 0;
-
-    bool okay = send_if_condition(PUT_LAYER_STATE, &last_layer_state_update, (layer_state != split_shmem->layers.layer_state), &layer_state, sizeof(layer_state));
+    bool okay = sync_state(PUT_LAYER_STATE, &layer_state);
     if (okay) {
-        okay &= send_if_condition(PUT_DEFAULT_LAYER_STATE, &last_default_layer_state_update, (default_layer_state != split_shmem->layers.default_layer_state), &default_layer_state, sizeof(default_layer_state));
+        okay &= sync_state(PUT_DEFAULT_LAYER_STATE, &default_layer_state);
     }
     return okay;
 }
@@ -373,9 +509,8 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #ifdef SPLIT_LED_STATE_ENABLE
 
 static bool led_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         led_state   = host_keyboard_leds();
-    return send_if_data_mismatch(PUT_LED_STATE, &last_update, &led_state, &split_shmem->led_state, sizeof(led_state));
+    uint8_t led_state = host_keyboard_leds();
+    return sync_state(PUT_LED_STATE, &led_state);
 }
 
 static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -401,39 +536,14 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #ifdef SPLIT_MODS_ENABLE
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update    = 0;
-    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
     split_mods_sync_t new_mods;
     new_mods.real_mods = get_mods();
-    if (!mods_need_sync && new_mods.real_mods != split_shmem->mods.real_mods) {
-        mods_need_sync = true;
-    }
-
     new_mods.weak_mods = get_weak_mods();
-    if (!mods_need_sync && new_mods.weak_mods != split_shmem->mods.weak_mods) {
-        mods_need_sync = true;
-    }
-
 #    ifndef NO_ACTION_ONESHOT
-    new_mods.oneshot_mods = get_oneshot_mods();
-    if (!mods_need_sync && new_mods.oneshot_mods != split_shmem->mods.oneshot_mods) {
-        mods_need_sync = true;
-    }
+    new_mods.oneshot_mods        = get_oneshot_mods();
     new_mods.oneshot_locked_mods = get_oneshot_locked_mods();
-    if (!mods_need_sync && new_mods.oneshot_locked_mods != split_shmem->mods.oneshot_locked_mods) {
-        mods_need_sync = true;
-    }
 #    endif // NO_ACTION_ONESHOT
-
-    bool okay = true;
-    if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
-        if (okay) {
-            last_update = timer_read32();
-        }
-    }
-
-    return okay;
+    return sync_state(PUT_MODS, &new_mods);
 }
 
 static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -468,9 +578,8 @@ static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #ifdef BACKLIGHT_ENABLE
 
 static bool backlight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         level       = is_backlight_enabled() ? get_backlight_level() : 0;
-    return send_if_condition(PUT_BACKLIGHT, &last_update, (level != split_shmem->backlight_level), &level, sizeof(level));
+    uint8_t level = is_backlight_enabled() ? get_backlight_level() : 0;
+    return sync_state(PUT_BACKLIGHT, &level);
 }
 
 static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -499,14 +608,15 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
 static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update = 0;
     rgblight_syncinfo_t rgblight_sync;
     rgblight_get_syncinfo(&rgblight_sync);
-    if (send_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
-        rgblight_clear_change_flags();
-    } else {
+    if (!sync_state_if(PUT_RGBLIGHT, (rgblight_sync.status.change_flags != 0), &rgblight_sync)) {
         return false;
     }
+    // Deferred changes keep their flags for the next cycle
+    if (sync_state_sent(PUT_RGBLIGHT, &rgblight_sync)) {
+        rgblight_clear_change_flags();
+    }
     return true;
 }
 
@@ -541,11 +651,10 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
 static bool led_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update = 0;
     led_matrix_sync_t led_matrix_sync;
     memcpy(&led_matrix_sync.led_matrix, &led_matrix_eeconfig, sizeof(led_eeconfig_t));
     led_matrix_sync.led_suspend_state = led_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_LED_MATRIX, &last_update, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
+    return sync_state(PUT_LED_MATRIX, &led_matrix_sync);
 }
 
 static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -575,11 +684,10 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update = 0;
     rgb_matrix_sync_t rgb_matrix_sync;
     memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+    return sync_state(PUT_RGB_MATRIX, &rgb_matrix_sync);
 }
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -608,19 +716,19 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
+// Only the unsmoothed estimate is synced, and each half smooths it locally
 static bool wpm_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         current_wpm = get_current_wpm();
-    return send_if_condition(PUT_WPM, &last_update, (current_wpm != split_shmem->current_wpm), &current_wpm, sizeof(current_wpm));
+    uint8_t target_wpm = get_target_wpm();
+    return sync_state(PUT_WPM, &target_wpm);
 }
 
 static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    set_current_wpm(split_shmem->current_wpm);
+    set_target_wpm(split_shmem->target_wpm);
 }
 
 #    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER(wpm)
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
-#    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
+#    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(target_wpm),
 
 #else // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
@@ -636,9 +744,8 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
 static bool oled_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update        = 0;
-    bool            current_oled_state = is_oled_on();
-    return send_if_condition(PUT_OLED, &last_update, (current_oled_state != split_shmem->current_oled_state), &current_oled_state, sizeof(current_oled_state));
+    uint8_t current_oled_state = is_oled_on();
+    return sync_state(PUT_OLED, &current_oled_state);
 }
 
 static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -671,9 +778,8 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
 static bool st7565_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update          = 0;
-    bool            current_st7565_state = st7565_is_on();
-    return send_if_condition(PUT_ST7565, &last_update, (current_st7565_state != split_shmem->current_st7565_state), &current_st7565_state, sizeof(current_st7565_state));
+    uint8_t current_st7565_state = st7565_is_on();
+    return sync_state(PUT_ST7565, &current_st7565_state);
 }
 
 static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -715,20 +821,14 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
         return true;
     }
 #    endif
-    static uint32_t last_update     = 0;
-    static uint32_t last_cpi_update = 0;
-    static uint16_t last_cpi        = 0;
+    static uint32_t last_update = 0;
     report_mouse_t  temp_state;
     uint16_t        temp_cpi;
     bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
     if (okay) pointing_device_set_shared_report(temp_state);
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
-        split_shmem->pointing.cpi = temp_cpi;
-        okay                      = send_if_condition(PUT_POINTING_CPI, &last_cpi_update, last_cpi != temp_cpi, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi));
-        if (okay) {
-            last_cpi = temp_cpi;
-        }
+        okay = sync_state(PUT_POINTING_CPI, &temp_cpi);
     }
     return okay;
 }
@@ -821,15 +921,17 @@ uint8_t                split_haptic_play = 0xFF;
 extern haptic_config_t haptic_config;
 
 static bool haptic_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t           last_update = 0;
     split_slave_haptic_sync_t haptic_sync;
 
     memcpy(&haptic_sync.haptic_config, &haptic_config, sizeof(haptic_config_t));
     haptic_sync.haptic_play = split_haptic_play;
 
-    bool okay = send_if_data_mismatch(PUT_HAPTIC, &last_update, &haptic_sync, &split_shmem->haptic_sync, sizeof(haptic_sync));
+    bool okay = sync_state(PUT_HAPTIC, &haptic_sync);
 
-    split_haptic_play = 0xFF;
+    // A deferred play request is kept for the next cycle
+    if (sync_state_sent(PUT_HAPTIC, &haptic_sync)) {
+        split_haptic_play = 0xFF;
+    }
 
     return okay;
 }
@@ -860,12 +962,11 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 #if defined(SPLIT_ACTIVITY_ENABLE)
 
 static bool activity_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t             last_update = 0;
     split_slave_activity_sync_t activity_sync;
     activity_sync.matrix_timestamp          = last_matrix_activity_time();
     activity_sync.encoder_timestamp         = last_encoder_activity_time();
     activity_sync.pointing_device_timestamp = last_pointing_device_activity_time();
-    return send_if_data_mismatch(PUT_ACTIVITY, &last_update, &activity_sync, &split_shmem->activity_sync, sizeof(activity_sync));
+    return sync_state(PUT_ACTIVITY, &activity_sync);
 }
 
 static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -892,10 +993,8 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
 static bool detected_os_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_detected_os_update = 0;
-    os_variant_t    detected_os             = detected_host_os();
-    bool            okay                    = send_if_condition(PUT_DETECTED_OS, &last_detected_os_update, (detected_os != split_shmem->detected_os), &detected_os, sizeof(os_variant_t));
-    return okay;
+    os_variant_t detected_os = detected_host_os();
+    return sync_state(PUT_DETECTED_OS, &detected_os);
 }
 
 static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -914,6 +1013,84 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Batched frames
+
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+
+static bool batch_prefetch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_batch_checksums_t checksums;
+    batch_prefetched = 0;
+    if (!transaction_execute_now(GET_BATCH_CHECKSUMS, NULL, 0, &checksums, sizeof(checksums))) {
+        return false;
+    }
+
+    // Land each checksum where its own transaction would have put it
+    split_shmem->smatrix.checksum = checksums.smatrix;
+    batch_prefetched |= (uint32_t)1 << GET_SLAVE_MATRIX_CHECKSUM;
+#    ifdef ENCODER_ENABLE
+    split_shmem->encoders.checksum = checksums.encoders;
+    batch_prefetched |= (uint32_t)1 << GET_ENCODERS_CHECKSUM;
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    split_shmem->pointing.checksum = checksums.pointing;
+    batch_prefetched |= (uint32_t)1 << GET_POINTING_CHECKSUM;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    return true;
+}
+
+static bool batch_flush_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    return batch_flush();
+}
+
+static void batch_checksums_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_batch_checksums_t *checksums = (split_batch_checksums_t *)target2initiator_buffer;
+    checksums->smatrix                 = split_shmem->smatrix.checksum;
+#    ifdef ENCODER_ENABLE
+    checksums->encoders = split_shmem->encoders.checksum;
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    checksums->pointing = split_shmem->pointing.checksum;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+}
+
+// Unpacks the frame as if each transaction in it had arrived on its own
+static void batch_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_batch_sync_t *frame  = (const split_batch_sync_t *)initiator2target_buffer;
+    uint8_t                   length = MIN(frame->length, initiator2target_buffer_size - 1);
+    for (uint8_t i = 0; i < length;) {
+        int8_t id = frame->data[i++];
+        if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS || id == PUT_BATCH || id == PUT_BATCH_HALF || id == PUT_BATCH_QUARTER) {
+            return;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (trans->initiator2target_buffer_size == 0 || i + trans->initiator2target_buffer_size > length) {
+            return;
+        }
+        memcpy(split_trans_initiator2target_buffer(trans), &frame->data[i], trans->initiator2target_buffer_size);
+        i += trans->initiator2target_buffer_size;
+        if (trans->slave_callback) {
+            trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        }
+    }
+}
+
+#    define TRANSACTIONS_BATCH_PREFETCH_MASTER() TRANSACTION_HANDLER_MASTER(batch_prefetch)
+#    define TRANSACTIONS_BATCH_FLUSH_MASTER() TRANSACTION_HANDLER_MASTER(batch_flush)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+        [PUT_BATCH]           = trans_initiator2target_initializer_cb(batch, batch_slave_callback), \
+        [PUT_BATCH_HALF]      = trans_initiator2target_initializer_size_cb(batch, 1 + SPLIT_TRANSACTION_BATCH_SIZE / 2, batch_slave_callback), \
+        [PUT_BATCH_QUARTER]   = trans_initiator2target_initializer_size_cb(batch, 1 + SPLIT_TRANSACTION_BATCH_SIZE / 4, batch_slave_callback), \
+        [GET_BATCH_CHECKSUMS] = trans_target2initiator_initializer_cb(batch_checksums, batch_checksums_slave_callback),
+
+#else // SPLIT_TRANSACTION_BATCH_ENABLE
+
+#    define TRANSACTIONS_BATCH_PREFETCH_MASTER()
+#    define TRANSACTIONS_BATCH_FLUSH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -944,6 +1121,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -954,10 +1132,17 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
-bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+static bool transactions_master_cycle(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // Input first, so that no amount of state to sync holds up the next key press
+    sync_budget = UINT16_MAX;
+    TRANSACTIONS_BATCH_PREFETCH_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
+    TRANSACTIONS_POINTING_MASTER();
+
+    sync_budget = SPLIT_TRANSACTION_BUDGET;
+    TRANSACTIONS_WATCHDOG_MASTER();
     TRANSACTIONS_SYNC_TIMER_MASTER();
     TRANSACTIONS_LAYER_STATE_MASTER();
     TRANSACTIONS_LED_STATE_MASTER();
@@ -969,14 +1154,26 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_WPM_MASTER();
     TRANSACTIONS_OLED_MASTER();
     TRANSACTIONS_ST7565_MASTER();
-    TRANSACTIONS_POINTING_MASTER();
-    TRANSACTIONS_WATCHDOG_MASTER();
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_FLUSH_MASTER();
+    split_telemetry_task();
     return true;
 }
 
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+    // Only the master's own cycle is batched, RPCs from elsewhere go straight out
+    batch_open = true;
+    bool okay  = transactions_master_cycle(master_matrix, slave_matrix);
+    batch_open = false;
+    return okay;
+#else
+    return transactions_master_cycle(master_matrix, slave_matrix);
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+}
+
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
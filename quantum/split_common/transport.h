@@ -132,6 +132,28 @@ typedef struct _split_slave_activity_sync_t {
 } split_slave_activity_sync_t;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+#    ifndef SPLIT_TRANSACTION_BATCH_SIZE
+#        define SPLIT_TRANSACTION_BATCH_SIZE 24
+#    endif // SPLIT_TRANSACTION_BATCH_SIZE
+
+// Transaction ID then payload, for each master to slave transaction packed into the frame
+typedef struct _split_batch_sync_t {
+    uint8_t length;
+    uint8_t data[SPLIT_TRANSACTION_BATCH_SIZE];
+} split_batch_sync_t;
+
+typedef struct _split_batch_checksums_t {
+    uint8_t smatrix;
+#    ifdef ENCODER_ENABLE
+    uint8_t encoders;
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    uint8_t pointing;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+} split_batch_checksums_t;
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 typedef struct _rpc_sync_info_t {
     uint8_t checksum;
@@ -195,7 +217,7 @@ typedef struct _split_shared_memory_t {
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
-    uint8_t current_wpm;
+    uint8_t target_wpm;
 #endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
@@ -222,6 +244,11 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+    split_batch_sync_t      batch;
+    split_batch_checksums_t batch_checksums;
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
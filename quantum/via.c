@@ -33,6 +33,22 @@
 #include "wait.h"
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
 
+#if defined(VIA_BULK_TRANSFER_ENABLE)
+#    include "bulk_transfer.h"
+#endif
+
+#if defined(EEPROM_WRITE_CACHE_ENABLE)
+#    include "eeprom_write_cache.h"
+#endif
+
+#if defined(RGB_MATRIX_STREAM_ENABLE)
+#    include "led_stream.h"
+#endif
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TELEMETRY_ENABLE)
+#    include "split_telemetry.h"
+#endif
+
 #if defined(AUDIO_ENABLE)
 #    include "audio.h"
 #endif
@@ -269,6 +285,16 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     via_custom_value_command_kb(data, length);
 }
 
+#if defined(VIA_BULK_TRANSFER_ENABLE)
+static const bulk_transfer_region_t via_bulk_transfer_regions[] = {
+    [id_bulk_transfer_keymap] = {dynamic_keymap_get_buffer_size, dynamic_keymap_get_buffer, dynamic_keymap_set_buffer},
+    [id_bulk_transfer_macros] = {dynamic_keymap_macro_get_buffer_size, dynamic_keymap_macro_get_buffer, dynamic_keymap_macro_set_buffer},
+#    ifdef ENCODER_MAP_ENABLE
+    [id_bulk_transfer_encoders] = {dynamic_keymap_encoder_get_buffer_size, dynamic_keymap_encoder_get_buffer, dynamic_keymap_encoder_set_buffer},
+#    endif
+};
+#endif // VIA_BULK_TRANSFER_ENABLE
+
 // Keyboard level code can override this, but shouldn't need to.
 // Controlling custom features should be done by overriding
 // via_custom_value_command_kb() instead.
@@ -448,6 +474,43 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             break;
         }
 #endif
+#if defined(VIA_BULK_TRANSFER_ENABLE)
+        case id_bulk_transfer_begin: {
+            uint8_t region = command_data[0];
+            bulk_transfer_begin(data, region < ARRAY_SIZE(via_bulk_transfer_regions) ? &via_bulk_transfer_regions[region] : NULL);
+            break;
+        }
+        case id_bulk_transfer_data: {
+            // Writes are only acknowledged once per window, reads have already been streamed back
+            if (!bulk_transfer_data(data, length, raw_hid_send)) {
+                return;
+            }
+            break;
+        }
+        case id_bulk_transfer_end: {
+            if (bulk_transfer_end(data) == BULK_TRANSFER_OK) {
+#    if defined(EEPROM_WRITE_CACHE_ENABLE)
+                eeprom_write_cache_flush();
+#    endif
+            }
+            break;
+        }
+#endif // VIA_BULK_TRANSFER_ENABLE
+#if defined(RGB_MATRIX_STREAM_ENABLE)
+        case id_led_stream: {
+            // Frame data is not acknowledged, only info and commits that ask for it reply
+            if (!led_stream_receive(data, length)) {
+                return;
+            }
+            break;
+        }
+#endif // RGB_MATRIX_STREAM_ENABLE
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TELEMETRY_ENABLE)
+        case id_split_telemetry: {
+            split_telemetry_receive(data, length);
+            break;
+        }
+#endif // defined(SPLIT_KEYBOARD) && defined(SPLIT_TELEMETRY_ENABLE)
         default: {
             // The command ID is not known
             // Return the unhandled state
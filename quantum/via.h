@@ -96,6 +96,16 @@ enum via_command_id {
     id_unhandled                            = 0xFF,
 };
 
+// QMK extensions to the VIA protocol, only handled when their feature is enabled. These IDs are QMK-local: VIA does
+// not reserve 0xE0-0xEF, and VIA_PROTOCOL_VERSION does not cover them.
+enum via_vendor_command_id {
+    id_bulk_transfer_begin = 0xE0,
+    id_bulk_transfer_data  = 0xE1,
+    id_bulk_transfer_end   = 0xE2,
+    id_led_stream          = 0xE3,
+    id_split_telemetry     = 0xE4,
+};
+
 enum via_keyboard_value_id {
     id_uptime              = 0x01,
     id_layout_options      = 0x02,
@@ -104,6 +114,12 @@ enum via_keyboard_value_id {
     id_device_indication   = 0x05,
 };
 
+enum via_bulk_transfer_region_id {
+    id_bulk_transfer_keymap   = 0x00,
+    id_bulk_transfer_macros   = 0x01,
+    id_bulk_transfer_encoders = 0x02,
+};
+
 enum via_channel_id {
     id_custom_channel         = 0,
     id_qmk_backlight_channel  = 1,
@@ -166,6 +182,7 @@ void     via_set_layout_options_kb(uint32_t value);
 void via_set_device_indication(uint8_t value);
 
 // Called by QMK core to process VIA-specific keycodes.
+#define PROCESS_RECORD_VIA_KEYCODES QK_MACRO, QK_MACRO_MAX
 bool process_record_via(uint16_t keycode, keyrecord_t *record);
 
 // These are made external so that keyboard level custom value handlers can use them.
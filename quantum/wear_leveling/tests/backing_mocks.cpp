@@ -23,6 +23,7 @@ void MockBackingStore::reset_instance() {
     backing_erase_invoke_count  = 0;
     backing_write_invoke_count  = 0;
     backing_lock_invoke_count   = 0;
+    backing_read_invoke_count   = 0;
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
@@ -122,6 +123,17 @@ bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const
     std::size_t index = address / BACKING_STORE_WRITE_SIZE;
     value             = ~backing_storage[index].get();
 
+    ++backing_read_invoke_count;
+    return true;
+}
+
+bool MockBackingStore::read_bulk(uint32_t address, backing_store_int_t* values, std::size_t item_count) const {
+    // A bulk read is a single transaction on the backing store, regardless of the number of items
+    std::uint64_t read_count = backing_read_invoke_count;
+    for (std::size_t i = 0; i < item_count; ++i) {
+        read(address + (i * BACKING_STORE_WRITE_SIZE), values[i]);
+    }
+    backing_read_invoke_count = read_count + 1;
     return true;
 }
 
@@ -152,3 +164,7 @@ extern "C" bool backing_store_lock(void) {
 extern "C" bool backing_store_read(uint32_t address, backing_store_int_t* value) {
     return MockBackingStore::Instance().read(address, *value);
 }
+
+extern "C" bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) {
+    return MockBackingStore::Instance().read_bulk(address, values, item_count);
+}
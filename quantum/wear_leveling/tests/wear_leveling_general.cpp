@@ -202,3 +202,107 @@ TEST_F(WearLevelingGeneral, WriteFailure_NoSubsequentWrites) {
     wear_leveling_read(0x04, &test_val, sizeof(test_val));
     EXPECT_EQ(test_val, 0x14) << "Readback should come from cache regardless of unlock failure";
 }
+
+/**
+ * This test verifies that background consolidation does nothing while the write log usage is below the threshold.
+ */
+TEST_F(WearLevelingGeneral, BackgroundConsolidation_BelowThreshold) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t test_val = 0x14;
+    EXPECT_EQ(wear_leveling_write(0x02, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    EXPECT_EQ(wear_leveling_consolidate_background(), WEAR_LEVELING_SUCCESS) << "Background consolidation should not have occurred";
+
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Erase should not have been invoked";
+    EXPECT_EQ(inst.unlock_invoke_count(), 1) << "Unlock should have been invoked once, for the write";
+    EXPECT_EQ(inst.lock_invoke_count(), 1) << "Lock should have been invoked once, for the write";
+}
+
+/**
+ * This test verifies that failed background consolidation is not retried on every call -- only once a new write has
+ * been made.
+ */
+TEST_F(WearLevelingGeneral, BackgroundConsolidation_FailureBacksOff) {
+    auto&                 inst  = MockBackingStore::Instance();
+    constexpr std::size_t slots = (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8) / BACKING_STORE_WRITE_SIZE;
+    constexpr std::size_t fill  = (slots * WEAR_LEVELING_BACKGROUND_CONSOLIDATION_THRESHOLD + 99) / 100;
+
+    // Fill the write log up to the threshold, one single-slot entry per write
+    for (std::size_t i = 0; i < fill; ++i) {
+        uint8_t test_val = 0x20 + i;
+        EXPECT_EQ(wear_leveling_write(i % WEAR_LEVELING_LOGICAL_SIZE, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    }
+
+    bool erase_ok = false;
+    inst.set_erase_callback([&erase_ok](std::uint64_t count) { return erase_ok; });
+    EXPECT_EQ(wear_leveling_consolidate_background(), WEAR_LEVELING_FAILED) << "Background consolidation should have failed";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Erase should have been invoked once";
+    EXPECT_TRUE(inst.is_locked()) << "Backing store should have been locked again";
+
+    erase_ok = true;
+    EXPECT_EQ(wear_leveling_consolidate_background(), WEAR_LEVELING_FAILED) << "Background consolidation should not have been retried";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Erase should not have been invoked again";
+
+    uint8_t test_val = 0x55;
+    EXPECT_EQ(wear_leveling_write(0x02, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    EXPECT_EQ(wear_leveling_consolidate_background(), WEAR_LEVELING_CONSOLIDATED) << "Background consolidation should have been retried after the write";
+    EXPECT_EQ(inst.erase_invoke_count(), 2) << "Erase should have been invoked again";
+}
+
+/**
+ * This test verifies that background consolidation moves the erase out of the write path -- once consolidated while idle,
+ * the full write log is available again before any write needs to consolidate.
+ */
+TEST_F(WearLevelingGeneral, BackgroundConsolidation_AboveThreshold) {
+    auto&                 inst  = MockBackingStore::Instance();
+    constexpr std::size_t slots = (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8) / BACKING_STORE_WRITE_SIZE;
+    constexpr std::size_t fill  = (slots * WEAR_LEVELING_BACKGROUND_CONSOLIDATION_THRESHOLD + 99) / 100;
+
+    // Fill the write log up to the threshold, one single-slot entry per write
+    for (std::size_t i = 0; i < fill; ++i) {
+        uint8_t test_val = 0x20 + i;
+        EXPECT_EQ(wear_leveling_write(i % WEAR_LEVELING_LOGICAL_SIZE, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Erase should not have been invoked yet";
+
+    EXPECT_EQ(wear_leveling_consolidate_background(), WEAR_LEVELING_CONSOLIDATED) << "Background consolidation should have occurred";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Erase should have been invoked once";
+    EXPECT_TRUE(inst.is_locked()) << "Backing store should have been locked again";
+    EXPECT_EQ(wear_leveling_consolidate_background(), WEAR_LEVELING_SUCCESS) << "Empty write log should not be consolidated again";
+
+    // Every slot of the write log is usable again before the next consolidation
+    for (std::size_t i = 0; i < slots - 1; ++i) {
+        uint8_t test_val = 0x80 + i;
+        EXPECT_EQ(wear_leveling_write(i % WEAR_LEVELING_LOGICAL_SIZE, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write should not have consolidated";
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "No further erase should have occurred";
+
+    // Data survives a reboot
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected;
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual;
+    wear_leveling_read(0, expected.data(), expected.size());
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init should have succeeded";
+    wear_leveling_read(0, actual.data(), actual.size());
+    EXPECT_EQ(expected, actual) << "Readback after init should match";
+}
+
+/**
+ * This test verifies that write log playback at boot reads the backing store in bulk rather than one entry at a time.
+ */
+TEST_F(WearLevelingGeneral, Playback_BulkReads) {
+    auto&                 inst  = MockBackingStore::Instance();
+    constexpr std::size_t slots = (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8) / BACKING_STORE_WRITE_SIZE;
+
+    for (std::size_t i = 0; i < slots - 2; ++i) {
+        uint8_t test_val = 0x40 + i;
+        EXPECT_EQ(wear_leveling_write(i % WEAR_LEVELING_LOGICAL_SIZE, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    }
+
+    std::uint64_t reads_before = inst.read_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init should have succeeded";
+    std::uint64_t boot_reads = inst.read_invoke_count() - reads_before;
+
+    // Consolidated area, its checksum, and then the write log in chunks of WEAR_LEVELING_PLAYBACK_READ_AHEAD entries
+    EXPECT_EQ(boot_reads, 2 + (slots + WEAR_LEVELING_PLAYBACK_READ_AHEAD - 1) / WEAR_LEVELING_PLAYBACK_READ_AHEAD) << "Unexpected number of backing store reads during init";
+    EXPECT_LT(boot_reads, slots - 2) << "Playback should need fewer reads than there are log entries";
+}
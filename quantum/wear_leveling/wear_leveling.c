@@ -162,6 +162,7 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+    bool                                                           background_failed;
 } wear_leveling;
 
 /**
@@ -469,18 +470,49 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Read-ahead buffer used while replaying the write log.
+ */
+typedef struct wear_leveling_read_ahead_t {
+    backing_store_int_t values[(WEAR_LEVELING_PLAYBACK_READ_AHEAD)];
+    uint32_t            address; // backing store address of values[0]
+    uint32_t            count;   // number of valid entries in values
+} wear_leveling_read_ahead_t;
+
+/**
+ * Reads a single write log entry, refilling the read-ahead buffer with backing_store_read_bulk() when needed.
+ * Drivers with an optimised bulk read (SPI flash, RP2040) then fetch the log in a handful of transactions at boot.
+ */
+static bool wear_leveling_playback_read(wear_leveling_read_ahead_t *read_ahead, uint32_t address, backing_store_int_t *value) {
+    if (address < read_ahead->address || address >= read_ahead->address + read_ahead->count * (BACKING_STORE_WRITE_SIZE)) {
+        uint32_t count = ((WEAR_LEVELING_BACKING_SIZE) - address) / (BACKING_STORE_WRITE_SIZE);
+        if (count > (WEAR_LEVELING_PLAYBACK_READ_AHEAD)) {
+            count = (WEAR_LEVELING_PLAYBACK_READ_AHEAD);
+        }
+        read_ahead->count = 0;
+        if (!backing_store_read_bulk(address, read_ahead->values, count)) {
+            return false;
+        }
+        read_ahead->address = address;
+        read_ahead->count   = count;
+    }
+    *value = read_ahead->values[(address - read_ahead->address) / (BACKING_STORE_WRITE_SIZE)];
+    return true;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
 static wear_leveling_status_t wear_leveling_playback_log(void) {
     wl_dprintf("Playback write log\n");
 
-    wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
-    bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling_status_t     status          = WEAR_LEVELING_SUCCESS;
+    bool                       cancel_playback = false;
+    uint32_t                   address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling_read_ahead_t read_ahead      = {.count = 0};
     while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_playback_read(&read_ahead, address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -509,7 +541,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_playback_read(&read_ahead, address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -529,7 +561,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_playback_read(&read_ahead, address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -539,7 +571,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_playback_read(&read_ahead, address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -550,7 +582,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_playback_read(&read_ahead, address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -619,6 +651,7 @@ wear_leveling_status_t wear_leveling_init(void) {
 
     // Reset the cache
     wear_leveling_clear_cache();
+    wear_leveling.background_failed = false;
 
     // Initialise the backing store
     if (!backing_store_init()) {
@@ -645,6 +678,45 @@ wear_leveling_status_t wear_leveling_init(void) {
     return status;
 }
 
+/**
+ * Consolidates early if the write log usage is above WEAR_LEVELING_BACKGROUND_CONSOLIDATION_THRESHOLD.
+ * Once it has failed, it is not retried until the next write.
+ */
+wear_leveling_status_t wear_leveling_consolidate_background(void) {
+    if (wear_leveling.background_failed) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    const uint32_t log_start = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    const uint32_t log_size  = (WEAR_LEVELING_BACKING_SIZE) - log_start;
+    if ((wear_leveling.write_address - log_start) * 100 < log_size * (WEAR_LEVELING_BACKGROUND_CONSOLIDATION_THRESHOLD)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Background consolidation\n");
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        wear_leveling.background_failed = true;
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_consolidate_force();
+
+    // Lock the backing store if we acquired the lock successfully
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    // Retrying straight away would most likely fail the same way, and erase the flash on every housekeeping pass
+    wear_leveling.background_failed = status == WEAR_LEVELING_FAILED;
+    return status;
+}
+
 /**
  * Wear-leveling erase.
  * Post-condition: any reads from the backing store directly after an erase operation must come back as zero.
@@ -688,6 +760,9 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return true;
     }
 
+    // A new write gives background consolidation another try
+    wear_leveling.background_failed = false;
+
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
@@ -4,6 +4,13 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+// Time without input activity, in milliseconds, before the housekeeping task attempts background consolidation
+#    ifndef WEAR_LEVELING_BACKGROUND_CONSOLIDATION_IDLE_TIME
+#        define WEAR_LEVELING_BACKGROUND_CONSOLIDATION_IDLE_TIME 5000
+#    endif
+#endif
+
 /**
  * @typedef Status returned from any wear-leveling API.
  */
@@ -52,3 +59,16 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Consolidates early if the write log is filling up.
+ *
+ * Consolidation erases and rewrites the backing store, which can stall for a long time on flash. Calling this while
+ * the keyboard is idle moves that stall out of the write path, so that a write made while typing rarely hits a full
+ * log. Nothing happens while write log usage is below WEAR_LEVELING_BACKGROUND_CONSOLIDATION_THRESHOLD percent.
+ * After a failure, nothing is attempted until the next write, so a failing backing store is not erased over and over.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED if consolidation occurred, WEAR_LEVELING_SUCCESS if it was not needed,
+ * WEAR_LEVELING_FAILED if it failed now or on the last attempt since the last write
+ */
+wear_leveling_status_t wear_leveling_consolidate_background(void);
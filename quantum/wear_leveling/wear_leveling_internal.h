@@ -61,10 +61,22 @@ typedef uint64_t backing_store_int_t;
         } while (0)
 #endif // WEAR_LEVELING_ASSERTS
 
+// Number of backing store entries fetched per bulk read while replaying the write log
+#ifndef WEAR_LEVELING_PLAYBACK_READ_AHEAD
+#    define WEAR_LEVELING_PLAYBACK_READ_AHEAD 16
+#endif
+
+// Write log usage, in percent, above which wear_leveling_consolidate_background() consolidates
+#ifndef WEAR_LEVELING_BACKGROUND_CONSOLIDATION_THRESHOLD
+#    define WEAR_LEVELING_BACKGROUND_CONSOLIDATION_THRESHOLD 75
+#endif
+
 // Compile-time validation of configurable options
 _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+_Static_assert(WEAR_LEVELING_PLAYBACK_READ_AHEAD > 0, "Playback read-ahead must be at least one entry");
+_Static_assert(WEAR_LEVELING_BACKGROUND_CONSOLIDATION_THRESHOLD > 0 && WEAR_LEVELING_BACKGROUND_CONSOLIDATION_THRESHOLD <= 100, "Background consolidation threshold must be a percentage between 1 and 100");
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
@@ -20,10 +20,15 @@
 #include "keycode.h"
 #include "quantum_keycodes.h"
 #include "action_util.h"
-#include <math.h>
+#include <string.h>
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_WPM_ENABLE)
+#    include "keyboard.h"
+#endif
 
 // WPM Stuff
 static uint8_t  current_wpm = 0;
+static uint8_t  target_wpm  = 0;
 static uint32_t wpm_timer   = 0;
 
 /* The WPM calculation works by specifying a certain number of 'periods' inside
@@ -34,11 +39,15 @@ static uint32_t wpm_timer   = 0;
  * of the ring buffer can be configured using the keymap configuration
  * value `WPM_SAMPLE_PERIODS`.
  *
+ * The sum is kept up to date as keys are counted and periods are recycled,
+ * and the estimate is only recalculated at those two points, so the main loop
+ * just checks for the end of the current period.
  */
 #define MAX_PERIODS (WPM_SAMPLE_PERIODS)
 #define PERIOD_DURATION (1000 * WPM_SAMPLE_SECONDS / MAX_PERIODS)
 
 static int16_t period_presses[MAX_PERIODS] = {0};
+static int32_t total_presses               = 0;
 static uint8_t current_period              = 0;
 static uint8_t periods                     = 1;
 
@@ -60,11 +69,32 @@ static uint8_t  next_wpm        = 0;
 
 void set_current_wpm(uint8_t new_wpm) {
     current_wpm = new_wpm;
+    target_wpm  = new_wpm;
+#if !defined(WPM_UNFILTERED)
+    prev_wpm = new_wpm;
+    next_wpm = new_wpm;
+#endif
 }
 uint8_t get_current_wpm(void) {
     return current_wpm;
 }
 
+/**
+ * @brief Sets the unsmoothed estimate, which the reported WPM then follows
+ *
+ * Used on the slave half of a split keyboard, which has no key presses of its own to count.
+ */
+void set_target_wpm(uint8_t new_wpm) {
+    target_wpm = new_wpm;
+}
+
+/**
+ * @brief Returns the unsmoothed estimate, which only changes on key presses and at the end of each period
+ */
+uint8_t get_target_wpm(void) {
+    return target_wpm;
+}
+
 bool wpm_keycode(uint16_t keycode) {
     return wpm_keycode_kb(keycode);
 }
@@ -107,45 +137,14 @@ __attribute__((weak)) uint8_t wpm_regress_count(uint16_t keycode) {
 }
 #endif
 
-// Outside 'raw' mode we smooth results over time.
-
-void update_wpm(uint16_t keycode) {
-    if (wpm_keycode(keycode) && period_presses[current_period] < INT16_MAX) {
-        period_presses[current_period]++;
-    }
-#if defined(WPM_ALLOW_COUNT_REGRESSION)
-    uint8_t regress = wpm_regress_count(keycode);
-    if (regress && period_presses[current_period] > INT16_MIN) {
-        period_presses[current_period]--;
-    }
-#endif
-}
-
-void decay_wpm(void) {
-    int32_t presses = period_presses[0];
-    for (int i = 1; i <= periods; i++) {
-        presses += period_presses[i];
-    }
+/**
+ * @brief Recalculates the estimate from the running sum
+ */
+static void wpm_estimate(void) {
+    int32_t presses = total_presses;
     if (presses < 0) {
         presses = 0;
     }
-    int32_t  elapsed  = timer_elapsed32(wpm_timer);
-    uint32_t duration = (((periods)*PERIOD_DURATION) + elapsed);
-    int32_t  wpm_now  = (60000 * presses) / (duration * WPM_ESTIMATED_WORD_SIZE);
-
-    if (wpm_now < 0) // set some reasonable WPM measurement limits
-        wpm_now = 0;
-    if (wpm_now > 240) wpm_now = 240;
-
-    if (elapsed > PERIOD_DURATION) {
-        current_period                 = (current_period + 1) % MAX_PERIODS;
-        period_presses[current_period] = 0;
-        periods                        = (periods < MAX_PERIODS - 1) ? periods + 1 : MAX_PERIODS - 1;
-        elapsed                        = 0;
-        wpm_timer                      = timer_read32();
-    }
-    if (presses < 2) // don't guess high WPM based on a single keypress.
-        wpm_now = 0;
 
 #if defined(WPM_LAUNCH_CONTROL)
     /*
@@ -156,23 +155,78 @@ void decay_wpm(void) {
      * has been filled.
      */
     if (presses == 0) {
-        current_period    = 0;
-        periods           = 0;
-        wpm_now           = 0;
-        period_presses[0] = 0;
+        memset(period_presses, 0, sizeof(period_presses));
+        total_presses  = 0;
+        current_period = 0;
+        periods        = 0;
+        target_wpm     = 0;
+        return;
     }
 #endif // WPM_LAUNCH_CONTROL
 
+    if (presses < 2) { // don't guess high WPM based on a single keypress.
+        target_wpm = 0;
+        return;
+    }
+
+    uint32_t duration = (periods * PERIOD_DURATION) + timer_elapsed32(wpm_timer);
+    if (duration == 0) {
+        duration = 1;
+    }
+    uint32_t wpm_now = (60000 * (uint32_t)presses) / (duration * WPM_ESTIMATED_WORD_SIZE);
+
+    // set some reasonable WPM measurement limits
+    target_wpm = wpm_now > 240 ? 240 : wpm_now;
+}
+
+void update_wpm(uint16_t keycode) {
+    int16_t presses = period_presses[current_period];
+    if (wpm_keycode(keycode) && period_presses[current_period] < INT16_MAX) {
+        period_presses[current_period]++;
+    }
+#if defined(WPM_ALLOW_COUNT_REGRESSION)
+    uint8_t regress = wpm_regress_count(keycode);
+    if (regress && period_presses[current_period] > INT16_MIN) {
+        period_presses[current_period]--;
+    }
+#endif
+    if (period_presses[current_period] != presses) {
+        total_presses += period_presses[current_period] - presses;
+        wpm_estimate();
+    }
+}
+
+// Outside 'raw' mode we smooth results over time.
+
+void decay_wpm(void) {
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_WPM_ENABLE)
+    // The slave half follows the estimate synced from the master
+    if (is_keyboard_master())
+#endif
+    {
+        if (timer_elapsed32(wpm_timer) > PERIOD_DURATION) {
+            current_period = (current_period + 1) % MAX_PERIODS;
+            total_presses -= period_presses[current_period];
+            period_presses[current_period] = 0;
+            periods                        = (periods < MAX_PERIODS - 1) ? periods + 1 : MAX_PERIODS - 1;
+            wpm_timer                      = timer_read32();
+            wpm_estimate();
+        }
+    }
+
 #if defined(WPM_UNFILTERED)
-    current_wpm = wpm_now;
+    current_wpm = target_wpm;
 #else
-    int32_t latency = timer_elapsed32(smoothing_timer);
+    uint32_t latency = timer_elapsed32(smoothing_timer);
     if (latency > LATENCY) {
         smoothing_timer = timer_read32();
         prev_wpm        = current_wpm;
-        next_wpm        = wpm_now;
+        next_wpm        = target_wpm;
+        latency         = 0;
     }
 
-    current_wpm = prev_wpm + (latency * ((int)next_wpm - (int)prev_wpm) / LATENCY);
+    if (prev_wpm != next_wpm) {
+        current_wpm = prev_wpm + ((int32_t)latency * ((int)next_wpm - (int)prev_wpm) / LATENCY);
+    }
 #endif
 }
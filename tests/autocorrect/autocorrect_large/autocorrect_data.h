@@ -0,0 +1,1119 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (500 entries):
+//   aadfruit       -> adafruit
+//   aboslute       -> absolute
+//   acceleraitng   -> accelerating
+//   accessbile     -> accessible
+//   accomplsihed   -> accomplished
+//   acheive        -> achieve
+//   actuaotrs      -> actuators
+//   adatper        -> adapter
+//   adealis        -> adelais
+//   adlhns         -> adhlns
+//   advretised     -> advertised
+//   afirca         -> africa
+//   ailsaie        -> alisaie
+//   aletrnative    -> alternative
+//   alinged        -> aligned
+//   alonsgide      -> alongside
+//   alternatievs   -> alternatives
+//   ammonut        -> ammount
+//   ancinet        -> ancient
+//   annuonce       -> announce
+//   anytihng       -> anything
+//   appearnace     -> appearance
+//   approcahing    -> approaching
+//   arcihve        -> archive
+//   arrnagement    -> arrangement
+//   asbolutely     -> absolutely
+//   asssitant      -> assistant
+//   atcuation      -> actuation
+//   attahcment     -> attachment
+//   augsut         -> august
+//   autoamte       -> automate
+//   avdantages     -> advantages
+//   aweosme        -> awesome
+//   backgorunds    -> backgrounds
+//   baiscs         -> basics
+//   barleycron     -> barleycorn
+//   baudrtae       -> baudrate
+//   beforeahnd     -> beforehand
+//   beignning      -> beginning
+//   beraks         -> breaks
+//   bidirectinoal  -> bidirectional
+//   birdge         -> bridge
+//   blackplil      -> blackpill
+//   blupeill       -> bluepill
+//   bonudary       -> boundary
+//   botoing        -> booting
+//   braikng        -> braking
+//   brekaage       -> breakage
+//   brigther       -> brighter
+//   brusihng       -> brushing
+//   buffres        -> buffers
+//   bundeld        -> bundled
+//   byteocde       -> bytecode
+//   caevats        -> caveats
+//   calcualte      -> calculate
+//   calngformat    -> clangformat
+//   cannonkyes     -> cannonkeys
+//   capsunolcked   -> capsunlocked
+//   catgeories     -> categories
+//   ccyled         -> cycled
+//   cenots         -> centos
+//   chaarcters     -> characters
+//   charatcers     -> characters
+//   checknig       -> checking
+//   chipest        -> chipset
+//   chormatic      -> chromatic
+//   chukns         -> chunks
+//   circutiry      -> circuitry
+//   claler         -> caller
+//   clicikng       -> clicking
+//   cloinng        -> cloning
+//   cluceard       -> cluecard
+//   cmopiledb      -> compiledb
+//   cnoduct        -> conduct
+//   cnotinues      -> continues
+//   codebsaes      -> codebases
+//   cofnlicts      -> conflicts
+//   collisoin      -> collision
+//   comapct        -> compact
+//   comlpetely     -> completely
+//   communicaiton  -> communication
+//   compatibliity  -> compatibility
+//   complciated    -> complicated
+//   comprehenisons -> comprehensions
+//   concetps       -> concepts
+//   configpasrer   -> configparser
+//   confuesd       -> confused
+//   conoslidating  -> consolidating
+//   consitsent     -> consistent
+//   constatns      -> constants
+//   contetxs       -> contexts
+//   contribuiton   -> contribution
+//   conuts         -> counts
+//   coolur         -> colour
+//   copmlex        -> complex
+//   correcetd      -> corrected
+//   cosntraining   -> constraining
+//   coutneract     -> counteract
+//   cpaability     -> capability
+//   crdeits        -> credits
+//   critiacl       -> critical
+//   ctaegory       -> category
+//   curiuos        -> curious
+//   customisatinos -> customisations
+//   cwofish        -> cowfish
+//   daattypes      -> datatypes
+//   danielggrodon  -> danielggordon
+//   dazlze         -> dazzle
+//   dcirect        -> dicrect
+//   dealys         -> delays
+//   decerased      -> decreased
+//   decortaor      -> decorator
+//   dedictaed      -> dedicated
+//   defianble      -> definable
+//   deilmited      -> delimited
+//   delgeate       -> delegate
+//   demuirge       -> demiurge
+//   depeer         -> deeper
+//   deprecatinos   -> deprecations
+//   describnig     -> describing
+//   desnity        -> density
+//   detphs         -> depths
+//   developnig     -> developing
+//   dgotag         -> dogtag
+//   dicrtion       -> dirction
+//   dievrged       -> diverged
+//   digkiey        -> digikey
+//   directievs     -> directives
+//   disapperaing   -> disappearing
+//   dislalow       -> disallow
+//   disregaredd    -> disregarded
+//   disucssed      -> discussed
+//   dleiberately   -> deliberately
+//   dnwokrs        -> dnworks
+//   dosctrings     -> docstrings
+//   doznes         -> dozens
+//   dreive         -> derive
+//   drsahna        -> drashna
+//   dsicordapp     -> discordapp
+//   ducdkuckgo     -> duckduckgo
+//   duplicatnig    -> duplicating
+//   dyanmically    -> dynamically
+//   earsing        -> erasing
+//   eceonfig       -> eeconfig
+//   ediotrs        -> editors
+//   efefctive      -> effective
+//   ehternet       -> ethernet
+//   elephnat       -> elephant
+//   elswehere      -> elsewhere
+//   emualtes       -> emulates
+//   encoedd        -> encoded
+//   enegry         -> energy
+//   ensrues        -> ensures
+//   environemnts   -> environments
+//   eraess         -> erases
+//   erorneous      -> erroneous
+//   esotnian       -> estonian
+//   etnire         -> entire
+//   evaluaiton     -> evaluation
+//   exaimning      -> examining
+//   excluedd       -> excluded
+//   exepnse        -> expense
+//   exisitnig      -> exisiting
+//   experiecne     -> experience
+//   expoesd        -> exposed
+//   extedned       -> extended
+//   extremley      -> extremely
+//   falesly        -> falsely
+//   fargments      -> fragments
+//   fcoused        -> focused
+//   felxible       -> flexible
+//   ficshl         -> fischl
+//   fileegn        -> filegen
+//   fingerrpint    -> fingerprint
+//   fitnses        -> fitness
+//   flasehd        -> flashed
+//   fliesystem     -> filesystem
+//   fluhses        -> flushes
+//   fniishes       -> finishes
+//   fokring        -> forking
+//   foregt         -> forget
+//   foucsing       -> focusing
+//   freeezs        -> freezes
+//   frmaes         -> frames
+//   froward        -> forward
+//   fuixup         -> fiuxup
+//   furtehst       -> furthest
+//   gambeuddy      -> gamebuddy
+//   geenralize     -> generalize
+//   geneiss        -> genesis
+//   geonowrks      -> geonworks
+//   giabaalnai     -> giabalanai
+//   giutar         -> guitar
+//   gloablly       -> globally
+//   gnigham        -> gingham
+//   gradeint       -> gradient
+//   gretaer        -> greater
+//   guadrs         -> guards
+//   gusesed        -> guessed
+//   hadrwired      -> hardwired
+//   handeld        -> handled
+//   hardawre       -> hardware
+//   hceomi         -> hecomi
+//   hedaer         -> header
+//   herrinbgone    -> herringbone
+//   higehr         -> higher
+//   hirgaana       -> hiragana
+//   hnadwire       -> handwire
+//   hoordowg       -> hoodrowg
+//   houeskeeping   -> housekeeping
+//   hubmert        -> humbert
+//   ibunda         -> ibnuda
+//   identifynig    -> identifying
+//   idoabo         -> idobao
+//   ignoers        -> ignores
+//   ilukmb         -> ilumkb
+//   imopssible     -> impossible
+//   imporitng      -> importing
+//   incepiton      -> inception
+//   incorportaes   -> incorporates
+//   indeexd        -> indexed
+//   indictaive     -> indicative
+//   inetger        -> integer
+//   infintiely     -> infinitely
+//   inhertiance    -> inheritance
+//   initialistaion -> initialisation
+//   injectoin      -> injection
+//   insatnt        -> instant
+//   instituetd     -> instituted
+//   integrtaion    -> integration
+//   intercepitng   -> intercepting
+//   interprteed    -> interpreted
+//   intimidtaed    -> intimidated
+//   intrsopection  -> introspection
+//   invoekd        -> invoked
+//   ipmlied        -> implied
+//   isntalling     -> installing
+//   itenmame       -> itemname
+//   itreate        -> iterate
+//   japnaese       -> japanese
+//   jonasafsler    -> jonasfasler
+//   jumipng        -> jumping
+//   kagizaryaa     -> kagizaraya
+//   kbfdans        -> kbdfans
+//   kerenl         -> kernel
+//   keyihve        -> keyhive
+//   kikolsab       -> kikoslab
+//   koalaficatinos -> koalafications
+//   kumaookbo      -> kumaokobo
+//   laenware       -> laneware
+//   laregst        -> largest
+//   layotus        -> layouts
+//   lcokups        -> lockups
+//   lefalabs       -> leaflabs
+//   lesstahn       -> lessthan
+//   lfitoff        -> liftoff
+//   liekly         -> likely
+//   liknig         -> liking
+//   linwroks       -> linworks
+//   llvmxetensions -> llvmextensions
+//   localohst      -> localhost
+//   looknig        -> looking
+//   lukcily        -> luckily
+//   macthing       -> matching
+//   maintians      -> maintains
+//   manaegable     -> manageable
+//   maniuplations  -> manipulations
+//   masekd         -> masked
+//   maxiftlerouput -> maxfitlerouput
+//   mcsleec        -> mcselec
+//   meanitme       -> meantime
+//   mechnaics      -> mechanics
+//   meloides       -> melodies
+//   mesmet         -> memset
+//   micrdop        -> micdrop
+//   migraitng      -> migrating
+//   miniimse       -> minimise
+//   mirrroing      -> mirroring
+//   mitigaets      -> mitigates
+//   mmcuffin       -> mcmuffin
+//   mniimise       -> minimise
+//   modfiiable     -> modifiable
+//   modluation     -> modulation
+//   moitvations    -> motivations
+//   monstragear    -> monstargear
+//   mounetd        -> mounted
+//   mreely         -> merely
+//   msotly         -> mostly
+//   mulitbuild     -> multibuild
+//   multipleexr    -> multiplexer
+//   muutally       -> mutually
+//   naivgating     -> navigating
+//   ncikibs        -> nckiibs
+//   neewst         -> newest
+//   nesetd         -> nested
+//   ngihtly        -> nightly
+//   nixkpgs        -> nixpkgs
+//   noitng         -> noting
+//   nothnig        -> nothing
+//   npsepars       -> npspears
+//   numbeerd       -> numbered
+//   nxoary         -> noxary
+//   obtian         -> obtain
+//   ocpode         -> opcode
+//   oeprations     -> operations
+//   offneding      -> offending
+//   oledunedr      -> oledunder
+//   opeartion      -> operation
+//   opitmal        -> optimal
+//   optiimzations  -> optimizations
+//   ordinraily     -> ordinarily
+//   orthgoraph     -> orthograph
+//   otpion         -> option
+//   outwadrly      -> outwardly
+//   overirding     -> overriding
+//   overwrtie      -> overwrite
+//   paarllel       -> parallel
+//   painetr        -> painter
+//   paltform       -> platform
+//   pargma         -> pragma
+//   passwodrs      -> passwords
+//   pcakrat        -> packrat
+//   peioribsoards  -> peiorisboards
+//   perecnt        -> percent
+//   peripehrals    -> peripherals
+//   pertend        -> pretend
+//   phraess        -> phrases
+//   pinhweel       -> pinwheel
+//   pirvate        -> private
+//   playabck       -> playback
+//   plsatic        -> plastic
+//   pnptuil        -> pnputil
+//   polartiy       -> polarity
+//   porblem        -> problem
+//   posisble       -> possible
+//   potnetial      -> potential
+//   practcially    -> practically
+//   precaclulated  -> precalculated
+//   preferneces    -> preferences
+//   prepaerd       -> prepared
+//   prevenetd      -> prevented
+//   prinetr        -> printer
+//   prmiarily      -> primarily
+//   procsesing     -> processing
+//   progarmmed     -> programmed
+//   projetcs       -> projects
+//   proprely       -> properly
+//   prpeare        -> prepare
+//   prviileged     -> privileged
+//   ptahlib        -> pathlib
+//   pulilng        -> pulling
+//   purpsoe        -> purpose
+//   qaulity        -> quality
+//   qmkrul         -> qmkurl
+//   questioend     -> questioned
+//   radnom         -> random
+//   raidus         -> radius
+//   rapdily        -> rapidly
+//   rbease         -> rebase
+//   rcetangles     -> rectangles
+//   readolny       -> readonly
+//   reaodnly       -> readonly
+//   receivnig      -> receiving
+//   recommeedd     -> recommeded
+//   recusrive      -> recursive
+//   redundnat      -> redundant
+//   refeered       -> refereed
+//   regadring      -> regarding
+//   regulaetd      -> regulated
+//   reisstors      -> resistors
+//   relaly         -> really
+//   relocatnig     -> relocating
+//   remembres      -> remembers
+//   reocmpilation  -> recompilation
+//   repaets        -> repeats
+//   replictaes     -> replicates
+//   reprses        -> repress
+//   rerpoducing    -> reproducing
+//   resopnsibility -> responsibility
+//   ressitor       -> resistor
+//   retainnig      -> retaining
+//   retsricted     -> restricted
+//   revieewr       -> reviewer
+//   rgbilght       -> rgblight
+//   righhtand      -> righthand
+//   rleiably       -> reliably
+//   rnuoff         -> runoff
+//   romanain       -> romanian
+//   rpeairing      -> repairing
+//   rseistant      -> resistant
+//   rterieves      -> retrieves
+//   rveision       -> revision
+//   saefty         -> safety
+//   samhcoevar     -> samhocevar
+//   satggering     -> staggering
+//   satuartion     -> saturation
+//   scailng        -> scaling
+//   sceure         -> secure
+//   scralet        -> scarlet
+//   sdtlayout      -> stdlayout
+//   seelcted       -> selected
+//   sekwed         -> skewed
+//   senosr         -> sensor
+//   sepcified      -> specified
+//   serbain        -> serbian
+//   serviicng      -> servicing
+//   seucrity       -> security
+//   sgements       -> segments
+//   shcottky       -> schottky
+//   shoretd        -> shorted
+//   shpaed         -> shaped
+//   sidetsep       -> sidestep
+//   siheld         -> shield
+//   similialry     -> similiarly
+//   sinajnu        -> sinanju
+//   sivlery        -> silvery
+//   skulldyazed    -> skullydazed
+//   sloenoids      -> solenoids
+//   slvoak         -> slovak
+//   smokla         -> smolka
+//   snippres       -> snippers
+//   soguht         -> sought
+//   solwer         -> slower
+//   sotfware       -> software
+//   spaceamn       -> spaceman
+//   specifeid      -> specified
+//   spekaer        -> speaker
+//   splniky        -> splinky
+//   spuerseeds     -> superseeds
+//   squrae         -> square
+//   srtives        -> strives
+//   stactkrace     -> stacktrace
+//   standadrise    -> standardise
+//   stateemnts     -> statements
+//   stcikandgum    -> stickandgum
+//   stenograpehrs  -> stenographers
+//   stickangdum    -> stickandgum
+//   stnading       -> standing
+//   streapmad      -> streampad
+//   stronegr       -> stronger
+//   stubmled       -> stumbled
+//   subhcain       -> subchain
+//   suboflder      -> subfolder
+//   subtsrings     -> substrings
+//   sufraces       -> surfaces
+//   sunsetetr      -> sunsetter
+//   supesreeds     -> superseeds
+//   supreseeds     -> superseeds
+//   susatin        -> sustain
+//   svilnky        -> svlinky
+//   swordfsih      -> swordfish
+//   symemtric      -> symmetric
+//   syserq         -> sysreq
+//   tahnks         -> thanks
+//   tardestation   -> tradestation
+//   tcehnologies   -> technologies
+//   tehdogkeyboard -> thedogkeyboard
+//   temporray      -> temporary
+//   tesltist       -> testlist
+//   theerby        -> thereby
+//   thiknpad       -> thinkpad
+//   threes         -> theres
+//   tigther        -> tighter
+//   tinypritnf     -> tinyprintf
+//   tmeplate       -> template
+//   toggilng       -> toggling
+//   toruble        -> trouble
+//   tpyical        -> typical
+//   traiilng       -> trailing
+//   transformatoin -> transformation
+//   transoprt      -> transport
+//   trcaks         -> tracks
+//   trikcy         -> tricky
+//   troubelshoot   -> troubleshoot
+//   tunnig         -> tuning
+//   twinlke        -> twinkle
+//   typnig         -> typing
+//   udnerstanding  -> understanding
+//   uitlisation    -> utilisation
+//   unavailbale    -> unavailable
+//   undersatnding  -> understanding
+//   unedrglow      -> underglow
+//   unfrotunately  -> unfortunately
+//   univerasl      -> universal
+//   unolad         -> unload
+//   unsnet         -> unsent
+//   unxamal        -> unxmaal
+//   upsteraming    -> upstreaming
+//   usbsap         -> usbasp
+//   utiilties      -> utilities
+//   vagarnt        -> vagrant
+//   varabile       -> varaible
+//   vdieos         -> videos
+//   verifeid       -> verified
+//   vibarte        -> vibrate
+//   vinatge        -> vintage
+//   visuasltudio   -> visualstudio
+//   vloume         -> volume
+//   vraious        -> various
+//   waevshare      -> waveshare
+
+#define AUTOCORRECT_MIN_LENGTH 6 // "adlhns"
+#define AUTOCORRECT_MAX_LENGTH 14 // "comprehenisons"
+#define DICTIONARY_SIZE 9314
+#define AUTOCORRECT_OFFSET_SIZE 3
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x44, 0x5D, 0x00, 0x00, 0x05, 0xD2, 0x00, 0x00, 0x06, 0x1A, 0x01, 0x00, 0x07, 0x6A, 0x01, 0x00,
+    0x08, 0xFC, 0x05, 0x00, 0x09, 0xCE, 0x0A, 0x00, 0x0A, 0x06, 0x0B, 0x00, 0x0B, 0x21, 0x0F, 0x00,
+    0x0C, 0x5A, 0x0F, 0x00, 0x0E, 0x7F, 0x0F, 0x00, 0x0F, 0xA0, 0x0F, 0x00, 0x10, 0xAB, 0x10, 0x00,
+    0x11, 0x3E, 0x11, 0x00, 0x12, 0xA6, 0x13, 0x00, 0x13, 0xF8, 0x13, 0x00, 0x14, 0x50, 0x14, 0x00,
+    0x15, 0x5B, 0x14, 0x00, 0x16, 0x30, 0x16, 0x00, 0x17, 0xAB, 0x1D, 0x00, 0x18, 0x9B, 0x20, 0x00,
+    0x1A, 0xA7, 0x20, 0x00, 0x1B, 0xCE, 0x20, 0x00, 0x1C, 0xDC, 0x20, 0x00, 0x00, 0x44, 0x76, 0x00,
+    0x00, 0x06, 0x84, 0x00, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x0F, 0x9A, 0x00, 0x00, 0x10, 0xA4, 0x00,
+    0x00, 0x11, 0xB0, 0x00, 0x00, 0x00, 0x1C, 0x15, 0x04, 0x1D, 0x0C, 0x0A, 0x04, 0x0E, 0x00, 0x82,
+    0x61, 0x79, 0x61, 0x00, 0x15, 0x0C, 0x09, 0x04, 0x00, 0x83, 0x72, 0x69, 0x63, 0x61, 0x00, 0x11,
+    0x18, 0x05, 0x0C, 0x00, 0x83, 0x6E, 0x75, 0x64, 0x61, 0x00, 0x0E, 0x12, 0x10, 0x16, 0x00, 0x82,
+    0x6C, 0x6B, 0x61, 0x00, 0x0A, 0x15, 0x04, 0x13, 0x00, 0x84, 0x72, 0x61, 0x67, 0x6D, 0x61, 0x00,
+    0x44, 0xB9, 0x00, 0x00, 0x0B, 0xC6, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x15, 0x0C, 0x0B, 0x00, 0x84,
+    0x61, 0x67, 0x61, 0x6E, 0x61, 0x00, 0x04, 0x16, 0x15, 0x07, 0x00, 0x84, 0x61, 0x73, 0x68, 0x6E,
+    0x61, 0x00, 0x44, 0xE3, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0C, 0x02, 0x01, 0x00, 0x10, 0x10,
+    0x01, 0x00, 0x00, 0x16, 0x0F, 0x12, 0x0E, 0x0C, 0x0E, 0x00, 0x83, 0x73, 0x6C, 0x61, 0x62, 0x00,
+    0x08, 0x0F, 0x0C, 0x13, 0x12, 0x10, 0x06, 0x00, 0x87, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64,
+    0x62, 0x00, 0x0F, 0x0B, 0x04, 0x17, 0x13, 0x00, 0x85, 0x61, 0x74, 0x68, 0x6C, 0x69, 0x62, 0x00,
+    0x0E, 0x18, 0x0F, 0x0C, 0x00, 0x82, 0x6D, 0x6B, 0x62, 0x00, 0x48, 0x23, 0x01, 0x00, 0x0C, 0x2F,
+    0x01, 0x00, 0x00, 0x08, 0x0F, 0x16, 0x06, 0x10, 0x00, 0x83, 0x65, 0x6C, 0x65, 0x63, 0x00, 0x55,
+    0x38, 0x01, 0x00, 0x17, 0x47, 0x01, 0x00, 0x00, 0x17, 0x10, 0x08, 0x10, 0x1C, 0x16, 0x00, 0x85,
+    0x6D, 0x65, 0x74, 0x72, 0x69, 0x63, 0x00, 0x04, 0x00, 0x50, 0x52, 0x01, 0x00, 0x16, 0x60, 0x01,
+    0x00, 0x00, 0x15, 0x12, 0x0B, 0x06, 0x00, 0x86, 0x72, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x00,
+    0x0F, 0x13, 0x00, 0x84, 0x61, 0x73, 0x74, 0x69, 0x63, 0x00, 0x44, 0x9B, 0x01, 0x00, 0x07, 0xCC,
+    0x01, 0x00, 0x08, 0x08, 0x02, 0x00, 0x0B, 0x3C, 0x04, 0x00, 0x0C, 0x47, 0x04, 0x00, 0x0E, 0x64,
+    0x04, 0x00, 0x0F, 0x7F, 0x04, 0x00, 0x11, 0xC3, 0x04, 0x00, 0x15, 0x0D, 0x05, 0x00, 0x16, 0x71,
+    0x05, 0x00, 0x17, 0x8E, 0x05, 0x00, 0x1B, 0xF1, 0x05, 0x00, 0x00, 0x4F, 0xA8, 0x01, 0x00, 0x10,
+    0xB2, 0x01, 0x00, 0x13, 0xBF, 0x01, 0x00, 0x00, 0x12, 0x11, 0x18, 0x00, 0x83, 0x6C, 0x6F, 0x61,
+    0x64, 0x00, 0x13, 0x04, 0x08, 0x15, 0x17, 0x16, 0x00, 0x83, 0x6D, 0x70, 0x61, 0x64, 0x00, 0x11,
+    0x0E, 0x0C, 0x0B, 0x17, 0x00, 0x84, 0x6E, 0x6B, 0x70, 0x61, 0x64, 0x00, 0x08, 0x00, 0x48, 0xDF,
+    0x01, 0x00, 0x12, 0xEB, 0x01, 0x00, 0x15, 0xF3, 0x01, 0x00, 0x18, 0xFF, 0x01, 0x00, 0x00, 0x10,
+    0x10, 0x12, 0x06, 0x08, 0x15, 0x00, 0x82, 0x64, 0x65, 0x64, 0x00, 0x06, 0x11, 0x00, 0x48, 0xE6,
+    0x01, 0x00, 0x00, 0x04, 0x0A, 0x08, 0x15, 0x16, 0x0C, 0x00, 0x47, 0xE6, 0x01, 0x00, 0x00, 0x0F,
+    0x06, 0x1B, 0x00, 0x48, 0xE6, 0x01, 0x00, 0x00, 0x44, 0x41, 0x02, 0x00, 0x08, 0x72, 0x02, 0x00,
+    0x0A, 0x81, 0x02, 0x00, 0x0B, 0xB6, 0x02, 0x00, 0x0C, 0xC7, 0x02, 0x00, 0x0E, 0xEC, 0x02, 0x00,
+    0x0F, 0xFE, 0x02, 0x00, 0x10, 0x1D, 0x03, 0x00, 0x11, 0x2D, 0x03, 0x00, 0x15, 0x39, 0x03, 0x00,
+    0x16, 0x5C, 0x03, 0x00, 0x17, 0xB4, 0x03, 0x00, 0x1A, 0x20, 0x04, 0x00, 0x1D, 0x2B, 0x04, 0x00,
+    0x00, 0x53, 0x4A, 0x02, 0x00, 0x17, 0x53, 0x02, 0x00, 0x00, 0x0B, 0x16, 0x00, 0x83, 0x61, 0x70,
+    0x65, 0x64, 0x00, 0x46, 0x5C, 0x02, 0x00, 0x07, 0x67, 0x02, 0x00, 0x00, 0x0C, 0x07, 0x08, 0x07,
+    0x00, 0x83, 0x61, 0x74, 0x65, 0x64, 0x00, 0x0C, 0x10, 0x0C, 0x17, 0x11, 0x00, 0x4C, 0x61, 0x02,
+    0x00, 0x00, 0x17, 0x15, 0x13, 0x15, 0x08, 0x17, 0x11, 0x0C, 0x00, 0x83, 0x65, 0x74, 0x65, 0x64,
+    0x00, 0x48, 0x8E, 0x02, 0x00, 0x11, 0x9F, 0x02, 0x00, 0x15, 0xA9, 0x02, 0x00, 0x00, 0x0F, 0x0C,
+    0x0C, 0x19, 0x15, 0x13, 0x00, 0x87, 0x69, 0x76, 0x69, 0x6C, 0x65, 0x67, 0x65, 0x64, 0x00, 0x0C,
+    0x0F, 0x04, 0x00, 0x83, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x19, 0x08, 0x0C, 0x07, 0x00, 0x85, 0x76,
+    0x65, 0x72, 0x67, 0x65, 0x64, 0x00, 0x0C, 0x16, 0x0F, 0x13, 0x10, 0x12, 0x06, 0x06, 0x04, 0x00,
+    0x84, 0x69, 0x73, 0x68, 0x65, 0x64, 0x00, 0x49, 0xD0, 0x02, 0x00, 0x0F, 0xE0, 0x02, 0x00, 0x00,
+    0x0C, 0x06, 0x13, 0x08, 0x16, 0x00, 0x87, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x00,
+    0x10, 0x13, 0x0C, 0x00, 0x85, 0x6D, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x00, 0x06, 0x0F, 0x12, 0x11,
+    0x18, 0x16, 0x13, 0x04, 0x06, 0x00, 0x85, 0x6C, 0x6F, 0x63, 0x6B, 0x65, 0x64, 0x00, 0x50, 0x07,
+    0x03, 0x00, 0x1C, 0x13, 0x03, 0x00, 0x00, 0x05, 0x18, 0x17, 0x16, 0x00, 0x84, 0x6D, 0x62, 0x6C,
+    0x65, 0x64, 0x00, 0x06, 0x06, 0x00, 0x84, 0x79, 0x63, 0x6C, 0x65, 0x64, 0x00, 0x10, 0x15, 0x04,
+    0x0A, 0x12, 0x15, 0x13, 0x00, 0x85, 0x72, 0x61, 0x6D, 0x6D, 0x65, 0x64, 0x00, 0x07, 0x08, 0x17,
+    0x1B, 0x08, 0x00, 0x83, 0x6E, 0x64, 0x65, 0x64, 0x00, 0x48, 0x42, 0x03, 0x00, 0x0C, 0x4D, 0x03,
+    0x00, 0x00, 0x08, 0x09, 0x08, 0x15, 0x00, 0x83, 0x72, 0x65, 0x65, 0x64, 0x00, 0x1A, 0x15, 0x07,
+    0x04, 0x0B, 0x00, 0x86, 0x72, 0x64, 0x77, 0x69, 0x72, 0x65, 0x64, 0x00, 0x44, 0x71, 0x03, 0x00,
+    0x08, 0x7F, 0x03, 0x00, 0x0C, 0x8A, 0x03, 0x00, 0x16, 0x9A, 0x03, 0x00, 0x18, 0xA8, 0x03, 0x00,
+    0x00, 0x15, 0x08, 0x06, 0x08, 0x07, 0x00, 0x85, 0x72, 0x65, 0x61, 0x73, 0x65, 0x64, 0x00, 0x16,
+    0x18, 0x0A, 0x00, 0x84, 0x65, 0x73, 0x73, 0x65, 0x64, 0x00, 0x17, 0x08, 0x15, 0x19, 0x07, 0x04,
+    0x00, 0x86, 0x65, 0x72, 0x74, 0x69, 0x73, 0x65, 0x64, 0x00, 0x06, 0x18, 0x16, 0x0C, 0x07, 0x00,
+    0x85, 0x63, 0x75, 0x73, 0x73, 0x65, 0x64, 0x00, 0x12, 0x06, 0x09, 0x00, 0x85, 0x6F, 0x63, 0x75,
+    0x73, 0x65, 0x64, 0x00, 0x44, 0xC1, 0x03, 0x00, 0x06, 0xEC, 0x03, 0x00, 0x0C, 0x11, 0x04, 0x00,
+    0x00, 0x4C, 0xCA, 0x03, 0x00, 0x0F, 0xD9, 0x03, 0x00, 0x00, 0x06, 0x0F, 0x13, 0x10, 0x12, 0x06,
+    0x00, 0x85, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x00, 0x18, 0x0F, 0x06, 0x04, 0x06, 0x08, 0x15,
+    0x13, 0x00, 0x87, 0x6C, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x00, 0x4C, 0xF5, 0x03, 0x00,
+    0x0F, 0x05, 0x04, 0x00, 0x00, 0x15, 0x16, 0x17, 0x08, 0x15, 0x00, 0x87, 0x73, 0x74, 0x72, 0x69,
+    0x63, 0x74, 0x65, 0x64, 0x00, 0x08, 0x08, 0x16, 0x00, 0x85, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64,
+    0x00, 0x10, 0x0F, 0x0C, 0x08, 0x07, 0x00, 0x86, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x64, 0x00,
+    0x0E, 0x08, 0x16, 0x00, 0x84, 0x6B, 0x65, 0x77, 0x65, 0x64, 0x00, 0x04, 0x1C, 0x07, 0x0F, 0x0F,
+    0x18, 0x0E, 0x16, 0x00, 0x85, 0x79, 0x64, 0x61, 0x7A, 0x65, 0x64, 0x00, 0x08, 0x16, 0x04, 0x0F,
+    0x09, 0x00, 0x82, 0x68, 0x65, 0x64, 0x00, 0x08, 0x09, 0x0C, 0x00, 0x46, 0x54, 0x04, 0x00, 0x15,
+    0x5D, 0x04, 0x00, 0x00, 0x08, 0x13, 0x16, 0x00, 0x82, 0x69, 0x65, 0x64, 0x00, 0x08, 0x00, 0x59,
+    0x58, 0x04, 0x00, 0x00, 0x08, 0x00, 0x52, 0x6F, 0x04, 0x00, 0x16, 0x78, 0x04, 0x00, 0x00, 0x19,
+    0x11, 0x0C, 0x00, 0x82, 0x6B, 0x65, 0x64, 0x00, 0x04, 0x00, 0x50, 0x73, 0x04, 0x00, 0x00, 0x48,
+    0x88, 0x04, 0x00, 0x0C, 0xB2, 0x04, 0x00, 0x00, 0x47, 0x91, 0x04, 0x00, 0x0B, 0xA8, 0x04, 0x00,
+    0x00, 0x11, 0x00, 0x44, 0x9C, 0x04, 0x00, 0x18, 0xA3, 0x04, 0x00, 0x00, 0x0B, 0x00, 0x82, 0x6C,
+    0x65, 0x64, 0x00, 0x45, 0x9E, 0x04, 0x00, 0x00, 0x0C, 0x16, 0x00, 0x84, 0x68, 0x69, 0x65, 0x6C,
+    0x64, 0x00, 0x18, 0x05, 0x17, 0x0C, 0x0F, 0x18, 0x10, 0x00, 0x86, 0x74, 0x69, 0x62, 0x75, 0x69,
+    0x6C, 0x64, 0x00, 0x44, 0xD0, 0x04, 0x00, 0x08, 0xDE, 0x04, 0x00, 0x0B, 0xFF, 0x04, 0x00, 0x00,
+    0x17, 0x0B, 0x0B, 0x0A, 0x0C, 0x15, 0x00, 0x84, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x00, 0x52, 0xE7,
+    0x04, 0x00, 0x17, 0xF3, 0x04, 0x00, 0x00, 0x0C, 0x17, 0x16, 0x08, 0x18, 0x14, 0x00, 0x82, 0x6E,
+    0x65, 0x64, 0x00, 0x15, 0x08, 0x13, 0x00, 0x85, 0x72, 0x65, 0x74, 0x65, 0x6E, 0x64, 0x00, 0x04,
+    0x08, 0x15, 0x12, 0x09, 0x08, 0x05, 0x00, 0x83, 0x68, 0x61, 0x6E, 0x64, 0x00, 0x44, 0x16, 0x05,
+    0x00, 0x08, 0x55, 0x05, 0x00, 0x00, 0x48, 0x23, 0x05, 0x00, 0x12, 0x2F, 0x05, 0x00, 0x1A, 0x49,
+    0x05, 0x00, 0x00, 0x06, 0x18, 0x0F, 0x06, 0x00, 0x84, 0x65, 0x63, 0x61, 0x72, 0x64, 0x00, 0x05,
+    0x1C, 0x08, 0x0E, 0x0A, 0x12, 0x07, 0x0B, 0x08, 0x17, 0x00, 0x8C, 0x68, 0x65, 0x64, 0x6F, 0x67,
+    0x6B, 0x65, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00, 0x12, 0x15, 0x09, 0x00, 0x85, 0x6F, 0x72,
+    0x77, 0x61, 0x72, 0x64, 0x00, 0x44, 0x5E, 0x05, 0x00, 0x08, 0x68, 0x05, 0x00, 0x00, 0x13, 0x08,
+    0x15, 0x13, 0x00, 0x82, 0x72, 0x65, 0x64, 0x00, 0x05, 0x10, 0x18, 0x00, 0x51, 0x63, 0x05, 0x00,
+    0x00, 0x08, 0x00, 0x52, 0x7C, 0x05, 0x00, 0x18, 0x85, 0x05, 0x00, 0x00, 0x13, 0x1B, 0x08, 0x00,
+    0x82, 0x73, 0x65, 0x64, 0x00, 0x09, 0x11, 0x12, 0x00, 0x46, 0x80, 0x05, 0x00, 0x00, 0x08, 0x00,
+    0x44, 0xA9, 0x05, 0x00, 0x06, 0xB4, 0x05, 0x00, 0x11, 0xBE, 0x05, 0x00, 0x15, 0xD7, 0x05, 0x00,
+    0x16, 0xDF, 0x05, 0x00, 0x18, 0xE6, 0x05, 0x00, 0x00, 0x0F, 0x18, 0x0A, 0x08, 0x15, 0x00, 0x82,
+    0x74, 0x65, 0x64, 0x00, 0x08, 0x15, 0x15, 0x12, 0x00, 0x46, 0xAF, 0x05, 0x00, 0x00, 0x48, 0xC7,
+    0x05, 0x00, 0x18, 0xD0, 0x05, 0x00, 0x00, 0x19, 0x08, 0x15, 0x00, 0x53, 0xAF, 0x05, 0x00, 0x00,
+    0x12, 0x00, 0x50, 0xAF, 0x05, 0x00, 0x00, 0x12, 0x0B, 0x00, 0x56, 0xAF, 0x05, 0x00, 0x00, 0x08,
+    0x00, 0x51, 0xAF, 0x05, 0x00, 0x00, 0x17, 0x0C, 0x17, 0x16, 0x11, 0x00, 0x4C, 0xAF, 0x05, 0x00,
+    0x00, 0x08, 0x08, 0x07, 0x11, 0x0C, 0x00, 0x82, 0x78, 0x65, 0x64, 0x00, 0x44, 0x39, 0x06, 0x00,
+    0x06, 0x56, 0x06, 0x00, 0x07, 0xA9, 0x06, 0x00, 0x0A, 0xDB, 0x06, 0x00, 0x0C, 0x1C, 0x07, 0x00,
+    0x0E, 0x3E, 0x07, 0x00, 0x0F, 0x49, 0x07, 0x00, 0x10, 0x0A, 0x08, 0x00, 0x11, 0x4A, 0x08, 0x00,
+    0x12, 0x70, 0x08, 0x00, 0x15, 0x7B, 0x08, 0x00, 0x16, 0x1F, 0x09, 0x00, 0x17, 0x8A, 0x09, 0x00,
+    0x19, 0x16, 0x0A, 0x00, 0x1D, 0xAA, 0x0A, 0x00, 0x00, 0x55, 0x42, 0x06, 0x00, 0x17, 0x4B, 0x06,
+    0x00, 0x00, 0x18, 0x14, 0x16, 0x00, 0x82, 0x61, 0x72, 0x65, 0x00, 0x15, 0x07, 0x18, 0x04, 0x05,
+    0x00, 0x82, 0x61, 0x74, 0x65, 0x00, 0x44, 0x5F, 0x06, 0x00, 0x11, 0x84, 0x06, 0x00, 0x00, 0x51,
+    0x68, 0x06, 0x00, 0x15, 0x75, 0x06, 0x00, 0x00, 0x15, 0x04, 0x08, 0x13, 0x13, 0x04, 0x00, 0x83,
+    0x61, 0x6E, 0x63, 0x65, 0x00, 0x0E, 0x17, 0x06, 0x04, 0x17, 0x16, 0x00, 0x85, 0x6B, 0x74, 0x72,
+    0x61, 0x63, 0x65, 0x00, 0x44, 0x8D, 0x06, 0x00, 0x12, 0x9D, 0x06, 0x00, 0x00, 0x0C, 0x17, 0x15,
+    0x08, 0x0B, 0x11, 0x0C, 0x00, 0x85, 0x69, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x18, 0x11, 0x11,
+    0x04, 0x00, 0x84, 0x6F, 0x75, 0x6E, 0x63, 0x65, 0x00, 0x46, 0xB6, 0x06, 0x00, 0x0C, 0xC2, 0x06,
+    0x00, 0x12, 0xD0, 0x06, 0x00, 0x00, 0x12, 0x08, 0x17, 0x1C, 0x05, 0x00, 0x83, 0x63, 0x6F, 0x64,
+    0x65, 0x00, 0x0A, 0x16, 0x11, 0x12, 0x0F, 0x04, 0x00, 0x84, 0x67, 0x73, 0x69, 0x64, 0x65, 0x00,
+    0x13, 0x06, 0x12, 0x00, 0x84, 0x70, 0x63, 0x6F, 0x64, 0x65, 0x00, 0x44, 0xEC, 0x06, 0x00, 0x07,
+    0xF9, 0x06, 0x00, 0x15, 0x04, 0x07, 0x00, 0x17, 0x11, 0x07, 0x00, 0x00, 0x04, 0x0E, 0x08, 0x15,
+    0x05, 0x00, 0x84, 0x61, 0x6B, 0x61, 0x67, 0x65, 0x00, 0x15, 0x0C, 0x05, 0x00, 0x84, 0x72, 0x69,
+    0x64, 0x67, 0x65, 0x00, 0x0C, 0x18, 0x10, 0x08, 0x07, 0x00, 0x84, 0x69, 0x75, 0x72, 0x67, 0x65,
+    0x00, 0x04, 0x11, 0x0C, 0x19, 0x00, 0x83, 0x74, 0x61, 0x67, 0x65, 0x00, 0x44, 0x25, 0x07, 0x00,
+    0x17, 0x32, 0x07, 0x00, 0x00, 0x16, 0x0F, 0x0C, 0x04, 0x00, 0x85, 0x6C, 0x69, 0x73, 0x61, 0x69,
+    0x65, 0x00, 0x15, 0x1A, 0x15, 0x08, 0x19, 0x12, 0x00, 0x82, 0x69, 0x74, 0x65, 0x00, 0x0F, 0x11,
+    0x0C, 0x1A, 0x17, 0x00, 0x82, 0x6B, 0x6C, 0x65, 0x00, 0x44, 0x56, 0x07, 0x00, 0x05, 0x65, 0x07,
+    0x00, 0x0C, 0xEB, 0x07, 0x00, 0x00, 0x05, 0x0F, 0x0C, 0x04, 0x19, 0x04, 0x11, 0x18, 0x00, 0x83,
+    0x61, 0x62, 0x6C, 0x65, 0x00, 0x44, 0x7A, 0x07, 0x00, 0x0C, 0xA0, 0x07, 0x00, 0x11, 0xC6, 0x07,
+    0x00, 0x16, 0xD3, 0x07, 0x00, 0x18, 0xDF, 0x07, 0x00, 0x00, 0x4A, 0x83, 0x07, 0x00, 0x0C, 0x91,
+    0x07, 0x00, 0x00, 0x08, 0x04, 0x11, 0x04, 0x10, 0x00, 0x85, 0x67, 0x65, 0x61, 0x62, 0x6C, 0x65,
+    0x00, 0x0C, 0x09, 0x07, 0x12, 0x10, 0x00, 0x86, 0x69, 0x66, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x00,
+    0x56, 0xA9, 0x07, 0x00, 0x1B, 0xB9, 0x07, 0x00, 0x00, 0x16, 0x13, 0x12, 0x10, 0x0C, 0x00, 0x87,
+    0x70, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x00, 0x0F, 0x08, 0x09, 0x00, 0x86, 0x6C, 0x65,
+    0x78, 0x69, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x0C, 0x09, 0x08, 0x07, 0x00, 0x84, 0x6E, 0x61, 0x62,
+    0x6C, 0x65, 0x00, 0x0C, 0x16, 0x12, 0x13, 0x00, 0x84, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x00, 0x15,
+    0x12, 0x17, 0x00, 0x85, 0x72, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x00, 0x05, 0x00, 0x44, 0xF6, 0x07,
+    0x00, 0x16, 0x00, 0x08, 0x00, 0x00, 0x15, 0x04, 0x19, 0x00, 0x83, 0x69, 0x62, 0x6C, 0x65, 0x00,
+    0x16, 0x08, 0x06, 0x06, 0x00, 0x44, 0xFA, 0x07, 0x00, 0x00, 0x44, 0x1B, 0x08, 0x00, 0x16, 0x28,
+    0x08, 0x00, 0x17, 0x33, 0x08, 0x00, 0x18, 0x3F, 0x08, 0x00, 0x00, 0x10, 0x11, 0x08, 0x17, 0x0C,
+    0x00, 0x84, 0x6D, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x12, 0x08, 0x1A, 0x04, 0x00, 0x83, 0x73, 0x6F,
+    0x6D, 0x65, 0x00, 0x0C, 0x11, 0x04, 0x08, 0x10, 0x00, 0x83, 0x74, 0x69, 0x6D, 0x65, 0x00, 0x12,
+    0x0F, 0x19, 0x00, 0x84, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x00, 0x46, 0x53, 0x08, 0x00, 0x12, 0x60,
+    0x08, 0x00, 0x00, 0x08, 0x0C, 0x15, 0x08, 0x13, 0x1B, 0x08, 0x00, 0x82, 0x6E, 0x63, 0x65, 0x00,
+    0x0A, 0x05, 0x11, 0x0C, 0x15, 0x15, 0x08, 0x0B, 0x00, 0x84, 0x67, 0x62, 0x6F, 0x6E, 0x65, 0x00,
+    0x16, 0x13, 0x15, 0x18, 0x13, 0x00, 0x82, 0x6F, 0x73, 0x65, 0x00, 0x44, 0x90, 0x08, 0x00, 0x08,
+    0xD8, 0x08, 0x00, 0x0C, 0xE7, 0x08, 0x00, 0x18, 0x08, 0x09, 0x00, 0x1A, 0x13, 0x09, 0x00, 0x00,
+    0x48, 0x9D, 0x08, 0x00, 0x0B, 0xA8, 0x08, 0x00, 0x1A, 0xB7, 0x08, 0x00, 0x00, 0x13, 0x15, 0x13,
+    0x00, 0x84, 0x65, 0x70, 0x61, 0x72, 0x65, 0x00, 0x16, 0x19, 0x08, 0x04, 0x1A, 0x00, 0x86, 0x76,
+    0x65, 0x73, 0x68, 0x61, 0x72, 0x65, 0x00, 0x49, 0xC0, 0x08, 0x00, 0x11, 0xCC, 0x08, 0x00, 0x00,
+    0x17, 0x12, 0x16, 0x00, 0x85, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x00, 0x08, 0x04, 0x0F, 0x00,
+    0x85, 0x6E, 0x65, 0x77, 0x61, 0x72, 0x65, 0x00, 0x0B, 0x08, 0x1A, 0x16, 0x0F, 0x08, 0x00, 0x85,
+    0x65, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x51, 0xF0, 0x08, 0x00, 0x1A, 0xFA, 0x08, 0x00, 0x00,
+    0x17, 0x08, 0x00, 0x84, 0x6E, 0x74, 0x69, 0x72, 0x65, 0x00, 0x07, 0x04, 0x11, 0x0B, 0x00, 0x86,
+    0x61, 0x6E, 0x64, 0x77, 0x69, 0x72, 0x65, 0x00, 0x08, 0x06, 0x16, 0x00, 0x84, 0x65, 0x63, 0x75,
+    0x72, 0x65, 0x00, 0x04, 0x07, 0x15, 0x04, 0x0B, 0x00, 0x83, 0x77, 0x61, 0x72, 0x65, 0x00, 0x44,
+    0x34, 0x09, 0x00, 0x08, 0x3F, 0x09, 0x00, 0x0C, 0x4C, 0x09, 0x00, 0x10, 0x72, 0x09, 0x00, 0x11,
+    0x7E, 0x09, 0x00, 0x00, 0x08, 0x05, 0x15, 0x00, 0x84, 0x65, 0x62, 0x61, 0x73, 0x65, 0x00, 0x04,
+    0x11, 0x13, 0x04, 0x0D, 0x00, 0x84, 0x61, 0x6E, 0x65, 0x73, 0x65, 0x00, 0x50, 0x55, 0x09, 0x00,
+    0x15, 0x63, 0x09, 0x00, 0x00, 0x0C, 0x0C, 0x11, 0x10, 0x00, 0x86, 0x69, 0x6E, 0x69, 0x6D, 0x69,
+    0x73, 0x65, 0x00, 0x07, 0x04, 0x07, 0x11, 0x04, 0x17, 0x16, 0x00, 0x84, 0x72, 0x64, 0x69, 0x73,
+    0x65, 0x00, 0x0C, 0x0C, 0x11, 0x0C, 0x10, 0x00, 0x83, 0x6D, 0x69, 0x73, 0x65, 0x00, 0x13, 0x08,
+    0x1B, 0x08, 0x00, 0x84, 0x70, 0x65, 0x6E, 0x73, 0x65, 0x00, 0x44, 0x9F, 0x09, 0x00, 0x0F, 0xE4,
+    0x09, 0x00, 0x10, 0xF1, 0x09, 0x00, 0x15, 0xFD, 0x09, 0x00, 0x18, 0x08, 0x0A, 0x00, 0x00, 0x48,
+    0xAC, 0x09, 0x00, 0x0F, 0xCA, 0x09, 0x00, 0x19, 0xD8, 0x09, 0x00, 0x00, 0x4A, 0xB5, 0x09, 0x00,
+    0x15, 0xC0, 0x09, 0x00, 0x00, 0x0F, 0x08, 0x07, 0x00, 0x84, 0x65, 0x67, 0x61, 0x74, 0x65, 0x00,
+    0x17, 0x0C, 0x00, 0x84, 0x65, 0x72, 0x61, 0x74, 0x65, 0x00, 0x13, 0x08, 0x10, 0x17, 0x00, 0x86,
+    0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x00, 0x15, 0x0C, 0x13, 0x00, 0x85, 0x72, 0x69, 0x76,
+    0x61, 0x74, 0x65, 0x00, 0x04, 0x18, 0x06, 0x0F, 0x04, 0x06, 0x00, 0x83, 0x6C, 0x61, 0x74, 0x65,
+    0x00, 0x04, 0x12, 0x17, 0x18, 0x04, 0x00, 0x83, 0x6D, 0x61, 0x74, 0x65, 0x00, 0x04, 0x05, 0x0C,
+    0x19, 0x00, 0x83, 0x72, 0x61, 0x74, 0x65, 0x00, 0x0F, 0x16, 0x12, 0x05, 0x04, 0x00, 0x85, 0x73,
+    0x6F, 0x6C, 0x75, 0x74, 0x65, 0x00, 0x4B, 0x1F, 0x0A, 0x00, 0x0C, 0x3A, 0x0A, 0x00, 0x00, 0x0C,
+    0x00, 0x46, 0x2A, 0x0A, 0x00, 0x1C, 0x33, 0x0A, 0x00, 0x00, 0x15, 0x04, 0x00, 0x83, 0x68, 0x69,
+    0x76, 0x65, 0x00, 0x08, 0x00, 0x4E, 0x2D, 0x0A, 0x00, 0x00, 0x44, 0x4B, 0x0A, 0x00, 0x08, 0x59,
+    0x0A, 0x00, 0x15, 0x74, 0x0A, 0x00, 0x17, 0x81, 0x0A, 0x00, 0x00, 0x17, 0x06, 0x0C, 0x07, 0x11,
+    0x0C, 0x00, 0x84, 0x61, 0x74, 0x69, 0x76, 0x65, 0x00, 0x4B, 0x62, 0x0A, 0x00, 0x15, 0x6B, 0x0A,
+    0x00, 0x00, 0x06, 0x04, 0x00, 0x83, 0x69, 0x65, 0x76, 0x65, 0x00, 0x07, 0x00, 0x84, 0x65, 0x72,
+    0x69, 0x76, 0x65, 0x00, 0x16, 0x18, 0x06, 0x08, 0x15, 0x00, 0x84, 0x72, 0x73, 0x69, 0x76, 0x65,
+    0x00, 0x44, 0x8A, 0x0A, 0x00, 0x06, 0x9C, 0x0A, 0x00, 0x00, 0x11, 0x15, 0x17, 0x08, 0x0F, 0x04,
+    0x00, 0x88, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x00, 0x09, 0x08, 0x09, 0x08,
+    0x00, 0x86, 0x66, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x00, 0x4C, 0xB3, 0x0A, 0x00, 0x0F, 0xC5,
+    0x0A, 0x00, 0x00, 0x0F, 0x04, 0x15, 0x11, 0x08, 0x08, 0x0A, 0x00, 0x87, 0x6E, 0x65, 0x72, 0x61,
+    0x6C, 0x69, 0x7A, 0x65, 0x00, 0x1D, 0x04, 0x07, 0x00, 0x82, 0x7A, 0x6C, 0x65, 0x00, 0x49, 0xD7,
+    0x0A, 0x00, 0x11, 0xF8, 0x0A, 0x00, 0x00, 0x12, 0x00, 0x57, 0xE2, 0x0A, 0x00, 0x18, 0xEE, 0x0A,
+    0x00, 0x00, 0x0C, 0x09, 0x0F, 0x00, 0x85, 0x69, 0x66, 0x74, 0x6F, 0x66, 0x66, 0x00, 0x11, 0x15,
+    0x00, 0x84, 0x75, 0x6E, 0x6F, 0x66, 0x66, 0x00, 0x17, 0x0C, 0x15, 0x13, 0x1C, 0x11, 0x0C, 0x17,
+    0x00, 0x82, 0x6E, 0x74, 0x66, 0x00, 0x44, 0x17, 0x0B, 0x00, 0x0C, 0x23, 0x0B, 0x00, 0x11, 0xFF,
+    0x0B, 0x00, 0x1A, 0x13, 0x0F, 0x00, 0x00, 0x17, 0x12, 0x0A, 0x07, 0x00, 0x84, 0x6F, 0x67, 0x74,
+    0x61, 0x67, 0x00, 0x49, 0x2C, 0x0B, 0x00, 0x11, 0x3B, 0x0B, 0x00, 0x00, 0x11, 0x12, 0x08, 0x06,
+    0x08, 0x00, 0x86, 0x65, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x00, 0x45, 0x5C, 0x0B, 0x00, 0x0B,
+    0x68, 0x0B, 0x00, 0x0E, 0x70, 0x0B, 0x00, 0x11, 0x91, 0x0B, 0x00, 0x13, 0xA8, 0x0B, 0x00, 0x17,
+    0xBB, 0x0B, 0x00, 0x19, 0xE9, 0x0B, 0x00, 0x1C, 0xF3, 0x0B, 0x00, 0x00, 0x0C, 0x15, 0x06, 0x16,
+    0x08, 0x07, 0x00, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x17, 0x12, 0x00, 0x51, 0x63, 0x0B, 0x00, 0x00,
+    0x46, 0x7D, 0x0B, 0x00, 0x0C, 0x85, 0x0B, 0x00, 0x12, 0x8A, 0x0B, 0x00, 0x00, 0x08, 0x0B, 0x00,
+    0x46, 0x63, 0x0B, 0x00, 0x00, 0x4F, 0x63, 0x0B, 0x00, 0x00, 0x12, 0x00, 0x4F, 0x63, 0x0B, 0x00,
+    0x00, 0x4C, 0x9A, 0x0B, 0x00, 0x18, 0xA3, 0x0B, 0x00, 0x00, 0x04, 0x17, 0x08, 0x00, 0x55, 0x63,
+    0x0B, 0x00, 0x00, 0x57, 0x63, 0x0B, 0x00, 0x00, 0x52, 0xB1, 0x0B, 0x00, 0x1C, 0xA3, 0x0B, 0x00,
+    0x00, 0x0F, 0x08, 0x19, 0x08, 0x00, 0x47, 0x63, 0x0B, 0x00, 0x00, 0x44, 0xC4, 0x0B, 0x00, 0x0C,
+    0xE0, 0x0B, 0x00, 0x00, 0x06, 0x00, 0x4C, 0xCF, 0x0B, 0x00, 0x12, 0xD8, 0x0B, 0x00, 0x00, 0x0F,
+    0x13, 0x18, 0x00, 0x47, 0x63, 0x0B, 0x00, 0x00, 0x0F, 0x08, 0x00, 0x55, 0x63, 0x0B, 0x00, 0x00,
+    0x16, 0x0C, 0x1B, 0x00, 0x48, 0x63, 0x0B, 0x00, 0x00, 0x0C, 0x08, 0x06, 0x08, 0x00, 0x55, 0x63,
+    0x0B, 0x00, 0x00, 0x09, 0x0C, 0x17, 0x11, 0x08, 0x07, 0x00, 0x4C, 0x63, 0x0B, 0x00, 0x00, 0x46,
+    0x20, 0x0C, 0x00, 0x0B, 0x2D, 0x0C, 0x00, 0x0C, 0x4A, 0x0C, 0x00, 0x0E, 0x63, 0x0E, 0x00, 0x0F,
+    0x7F, 0x0E, 0x00, 0x11, 0xB2, 0x0E, 0x00, 0x13, 0xBD, 0x0E, 0x00, 0x17, 0xC8, 0x0E, 0x00, 0x00,
+    0x0C, 0x0C, 0x19, 0x15, 0x08, 0x16, 0x00, 0x83, 0x63, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x00, 0x56,
+    0x38, 0x0C, 0x00, 0x17, 0x42, 0x0C, 0x00, 0x00, 0x18, 0x15, 0x05, 0x00, 0x83, 0x68, 0x69, 0x6E,
+    0x67, 0x00, 0x1C, 0x11, 0x00, 0x44, 0x3C, 0x0C, 0x00, 0x00, 0x44, 0x7B, 0x0C, 0x00, 0x06, 0x8B,
+    0x0C, 0x00, 0x07, 0x9E, 0x0C, 0x00, 0x0B, 0x06, 0x0D, 0x00, 0x0F, 0x2A, 0x0D, 0x00, 0x10, 0x3C,
+    0x0D, 0x00, 0x11, 0x4D, 0x0D, 0x00, 0x12, 0x89, 0x0D, 0x00, 0x13, 0xA8, 0x0D, 0x00, 0x15, 0xBC,
+    0x0D, 0x00, 0x16, 0x03, 0x0E, 0x00, 0x17, 0x35, 0x0E, 0x00, 0x00, 0x15, 0x08, 0x13, 0x13, 0x04,
+    0x16, 0x0C, 0x07, 0x00, 0x84, 0x61, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x07, 0x12, 0x13, 0x15,
+    0x08, 0x15, 0x00, 0x88, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x69, 0x6E, 0x67, 0x00, 0x44, 0xAF,
+    0x0C, 0x00, 0x08, 0xBB, 0x0C, 0x00, 0x11, 0xC8, 0x0C, 0x00, 0x15, 0xF8, 0x0C, 0x00, 0x00, 0x11,
+    0x17, 0x16, 0x00, 0x85, 0x61, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x11, 0x09, 0x09, 0x12, 0x00,
+    0x85, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x44, 0xD1, 0x0C, 0x00, 0x17, 0xE7, 0x0C, 0x00,
+    0x00, 0x17, 0x16, 0x15, 0x08, 0x11, 0x07, 0x18, 0x00, 0x8B, 0x6E, 0x64, 0x65, 0x72, 0x73, 0x74,
+    0x61, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x04, 0x16, 0x15, 0x08, 0x07, 0x11, 0x18, 0x00, 0x86,
+    0x74, 0x61, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x15, 0x08, 0x19, 0x12, 0x00, 0x85, 0x72,
+    0x69, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x44, 0x0F, 0x0D, 0x00, 0x17, 0x1E, 0x0D, 0x00, 0x00, 0x06,
+    0x12, 0x15, 0x13, 0x13, 0x04, 0x00, 0x85, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x04,
+    0x10, 0x00, 0x85, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x0F, 0x04, 0x17, 0x11, 0x16, 0x0C,
+    0x00, 0x88, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x00, 0x04, 0x15, 0x08, 0x17,
+    0x16, 0x13, 0x18, 0x00, 0x86, 0x72, 0x65, 0x61, 0x6D, 0x69, 0x6E, 0x67, 0x00, 0x4C, 0x5A, 0x0D,
+    0x00, 0x10, 0x6E, 0x0D, 0x00, 0x11, 0x7B, 0x0D, 0x00, 0x00, 0x04, 0x15, 0x17, 0x11, 0x16, 0x12,
+    0x06, 0x00, 0x89, 0x6E, 0x73, 0x74, 0x72, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x04,
+    0x1B, 0x08, 0x00, 0x85, 0x6D, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x0C, 0x08, 0x05, 0x00,
+    0x86, 0x67, 0x69, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x55, 0x92, 0x0D, 0x00, 0x17, 0x9E, 0x0D,
+    0x00, 0x00, 0x15, 0x15, 0x0C, 0x10, 0x00, 0x84, 0x6F, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x05,
+    0x00, 0x84, 0x6F, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x08, 0x0E, 0x16, 0x08, 0x18, 0x12, 0x0B,
+    0x00, 0x88, 0x73, 0x65, 0x6B, 0x65, 0x65, 0x70, 0x69, 0x6E, 0x67, 0x00, 0x47, 0xCD, 0x0D, 0x00,
+    0x08, 0xD9, 0x0D, 0x00, 0x0C, 0xEA, 0x0D, 0x00, 0x0E, 0xF9, 0x0D, 0x00, 0x00, 0x04, 0x0A, 0x08,
+    0x15, 0x00, 0x84, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x0A, 0x17, 0x04, 0x16, 0x00, 0x88,
+    0x74, 0x61, 0x67, 0x67, 0x65, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x04, 0x08, 0x13, 0x15, 0x00, 0x87,
+    0x65, 0x70, 0x61, 0x69, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x09, 0x00, 0x84, 0x72, 0x6B, 0x69,
+    0x6E, 0x67, 0x00, 0x46, 0x10, 0x0E, 0x00, 0x08, 0x1C, 0x0E, 0x00, 0x15, 0x2A, 0x0E, 0x00, 0x00,
+    0x18, 0x12, 0x09, 0x00, 0x85, 0x63, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x00, 0x16, 0x06, 0x12, 0x15,
+    0x13, 0x00, 0x85, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x00, 0x04, 0x08, 0x00, 0x85, 0x72, 0x61,
+    0x73, 0x69, 0x6E, 0x67, 0x00, 0x04, 0x00, 0x47, 0x40, 0x0E, 0x00, 0x0A, 0x54, 0x0E, 0x00, 0x00,
+    0x0C, 0x0F, 0x16, 0x12, 0x11, 0x12, 0x06, 0x00, 0x89, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x61, 0x74,
+    0x69, 0x6E, 0x67, 0x00, 0x19, 0x0C, 0x04, 0x11, 0x00, 0x87, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69,
+    0x6E, 0x67, 0x00, 0x0C, 0x00, 0x44, 0x6E, 0x0E, 0x00, 0x06, 0x77, 0x0E, 0x00, 0x00, 0x15, 0x05,
+    0x00, 0x83, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x0F, 0x00, 0x46, 0x71, 0x0E, 0x00, 0x00, 0x0C,
+    0x00, 0x44, 0x92, 0x0E, 0x00, 0x0A, 0x9B, 0x0E, 0x00, 0x0C, 0xA3, 0x0E, 0x00, 0x0F, 0xAB, 0x0E,
+    0x00, 0x00, 0x06, 0x16, 0x00, 0x83, 0x6C, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x12, 0x00, 0x57, 0x95,
+    0x0E, 0x00, 0x00, 0x04, 0x15, 0x00, 0x57, 0x95, 0x0E, 0x00, 0x00, 0x18, 0x00, 0x53, 0x95, 0x0E,
+    0x00, 0x00, 0x0C, 0x12, 0x0F, 0x06, 0x00, 0x83, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x10, 0x18,
+    0x0D, 0x00, 0x83, 0x70, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x00, 0x44, 0xDB, 0x0E, 0x00, 0x12, 0xF9,
+    0x0E, 0x00, 0x13, 0xFE, 0x0E, 0x00, 0x15, 0x0A, 0x0F, 0x00, 0x00, 0x15, 0x00, 0x48, 0xE6, 0x0E,
+    0x00, 0x0A, 0xF2, 0x0E, 0x00, 0x00, 0x0F, 0x08, 0x06, 0x06, 0x04, 0x00, 0x83, 0x74, 0x69, 0x6E,
+    0x67, 0x00, 0x0C, 0x00, 0x50, 0xEC, 0x0E, 0x00, 0x00, 0x51, 0xEC, 0x0E, 0x00, 0x00, 0x08, 0x06,
+    0x15, 0x08, 0x17, 0x11, 0x00, 0x4C, 0xEC, 0x0E, 0x00, 0x00, 0x12, 0x13, 0x10, 0x00, 0x4C, 0xEC,
+    0x0E, 0x00, 0x00, 0x12, 0x07, 0x15, 0x12, 0x12, 0x0B, 0x00, 0x84, 0x64, 0x72, 0x6F, 0x77, 0x67,
+    0x00, 0x4C, 0x2E, 0x0F, 0x00, 0x13, 0x3B, 0x0F, 0x00, 0x16, 0x4C, 0x0F, 0x00, 0x00, 0x16, 0x09,
+    0x07, 0x15, 0x12, 0x1A, 0x16, 0x00, 0x82, 0x69, 0x73, 0x68, 0x00, 0x04, 0x15, 0x12, 0x0A, 0x0B,
+    0x17, 0x15, 0x12, 0x00, 0x85, 0x6F, 0x67, 0x72, 0x61, 0x70, 0x68, 0x00, 0x0C, 0x09, 0x12, 0x1A,
+    0x06, 0x00, 0x85, 0x6F, 0x77, 0x66, 0x69, 0x73, 0x68, 0x00, 0x44, 0x63, 0x0F, 0x00, 0x10, 0x73,
+    0x0F, 0x00, 0x00, 0x11, 0x0F, 0x04, 0x04, 0x05, 0x04, 0x0C, 0x0A, 0x00, 0x84, 0x6C, 0x61, 0x6E,
+    0x61, 0x69, 0x00, 0x12, 0x08, 0x06, 0x0B, 0x00, 0x84, 0x65, 0x63, 0x6F, 0x6D, 0x69, 0x00, 0x44,
+    0x88, 0x0F, 0x00, 0x06, 0x93, 0x0F, 0x00, 0x00, 0x12, 0x19, 0x0F, 0x16, 0x00, 0x83, 0x6F, 0x76,
+    0x61, 0x6B, 0x00, 0x05, 0x04, 0x1C, 0x04, 0x0F, 0x13, 0x00, 0x83, 0x62, 0x61, 0x63, 0x6B, 0x00,
+    0x44, 0xC5, 0x0F, 0x00, 0x06, 0x21, 0x10, 0x00, 0x08, 0x2D, 0x10, 0x00, 0x0B, 0x51, 0x10, 0x00,
+    0x0C, 0x5C, 0x10, 0x00, 0x0F, 0x7C, 0x10, 0x00, 0x11, 0x8A, 0x10, 0x00, 0x16, 0x94, 0x10, 0x00,
+    0x18, 0xA1, 0x10, 0x00, 0x00, 0x46, 0xD6, 0x0F, 0x00, 0x0C, 0xE3, 0x0F, 0x00, 0x10, 0xF2, 0x0F,
+    0x00, 0x12, 0x10, 0x10, 0x00, 0x00, 0x0C, 0x1C, 0x13, 0x17, 0x00, 0x85, 0x79, 0x70, 0x69, 0x63,
+    0x61, 0x6C, 0x00, 0x17, 0x08, 0x11, 0x17, 0x12, 0x13, 0x00, 0x85, 0x65, 0x6E, 0x74, 0x69, 0x61,
+    0x6C, 0x00, 0x44, 0xFB, 0x0F, 0x00, 0x17, 0x05, 0x10, 0x00, 0x00, 0x1B, 0x11, 0x18, 0x00, 0x83,
+    0x6D, 0x61, 0x61, 0x6C, 0x00, 0x0C, 0x13, 0x12, 0x00, 0x84, 0x74, 0x69, 0x6D, 0x61, 0x6C, 0x00,
+    0x11, 0x0C, 0x17, 0x06, 0x08, 0x15, 0x0C, 0x07, 0x0C, 0x05, 0x00, 0x83, 0x6F, 0x6E, 0x61, 0x6C,
+    0x00, 0x04, 0x0C, 0x17, 0x0C, 0x15, 0x06, 0x00, 0x82, 0x63, 0x61, 0x6C, 0x00, 0x48, 0x36, 0x10,
+    0x00, 0x0F, 0x43, 0x10, 0x00, 0x00, 0x1A, 0x0B, 0x11, 0x0C, 0x13, 0x00, 0x84, 0x77, 0x68, 0x65,
+    0x65, 0x6C, 0x00, 0x0F, 0x15, 0x04, 0x04, 0x13, 0x00, 0x85, 0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C,
+    0x00, 0x16, 0x06, 0x0C, 0x09, 0x00, 0x83, 0x73, 0x63, 0x68, 0x6C, 0x00, 0x4F, 0x65, 0x10, 0x00,
+    0x18, 0x71, 0x10, 0x00, 0x00, 0x13, 0x0E, 0x06, 0x04, 0x0F, 0x05, 0x00, 0x82, 0x69, 0x6C, 0x6C,
+    0x00, 0x17, 0x13, 0x11, 0x13, 0x00, 0x83, 0x75, 0x74, 0x69, 0x6C, 0x00, 0x0C, 0x08, 0x13, 0x18,
+    0x0F, 0x05, 0x00, 0x84, 0x65, 0x70, 0x69, 0x6C, 0x6C, 0x00, 0x08, 0x15, 0x08, 0x0E, 0x00, 0x82,
+    0x6E, 0x65, 0x6C, 0x00, 0x04, 0x15, 0x08, 0x19, 0x0C, 0x11, 0x18, 0x00, 0x82, 0x73, 0x61, 0x6C,
+    0x00, 0x15, 0x0E, 0x10, 0x14, 0x00, 0x82, 0x75, 0x72, 0x6C, 0x00, 0x44, 0xC0, 0x10, 0x00, 0x08,
+    0xCE, 0x10, 0x00, 0x12, 0xF7, 0x10, 0x00, 0x15, 0x02, 0x11, 0x00, 0x18, 0x12, 0x11, 0x00, 0x00,
+    0x0B, 0x0A, 0x0C, 0x11, 0x0A, 0x00, 0x85, 0x69, 0x6E, 0x67, 0x68, 0x61, 0x6D, 0x00, 0x4F, 0xD7,
+    0x10, 0x00, 0x17, 0xE4, 0x10, 0x00, 0x00, 0x05, 0x15, 0x12, 0x13, 0x00, 0x85, 0x72, 0x6F, 0x62,
+    0x6C, 0x65, 0x6D, 0x00, 0x16, 0x1C, 0x16, 0x08, 0x0C, 0x0F, 0x09, 0x00, 0x88, 0x69, 0x6C, 0x65,
+    0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x00, 0x11, 0x07, 0x04, 0x15, 0x00, 0x83, 0x6E, 0x64, 0x6F,
+    0x6D, 0x00, 0x12, 0x09, 0x17, 0x0F, 0x04, 0x13, 0x00, 0x86, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72,
+    0x6D, 0x00, 0x47, 0x1B, 0x11, 0x00, 0x0A, 0x2A, 0x11, 0x00, 0x00, 0x0A, 0x11, 0x04, 0x0E, 0x06,
+    0x0C, 0x17, 0x16, 0x00, 0x83, 0x64, 0x67, 0x75, 0x6D, 0x00, 0x07, 0x11, 0x04, 0x0E, 0x0C, 0x06,
+    0x17, 0x16, 0x00, 0x88, 0x69, 0x63, 0x6B, 0x61, 0x6E, 0x64, 0x67, 0x75, 0x6D, 0x00, 0x44, 0x57,
+    0x11, 0x00, 0x0A, 0x77, 0x11, 0x00, 0x0B, 0x82, 0x11, 0x00, 0x0C, 0x8E, 0x11, 0x00, 0x10, 0x18,
+    0x12, 0x00, 0x12, 0x24, 0x12, 0x00, 0x00, 0x0C, 0x00, 0x51, 0x62, 0x11, 0x00, 0x17, 0x6F, 0x11,
+    0x00, 0x00, 0x17, 0x12, 0x16, 0x08, 0x00, 0x85, 0x74, 0x6F, 0x6E, 0x69, 0x61, 0x6E, 0x00, 0x05,
+    0x12, 0x00, 0x82, 0x61, 0x69, 0x6E, 0x00, 0x08, 0x08, 0x0F, 0x0C, 0x09, 0x00, 0x82, 0x67, 0x65,
+    0x6E, 0x00, 0x04, 0x17, 0x16, 0x16, 0x08, 0x0F, 0x00, 0x82, 0x68, 0x61, 0x6E, 0x00, 0x44, 0x9F,
+    0x11, 0x00, 0x09, 0xCA, 0x11, 0x00, 0x12, 0xD9, 0x11, 0x00, 0x17, 0x0D, 0x12, 0x00, 0x00, 0x45,
+    0xAC, 0x11, 0x00, 0x06, 0xB5, 0x11, 0x00, 0x11, 0xC1, 0x11, 0x00, 0x00, 0x15, 0x08, 0x16, 0x00,
+    0x82, 0x69, 0x61, 0x6E, 0x00, 0x0B, 0x05, 0x18, 0x16, 0x00, 0x84, 0x63, 0x68, 0x61, 0x69, 0x6E,
+    0x00, 0x04, 0x10, 0x12, 0x00, 0x55, 0xB0, 0x11, 0x00, 0x00, 0x09, 0x18, 0x06, 0x10, 0x10, 0x00,
+    0x86, 0x63, 0x6D, 0x75, 0x66, 0x66, 0x69, 0x6E, 0x00, 0x56, 0xE2, 0x11, 0x00, 0x17, 0xED, 0x11,
+    0x00, 0x00, 0x0C, 0x0F, 0x0F, 0x12, 0x06, 0x00, 0x82, 0x69, 0x6F, 0x6E, 0x00, 0x44, 0xF6, 0x11,
+    0x00, 0x06, 0x04, 0x12, 0x00, 0x00, 0x10, 0x15, 0x12, 0x09, 0x16, 0x11, 0x04, 0x15, 0x00, 0x57,
+    0xE8, 0x11, 0x00, 0x00, 0x08, 0x0D, 0x11, 0x00, 0x4C, 0xE8, 0x11, 0x00, 0x00, 0x04, 0x16, 0x18,
+    0x16, 0x00, 0x83, 0x74, 0x61, 0x69, 0x6E, 0x00, 0x04, 0x08, 0x06, 0x04, 0x13, 0x16, 0x00, 0x82,
+    0x6D, 0x61, 0x6E, 0x00, 0x47, 0x35, 0x12, 0x00, 0x0C, 0x47, 0x12, 0x00, 0x15, 0x55, 0x13, 0x00,
+    0x17, 0x62, 0x13, 0x00, 0x00, 0x12, 0x15, 0x0A, 0x0A, 0x0F, 0x08, 0x0C, 0x11, 0x04, 0x07, 0x00,
+    0x84, 0x6F, 0x72, 0x64, 0x6F, 0x6E, 0x00, 0x44, 0x58, 0x12, 0x00, 0x13, 0x7D, 0x12, 0x00, 0x16,
+    0x87, 0x12, 0x00, 0x17, 0x95, 0x12, 0x00, 0x00, 0x17, 0x00, 0x55, 0x63, 0x12, 0x00, 0x16, 0x70,
+    0x12, 0x00, 0x00, 0x0A, 0x08, 0x17, 0x11, 0x0C, 0x00, 0x84, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x0C, 0x0F, 0x04, 0x0C, 0x17, 0x0C, 0x11, 0x00, 0x4C, 0x69, 0x12, 0x00, 0x00, 0x17, 0x12, 0x00,
+    0x84, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x08, 0x19, 0x15, 0x00, 0x86, 0x65, 0x76, 0x69,
+    0x73, 0x69, 0x6F, 0x6E, 0x00, 0x44, 0xA2, 0x12, 0x00, 0x06, 0x11, 0x13, 0x00, 0x15, 0x25, 0x13,
+    0x00, 0x00, 0x4F, 0xB3, 0x12, 0x00, 0x16, 0xC8, 0x12, 0x00, 0x17, 0xDA, 0x12, 0x00, 0x18, 0xEE,
+    0x12, 0x00, 0x00, 0x0C, 0x13, 0x10, 0x06, 0x12, 0x08, 0x15, 0x00, 0x8A, 0x63, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x0F, 0x17, 0x0C, 0x18, 0x00, 0x89, 0x74,
+    0x69, 0x6C, 0x69, 0x73, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x08, 0x07, 0x15, 0x04, 0x17,
+    0x00, 0x8A, 0x72, 0x61, 0x64, 0x65, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0xF7,
+    0x12, 0x00, 0x0F, 0x04, 0x13, 0x00, 0x00, 0x17, 0x04, 0x00, 0x87, 0x63, 0x74, 0x75, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x00, 0x07, 0x12, 0x10, 0x00, 0x86, 0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x08, 0x13, 0x12, 0x16, 0x15, 0x17, 0x11, 0x0C, 0x00, 0x88, 0x6F, 0x73, 0x70, 0x65, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x44, 0x2E, 0x13, 0x00, 0x06, 0x4A, 0x13, 0x00, 0x00, 0x48, 0x37,
+    0x13, 0x00, 0x18, 0x42, 0x13, 0x00, 0x00, 0x13, 0x12, 0x00, 0x85, 0x72, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x17, 0x04, 0x00, 0x56, 0x3A, 0x13, 0x00, 0x00, 0x0C, 0x07, 0x00, 0x85, 0x72, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x06, 0x1C, 0x08, 0x0F, 0x15, 0x04, 0x05, 0x00, 0x82, 0x6F, 0x72,
+    0x6E, 0x00, 0x0C, 0x00, 0x44, 0x71, 0x13, 0x00, 0x13, 0x91, 0x13, 0x00, 0x18, 0x9A, 0x13, 0x00,
+    0x00, 0x46, 0x7A, 0x13, 0x00, 0x18, 0x88, 0x13, 0x00, 0x00, 0x0C, 0x11, 0x18, 0x10, 0x10, 0x12,
+    0x06, 0x00, 0x83, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0F, 0x04, 0x19, 0x00, 0x48, 0x82, 0x13, 0x00,
+    0x00, 0x08, 0x06, 0x11, 0x00, 0x4C, 0x82, 0x13, 0x00, 0x00, 0x05, 0x0C, 0x15, 0x17, 0x11, 0x12,
+    0x00, 0x46, 0x82, 0x13, 0x00, 0x00, 0x45, 0xB3, 0x13, 0x00, 0x0A, 0xD2, 0x13, 0x00, 0x0C, 0xE4,
+    0x13, 0x00, 0x00, 0x44, 0xBC, 0x13, 0x00, 0x0E, 0xC5, 0x13, 0x00, 0x00, 0x12, 0x07, 0x0C, 0x00,
+    0x82, 0x62, 0x61, 0x6F, 0x00, 0x12, 0x12, 0x04, 0x10, 0x18, 0x0E, 0x00, 0x83, 0x6B, 0x6F, 0x62,
+    0x6F, 0x00, 0x0E, 0x06, 0x18, 0x0E, 0x07, 0x06, 0x18, 0x07, 0x00, 0x86, 0x6B, 0x64, 0x75, 0x63,
+    0x6B, 0x67, 0x6F, 0x00, 0x07, 0x18, 0x17, 0x0F, 0x16, 0x04, 0x18, 0x16, 0x0C, 0x19, 0x00, 0x86,
+    0x6C, 0x73, 0x74, 0x75, 0x64, 0x69, 0x6F, 0x00, 0x44, 0x0D, 0x14, 0x00, 0x08, 0x17, 0x14, 0x00,
+    0x12, 0x24, 0x14, 0x00, 0x13, 0x30, 0x14, 0x00, 0x18, 0x44, 0x14, 0x00, 0x00, 0x16, 0x05, 0x16,
+    0x18, 0x00, 0x82, 0x61, 0x73, 0x70, 0x00, 0x16, 0x17, 0x08, 0x07, 0x0C, 0x16, 0x00, 0x83, 0x73,
+    0x74, 0x65, 0x70, 0x00, 0x07, 0x15, 0x06, 0x0C, 0x10, 0x00, 0x83, 0x64, 0x72, 0x6F, 0x70, 0x00,
+    0x04, 0x07, 0x15, 0x12, 0x06, 0x0C, 0x16, 0x07, 0x00, 0x88, 0x69, 0x73, 0x63, 0x6F, 0x72, 0x64,
+    0x61, 0x70, 0x70, 0x00, 0x1B, 0x0C, 0x18, 0x09, 0x00, 0x84, 0x69, 0x75, 0x78, 0x75, 0x70, 0x00,
+    0x15, 0x08, 0x16, 0x1C, 0x16, 0x00, 0x82, 0x72, 0x65, 0x71, 0x00, 0x44, 0x88, 0x14, 0x00, 0x07,
+    0xC1, 0x14, 0x00, 0x08, 0xCE, 0x14, 0x00, 0x0A, 0xA0, 0x15, 0x00, 0x0B, 0xAC, 0x15, 0x00, 0x12,
+    0xB6, 0x15, 0x00, 0x16, 0xD9, 0x15, 0x00, 0x17, 0xE3, 0x15, 0x00, 0x18, 0x0A, 0x16, 0x00, 0x1A,
+    0x15, 0x16, 0x00, 0x1B, 0x21, 0x16, 0x00, 0x00, 0x48, 0x95, 0x14, 0x00, 0x17, 0xA6, 0x14, 0x00,
+    0x19, 0xB1, 0x14, 0x00, 0x00, 0x0A, 0x04, 0x15, 0x17, 0x16, 0x11, 0x12, 0x10, 0x00, 0x85, 0x61,
+    0x72, 0x67, 0x65, 0x61, 0x72, 0x00, 0x18, 0x0C, 0x0A, 0x00, 0x84, 0x75, 0x69, 0x74, 0x61, 0x72,
+    0x00, 0x08, 0x12, 0x06, 0x0B, 0x10, 0x04, 0x16, 0x00, 0x85, 0x6F, 0x63, 0x65, 0x76, 0x61, 0x72,
+    0x00, 0x08, 0x11, 0x18, 0x07, 0x08, 0x0F, 0x12, 0x00, 0x82, 0x64, 0x65, 0x72, 0x00, 0x44, 0xF3,
+    0x14, 0x00, 0x07, 0x1D, 0x15, 0x00, 0x08, 0x2C, 0x15, 0x00, 0x0A, 0x36, 0x15, 0x00, 0x0B, 0x42,
+    0x15, 0x00, 0x0F, 0x57, 0x15, 0x00, 0x13, 0x7A, 0x15, 0x00, 0x15, 0x85, 0x15, 0x00, 0x1A, 0x95,
+    0x15, 0x00, 0x00, 0x47, 0x00, 0x15, 0x00, 0x0E, 0x09, 0x15, 0x00, 0x17, 0x13, 0x15, 0x00, 0x00,
+    0x08, 0x0B, 0x00, 0x83, 0x61, 0x64, 0x65, 0x72, 0x00, 0x08, 0x13, 0x16, 0x00, 0x83, 0x61, 0x6B,
+    0x65, 0x72, 0x00, 0x08, 0x15, 0x0A, 0x00, 0x83, 0x61, 0x74, 0x65, 0x72, 0x00, 0x0F, 0x09, 0x12,
+    0x05, 0x18, 0x16, 0x00, 0x85, 0x66, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x00, 0x13, 0x08, 0x07, 0x00,
+    0x83, 0x65, 0x70, 0x65, 0x72, 0x00, 0x17, 0x08, 0x11, 0x0C, 0x00, 0x84, 0x74, 0x65, 0x67, 0x65,
+    0x72, 0x00, 0x17, 0x0A, 0x0C, 0x00, 0x55, 0x4F, 0x15, 0x00, 0x17, 0x51, 0x15, 0x00, 0x00, 0x05,
+    0x00, 0x83, 0x68, 0x74, 0x65, 0x72, 0x00, 0x44, 0x60, 0x15, 0x00, 0x16, 0x6A, 0x15, 0x00, 0x00,
+    0x0F, 0x06, 0x00, 0x84, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x00, 0x09, 0x04, 0x16, 0x04, 0x11, 0x12,
+    0x0D, 0x00, 0x85, 0x66, 0x61, 0x73, 0x6C, 0x65, 0x72, 0x00, 0x17, 0x04, 0x07, 0x04, 0x00, 0x83,
+    0x70, 0x74, 0x65, 0x72, 0x00, 0x16, 0x04, 0x13, 0x0A, 0x0C, 0x09, 0x11, 0x12, 0x06, 0x00, 0x83,
+    0x72, 0x73, 0x65, 0x72, 0x00, 0x0F, 0x12, 0x16, 0x00, 0x84, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x00,
+    0x08, 0x11, 0x12, 0x15, 0x17, 0x16, 0x00, 0x82, 0x67, 0x65, 0x72, 0x00, 0x08, 0x0A, 0x0C, 0x0B,
+    0x00, 0x82, 0x68, 0x65, 0x72, 0x00, 0x44, 0xBF, 0x15, 0x00, 0x17, 0xCC, 0x15, 0x00, 0x00, 0x17,
+    0x15, 0x12, 0x06, 0x08, 0x07, 0x00, 0x83, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x0C, 0x16, 0x16, 0x08,
+    0x15, 0x00, 0x84, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x00, 0x12, 0x11, 0x08, 0x16, 0x00, 0x82, 0x73,
+    0x6F, 0x72, 0x00, 0x08, 0x00, 0x51, 0xEE, 0x15, 0x00, 0x17, 0x00, 0x16, 0x00, 0x00, 0x0C, 0x00,
+    0x44, 0xF9, 0x15, 0x00, 0x15, 0xF9, 0x15, 0x00, 0x00, 0x13, 0x00, 0x82, 0x74, 0x65, 0x72, 0x00,
+    0x08, 0x16, 0x11, 0x18, 0x00, 0x56, 0xFB, 0x15, 0x00, 0x00, 0x0F, 0x12, 0x12, 0x06, 0x00, 0x83,
+    0x6C, 0x6F, 0x75, 0x72, 0x00, 0x08, 0x08, 0x0C, 0x19, 0x08, 0x15, 0x00, 0x82, 0x77, 0x65, 0x72,
+    0x00, 0x08, 0x08, 0x0F, 0x13, 0x0C, 0x17, 0x0F, 0x18, 0x10, 0x00, 0x82, 0x78, 0x65, 0x72, 0x00,
+    0x45, 0x81, 0x16, 0x00, 0x06, 0xA4, 0x16, 0x00, 0x07, 0xD4, 0x16, 0x00, 0x08, 0x5B, 0x17, 0x00,
+    0x0A, 0x5C, 0x19, 0x00, 0x0B, 0x99, 0x19, 0x00, 0x0C, 0xA4, 0x19, 0x00, 0x0E, 0xB0, 0x19, 0x00,
+    0x0F, 0x02, 0x1A, 0x00, 0x11, 0x14, 0x1A, 0x00, 0x12, 0xF8, 0x1A, 0x00, 0x13, 0x51, 0x1B, 0x00,
+    0x15, 0x72, 0x1B, 0x00, 0x16, 0x33, 0x1C, 0x00, 0x17, 0x5C, 0x1C, 0x00, 0x18, 0x22, 0x1D, 0x00,
+    0x19, 0x67, 0x1D, 0x00, 0x1B, 0x89, 0x1D, 0x00, 0x1C, 0x95, 0x1D, 0x00, 0x1D, 0xA0, 0x1D, 0x00,
+    0x00, 0x44, 0x8A, 0x16, 0x00, 0x0C, 0x98, 0x16, 0x00, 0x00, 0x0F, 0x04, 0x09, 0x08, 0x0F, 0x00,
+    0x85, 0x61, 0x66, 0x6C, 0x61, 0x62, 0x73, 0x00, 0x0E, 0x0C, 0x06, 0x11, 0x00, 0x84, 0x6B, 0x69,
+    0x69, 0x62, 0x73, 0x00, 0x4C, 0xB1, 0x16, 0x00, 0x16, 0xBF, 0x16, 0x00, 0x17, 0xC9, 0x16, 0x00,
+    0x00, 0x04, 0x11, 0x0B, 0x06, 0x08, 0x10, 0x00, 0x84, 0x61, 0x6E, 0x69, 0x63, 0x73, 0x00, 0x0C,
+    0x04, 0x05, 0x00, 0x83, 0x73, 0x69, 0x63, 0x73, 0x00, 0x08, 0x0D, 0x12, 0x15, 0x13, 0x00, 0x82,
+    0x63, 0x74, 0x73, 0x00, 0x48, 0xE5, 0x16, 0x00, 0x0C, 0x25, 0x17, 0x00, 0x11, 0x36, 0x17, 0x00,
+    0x15, 0x47, 0x17, 0x00, 0x00, 0x08, 0x00, 0x55, 0xF0, 0x16, 0x00, 0x16, 0xFE, 0x16, 0x00, 0x00,
+    0x16, 0x08, 0x13, 0x18, 0x16, 0x00, 0x85, 0x72, 0x73, 0x65, 0x65, 0x64, 0x73, 0x00, 0x48, 0x07,
+    0x17, 0x00, 0x15, 0x15, 0x17, 0x00, 0x00, 0x15, 0x13, 0x18, 0x16, 0x00, 0x86, 0x65, 0x72, 0x73,
+    0x65, 0x65, 0x64, 0x73, 0x00, 0x08, 0x18, 0x13, 0x16, 0x00, 0x88, 0x75, 0x70, 0x65, 0x72, 0x73,
+    0x65, 0x65, 0x64, 0x73, 0x00, 0x12, 0x11, 0x08, 0x12, 0x0F, 0x16, 0x00, 0x87, 0x6F, 0x6C, 0x65,
+    0x6E, 0x6F, 0x69, 0x64, 0x73, 0x00, 0x18, 0x15, 0x12, 0x0A, 0x0E, 0x06, 0x04, 0x05, 0x00, 0x85,
+    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x73, 0x00, 0x04, 0x12, 0x16, 0x05, 0x0C, 0x15, 0x12, 0x0C, 0x08,
+    0x13, 0x00, 0x86, 0x73, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x73, 0x00, 0x44, 0x9C, 0x17, 0x00, 0x06,
+    0xDF, 0x17, 0x00, 0x07, 0x04, 0x18, 0x00, 0x08, 0x10, 0x18, 0x00, 0x0A, 0x1A, 0x18, 0x00, 0x0B,
+    0x2D, 0x18, 0x00, 0x0C, 0x3C, 0x18, 0x00, 0x0F, 0x7D, 0x18, 0x00, 0x11, 0x90, 0x18, 0x00, 0x13,
+    0x99, 0x18, 0x00, 0x15, 0xA9, 0x18, 0x00, 0x16, 0xD2, 0x18, 0x00, 0x17, 0xFA, 0x18, 0x00, 0x18,
+    0x07, 0x19, 0x00, 0x19, 0x2A, 0x19, 0x00, 0x1C, 0x4F, 0x19, 0x00, 0x00, 0x50, 0xA9, 0x17, 0x00,
+    0x16, 0xB2, 0x17, 0x00, 0x17, 0xBE, 0x17, 0x00, 0x00, 0x15, 0x09, 0x00, 0x83, 0x61, 0x6D, 0x65,
+    0x73, 0x00, 0x05, 0x08, 0x07, 0x12, 0x06, 0x00, 0x83, 0x61, 0x73, 0x65, 0x73, 0x00, 0x46, 0xC7,
+    0x17, 0x00, 0x15, 0xD3, 0x17, 0x00, 0x00, 0x0C, 0x0F, 0x13, 0x08, 0x15, 0x00, 0x83, 0x61, 0x74,
+    0x65, 0x73, 0x00, 0x12, 0x13, 0x15, 0x12, 0x06, 0x11, 0x00, 0x4C, 0xCD, 0x17, 0x00, 0x00, 0x44,
+    0xE8, 0x17, 0x00, 0x08, 0xF5, 0x17, 0x00, 0x00, 0x15, 0x09, 0x18, 0x16, 0x00, 0x85, 0x72, 0x66,
+    0x61, 0x63, 0x65, 0x73, 0x00, 0x11, 0x15, 0x08, 0x09, 0x08, 0x15, 0x13, 0x00, 0x84, 0x65, 0x6E,
+    0x63, 0x65, 0x73, 0x00, 0x0C, 0x12, 0x0F, 0x08, 0x10, 0x00, 0x83, 0x64, 0x69, 0x65, 0x73, 0x00,
+    0x15, 0x0B, 0x17, 0x00, 0x83, 0x65, 0x72, 0x65, 0x73, 0x00, 0x04, 0x17, 0x11, 0x04, 0x07, 0x19,
+    0x04, 0x00, 0x88, 0x64, 0x76, 0x61, 0x6E, 0x74, 0x61, 0x67, 0x65, 0x73, 0x00, 0x16, 0x0C, 0x0C,
+    0x11, 0x09, 0x00, 0x86, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x65, 0x73, 0x00, 0x4A, 0x49, 0x18, 0x00,
+    0x15, 0x5F, 0x18, 0x00, 0x17, 0x6F, 0x18, 0x00, 0x00, 0x12, 0x0F, 0x12, 0x11, 0x0B, 0x08, 0x06,
+    0x17, 0x00, 0x8A, 0x65, 0x63, 0x68, 0x6E, 0x6F, 0x6C, 0x6F, 0x67, 0x69, 0x65, 0x73, 0x00, 0x12,
+    0x08, 0x0A, 0x17, 0x04, 0x06, 0x00, 0x86, 0x65, 0x67, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x00, 0x0F,
+    0x0C, 0x0C, 0x17, 0x18, 0x00, 0x85, 0x6C, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x0A, 0x11, 0x04,
+    0x17, 0x08, 0x06, 0x15, 0x00, 0x88, 0x65, 0x63, 0x74, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x73, 0x00,
+    0x1D, 0x12, 0x07, 0x00, 0x82, 0x65, 0x6E, 0x73, 0x00, 0x1C, 0x17, 0x17, 0x04, 0x04, 0x07, 0x00,
+    0x86, 0x74, 0x61, 0x74, 0x79, 0x70, 0x65, 0x73, 0x00, 0x45, 0xB6, 0x18, 0x00, 0x09, 0xC1, 0x18,
+    0x00, 0x13, 0xC9, 0x18, 0x00, 0x00, 0x10, 0x08, 0x10, 0x08, 0x15, 0x00, 0x82, 0x65, 0x72, 0x73,
+    0x00, 0x09, 0x18, 0x00, 0x45, 0xBC, 0x18, 0x00, 0x00, 0x13, 0x0C, 0x11, 0x00, 0x56, 0xBC, 0x18,
+    0x00, 0x00, 0x4B, 0xDF, 0x18, 0x00, 0x11, 0xE9, 0x18, 0x00, 0x15, 0xF2, 0x18, 0x00, 0x00, 0x18,
+    0x0F, 0x09, 0x00, 0x83, 0x73, 0x68, 0x65, 0x73, 0x00, 0x17, 0x0C, 0x09, 0x00, 0x82, 0x65, 0x73,
+    0x73, 0x00, 0x13, 0x08, 0x00, 0x55, 0xED, 0x18, 0x00, 0x00, 0x0F, 0x04, 0x18, 0x10, 0x08, 0x00,
+    0x84, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x00, 0x51, 0x10, 0x19, 0x00, 0x15, 0x20, 0x19, 0x00, 0x00,
+    0x0C, 0x17, 0x12, 0x11, 0x06, 0x00, 0x87, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x73, 0x00,
+    0x16, 0x11, 0x08, 0x00, 0x83, 0x75, 0x72, 0x65, 0x73, 0x00, 0x48, 0x33, 0x19, 0x00, 0x0C, 0x43,
+    0x19, 0x00, 0x00, 0x0C, 0x15, 0x08, 0x17, 0x15, 0x00, 0x87, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76,
+    0x65, 0x73, 0x00, 0x17, 0x15, 0x16, 0x00, 0x85, 0x74, 0x72, 0x69, 0x76, 0x65, 0x73, 0x00, 0x0E,
+    0x11, 0x12, 0x11, 0x11, 0x04, 0x06, 0x00, 0x82, 0x65, 0x79, 0x73, 0x00, 0x51, 0x65, 0x19, 0x00,
+    0x13, 0x8E, 0x19, 0x00, 0x00, 0x0C, 0x15, 0x00, 0x56, 0x71, 0x19, 0x00, 0x17, 0x7F, 0x19, 0x00,
+    0x00, 0x17, 0x05, 0x18, 0x16, 0x00, 0x86, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x06,
+    0x16, 0x12, 0x07, 0x00, 0x87, 0x63, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x0E, 0x1B,
+    0x0C, 0x11, 0x00, 0x83, 0x70, 0x6B, 0x67, 0x73, 0x00, 0x13, 0x17, 0x08, 0x07, 0x00, 0x83, 0x70,
+    0x74, 0x68, 0x73, 0x00, 0x0F, 0x04, 0x08, 0x07, 0x04, 0x00, 0x83, 0x6C, 0x61, 0x69, 0x73, 0x00,
+    0x44, 0xC1, 0x19, 0x00, 0x11, 0xDD, 0x19, 0x00, 0x12, 0xE8, 0x19, 0x00, 0x15, 0xF4, 0x19, 0x00,
+    0x00, 0x46, 0xCA, 0x19, 0x00, 0x15, 0xD3, 0x19, 0x00, 0x00, 0x15, 0x17, 0x00, 0x83, 0x61, 0x63,
+    0x6B, 0x73, 0x00, 0x08, 0x05, 0x00, 0x84, 0x72, 0x65, 0x61, 0x6B, 0x73, 0x00, 0x0B, 0x04, 0x17,
+    0x00, 0x84, 0x68, 0x61, 0x6E, 0x6B, 0x73, 0x00, 0x15, 0x1A, 0x11, 0x0C, 0x0F, 0x00, 0x83, 0x6F,
+    0x72, 0x6B, 0x73, 0x00, 0x1A, 0x12, 0x11, 0x12, 0x08, 0x0A, 0x00, 0x84, 0x77, 0x6F, 0x72, 0x6B,
+    0x73, 0x00, 0x04, 0x15, 0x0B, 0x08, 0x13, 0x0C, 0x15, 0x08, 0x13, 0x00, 0x85, 0x68, 0x65, 0x72,
+    0x61, 0x6C, 0x73, 0x00, 0x44, 0x29, 0x1A, 0x00, 0x0B, 0x49, 0x1A, 0x00, 0x0E, 0x53, 0x1A, 0x00,
+    0x12, 0x5C, 0x1A, 0x00, 0x17, 0xEC, 0x1A, 0x00, 0x00, 0x47, 0x32, 0x1A, 0x00, 0x0C, 0x3D, 0x1A,
+    0x00, 0x00, 0x09, 0x05, 0x0E, 0x00, 0x84, 0x64, 0x66, 0x61, 0x6E, 0x73, 0x00, 0x17, 0x11, 0x0C,
+    0x04, 0x10, 0x00, 0x83, 0x61, 0x69, 0x6E, 0x73, 0x00, 0x0F, 0x07, 0x04, 0x00, 0x83, 0x68, 0x6C,
+    0x6E, 0x73, 0x00, 0x18, 0x0B, 0x06, 0x00, 0x82, 0x6E, 0x6B, 0x73, 0x00, 0x4C, 0x65, 0x1A, 0x00,
+    0x16, 0xDA, 0x1A, 0x00, 0x00, 0x56, 0x6E, 0x1A, 0x00, 0x17, 0x84, 0x1A, 0x00, 0x00, 0x11, 0x08,
+    0x17, 0x08, 0x1B, 0x10, 0x19, 0x0F, 0x0F, 0x00, 0x89, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69,
+    0x6F, 0x6E, 0x73, 0x00, 0x04, 0x00, 0x4F, 0x97, 0x1A, 0x00, 0x15, 0xA9, 0x1A, 0x00, 0x19, 0xB8,
+    0x1A, 0x00, 0x1D, 0xC8, 0x1A, 0x00, 0x00, 0x13, 0x18, 0x0C, 0x11, 0x04, 0x10, 0x00, 0x88, 0x70,
+    0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x13, 0x08, 0x12, 0x00, 0x88, 0x70, 0x65,
+    0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x17, 0x0C, 0x12, 0x10, 0x00, 0x88, 0x74, 0x69,
+    0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x10, 0x0C, 0x0C, 0x17, 0x13, 0x12, 0x00, 0x88,
+    0x6D, 0x69, 0x7A, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x0C, 0x11, 0x08, 0x0B, 0x08, 0x15,
+    0x13, 0x10, 0x12, 0x06, 0x00, 0x84, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x04, 0x17, 0x16, 0x11,
+    0x12, 0x06, 0x00, 0x82, 0x6E, 0x74, 0x73, 0x00, 0x48, 0x05, 0x1B, 0x00, 0x11, 0x10, 0x1B, 0x00,
+    0x18, 0x47, 0x1B, 0x00, 0x00, 0x0C, 0x07, 0x19, 0x00, 0x84, 0x69, 0x64, 0x65, 0x6F, 0x73, 0x00,
+    0x0C, 0x17, 0x04, 0x00, 0x46, 0x1D, 0x1B, 0x00, 0x16, 0x3B, 0x1B, 0x00, 0x00, 0x48, 0x26, 0x1B,
+    0x00, 0x0C, 0x30, 0x1B, 0x00, 0x00, 0x15, 0x13, 0x08, 0x07, 0x00, 0x82, 0x6F, 0x6E, 0x73, 0x00,
+    0x09, 0x04, 0x0F, 0x04, 0x12, 0x00, 0x4E, 0x2B, 0x1B, 0x00, 0x00, 0x0C, 0x10, 0x12, 0x17, 0x16,
+    0x18, 0x00, 0x46, 0x2B, 0x1B, 0x00, 0x00, 0x0C, 0x15, 0x18, 0x06, 0x00, 0x82, 0x6F, 0x75, 0x73,
+    0x00, 0x57, 0x5A, 0x1B, 0x00, 0x18, 0x65, 0x1B, 0x00, 0x00, 0x08, 0x06, 0x11, 0x12, 0x06, 0x00,
+    0x82, 0x70, 0x74, 0x73, 0x00, 0x0E, 0x12, 0x06, 0x0F, 0x00, 0x85, 0x6F, 0x63, 0x6B, 0x75, 0x70,
+    0x73, 0x00, 0x44, 0x8F, 0x1B, 0x00, 0x07, 0x9C, 0x1B, 0x00, 0x08, 0xB7, 0x1B, 0x00, 0x0B, 0xEB,
+    0x1B, 0x00, 0x0E, 0xFC, 0x1B, 0x00, 0x12, 0x06, 0x1C, 0x00, 0x17, 0x16, 0x1C, 0x00, 0x00, 0x13,
+    0x08, 0x16, 0x13, 0x11, 0x00, 0x84, 0x70, 0x65, 0x61, 0x72, 0x73, 0x00, 0x44, 0xA5, 0x1B, 0x00,
+    0x12, 0xAD, 0x1B, 0x00, 0x00, 0x18, 0x0A, 0x00, 0x82, 0x72, 0x64, 0x73, 0x00, 0x1A, 0x16, 0x16,
+    0x04, 0x00, 0x53, 0xA8, 0x1B, 0x00, 0x00, 0x46, 0xC4, 0x1B, 0x00, 0x12, 0xD2, 0x1B, 0x00, 0x17,
+    0xDB, 0x1B, 0x00, 0x00, 0x17, 0x04, 0x15, 0x04, 0x0B, 0x06, 0x00, 0x84, 0x63, 0x74, 0x65, 0x72,
+    0x73, 0x00, 0x11, 0x0A, 0x0C, 0x00, 0x82, 0x72, 0x65, 0x73, 0x00, 0x06, 0x15, 0x04, 0x04, 0x0B,
+    0x06, 0x00, 0x86, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x00, 0x08, 0x13, 0x04, 0x15, 0x0A,
+    0x12, 0x11, 0x08, 0x17, 0x16, 0x00, 0x83, 0x68, 0x65, 0x72, 0x73, 0x00, 0x12, 0x1A, 0x11, 0x07,
+    0x00, 0x82, 0x72, 0x6B, 0x73, 0x00, 0x17, 0x16, 0x16, 0x0C, 0x08, 0x15, 0x00, 0x86, 0x73, 0x69,
+    0x73, 0x74, 0x6F, 0x72, 0x73, 0x00, 0x12, 0x00, 0x44, 0x21, 0x1C, 0x00, 0x0C, 0x2C, 0x1C, 0x00,
+    0x00, 0x18, 0x17, 0x06, 0x04, 0x00, 0x83, 0x74, 0x6F, 0x72, 0x73, 0x00, 0x07, 0x00, 0x48, 0x26,
+    0x1C, 0x00, 0x00, 0x48, 0x3C, 0x1C, 0x00, 0x0C, 0x52, 0x1C, 0x00, 0x00, 0x04, 0x15, 0x00, 0x48,
+    0x48, 0x1C, 0x00, 0x0B, 0x4D, 0x1C, 0x00, 0x00, 0x82, 0x73, 0x65, 0x73, 0x00, 0x53, 0x48, 0x1C,
+    0x00, 0x00, 0x08, 0x11, 0x08, 0x0A, 0x00, 0x82, 0x73, 0x69, 0x73, 0x00, 0x44, 0x79, 0x1C, 0x00,
+    0x06, 0x85, 0x1C, 0x00, 0x08, 0x95, 0x1C, 0x00, 0x0C, 0xB3, 0x1C, 0x00, 0x11, 0xBF, 0x1C, 0x00,
+    0x12, 0x0F, 0x1D, 0x00, 0x18, 0x18, 0x1D, 0x00, 0x00, 0x19, 0x08, 0x04, 0x06, 0x00, 0x84, 0x76,
+    0x65, 0x61, 0x74, 0x73, 0x00, 0x0C, 0x0F, 0x11, 0x09, 0x12, 0x06, 0x00, 0x86, 0x6E, 0x66, 0x6C,
+    0x69, 0x63, 0x74, 0x73, 0x00, 0x04, 0x00, 0x4A, 0xA0, 0x1C, 0x00, 0x13, 0xAA, 0x1C, 0x00, 0x00,
+    0x0C, 0x17, 0x0C, 0x10, 0x00, 0x82, 0x74, 0x65, 0x73, 0x00, 0x08, 0x15, 0x00, 0x83, 0x65, 0x61,
+    0x74, 0x73, 0x00, 0x08, 0x07, 0x15, 0x06, 0x00, 0x84, 0x65, 0x64, 0x69, 0x74, 0x73, 0x00, 0x48,
+    0xC8, 0x1C, 0x00, 0x10, 0xED, 0x1C, 0x00, 0x00, 0x10, 0x00, 0x48, 0xD3, 0x1C, 0x00, 0x0A, 0xDF,
+    0x1C, 0x00, 0x00, 0x0A, 0x16, 0x00, 0x86, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x00, 0x15,
+    0x04, 0x09, 0x00, 0x87, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x00, 0x08, 0x00, 0x48,
+    0xF8, 0x1C, 0x00, 0x11, 0x04, 0x1D, 0x00, 0x00, 0x17, 0x04, 0x17, 0x16, 0x00, 0x84, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x00, 0x12, 0x15, 0x0C, 0x19, 0x11, 0x00, 0x48, 0xFD, 0x1C, 0x00, 0x00, 0x11,
+    0x08, 0x06, 0x00, 0x82, 0x74, 0x6F, 0x73, 0x00, 0x11, 0x12, 0x06, 0x00, 0x83, 0x75, 0x6E, 0x74,
+    0x73, 0x00, 0x47, 0x2F, 0x1D, 0x00, 0x12, 0x39, 0x1D, 0x00, 0x17, 0x5D, 0x1D, 0x00, 0x00, 0x0C,
+    0x04, 0x15, 0x00, 0x83, 0x64, 0x69, 0x75, 0x73, 0x00, 0x48, 0x42, 0x1D, 0x00, 0x0C, 0x51, 0x1D,
+    0x00, 0x00, 0x11, 0x15, 0x12, 0x15, 0x08, 0x00, 0x86, 0x72, 0x6F, 0x6E, 0x65, 0x6F, 0x75, 0x73,
+    0x00, 0x04, 0x15, 0x19, 0x00, 0x85, 0x61, 0x72, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x1C, 0x04,
+    0x0F, 0x00, 0x82, 0x75, 0x74, 0x73, 0x00, 0x08, 0x0C, 0x17, 0x00, 0x44, 0x74, 0x1D, 0x00, 0x06,
+    0x80, 0x1D, 0x00, 0x00, 0x11, 0x15, 0x08, 0x17, 0x0F, 0x04, 0x00, 0x82, 0x76, 0x65, 0x73, 0x00,
+    0x08, 0x15, 0x0C, 0x00, 0x47, 0x7B, 0x1D, 0x00, 0x00, 0x17, 0x08, 0x17, 0x11, 0x12, 0x06, 0x00,
+    0x82, 0x78, 0x74, 0x73, 0x00, 0x0F, 0x04, 0x08, 0x07, 0x00, 0x83, 0x6C, 0x61, 0x79, 0x73, 0x00,
+    0x08, 0x08, 0x08, 0x15, 0x09, 0x00, 0x82, 0x7A, 0x65, 0x73, 0x00, 0x44, 0xD8, 0x1D, 0x00, 0x06,
+    0x24, 0x1E, 0x00, 0x08, 0x6B, 0x1E, 0x00, 0x0A, 0xB9, 0x1E, 0x00, 0x0B, 0xC3, 0x1E, 0x00, 0x0C,
+    0xE3, 0x1E, 0x00, 0x11, 0xF3, 0x1E, 0x00, 0x12, 0xB6, 0x1F, 0x00, 0x15, 0xCA, 0x1F, 0x00, 0x16,
+    0xEC, 0x1F, 0x00, 0x18, 0x4D, 0x20, 0x00, 0x00, 0x50, 0xE5, 0x1D, 0x00, 0x11, 0xFA, 0x1D, 0x00,
+    0x15, 0x17, 0x1E, 0x00, 0x00, 0x15, 0x12, 0x09, 0x0A, 0x11, 0x0F, 0x04, 0x06, 0x00, 0x89, 0x6C,
+    0x61, 0x6E, 0x67, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x00, 0x47, 0x03, 0x1E, 0x00, 0x0B, 0x0E,
+    0x1E, 0x00, 0x00, 0x11, 0x18, 0x07, 0x08, 0x15, 0x00, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x13, 0x08,
+    0x0F, 0x00, 0x48, 0x09, 0x1E, 0x00, 0x00, 0x0E, 0x04, 0x06, 0x13, 0x00, 0x85, 0x61, 0x63, 0x6B,
+    0x72, 0x61, 0x74, 0x00, 0x44, 0x35, 0x1E, 0x00, 0x08, 0x46, 0x1E, 0x00, 0x13, 0x53, 0x1E, 0x00,
+    0x18, 0x5E, 0x1E, 0x00, 0x00, 0x15, 0x08, 0x11, 0x17, 0x18, 0x12, 0x06, 0x00, 0x86, 0x6E, 0x74,
+    0x65, 0x72, 0x61, 0x63, 0x74, 0x00, 0x15, 0x0C, 0x06, 0x07, 0x00, 0x85, 0x69, 0x63, 0x72, 0x65,
+    0x63, 0x74, 0x00, 0x04, 0x10, 0x12, 0x06, 0x00, 0x83, 0x70, 0x61, 0x63, 0x74, 0x00, 0x07, 0x12,
+    0x11, 0x06, 0x00, 0x85, 0x6F, 0x6E, 0x64, 0x75, 0x63, 0x74, 0x00, 0x4F, 0x78, 0x1E, 0x00, 0x10,
+    0x84, 0x1E, 0x00, 0x11, 0x8E, 0x1E, 0x00, 0x00, 0x04, 0x15, 0x06, 0x16, 0x00, 0x84, 0x61, 0x72,
+    0x6C, 0x65, 0x74, 0x00, 0x16, 0x08, 0x10, 0x00, 0x83, 0x6D, 0x73, 0x65, 0x74, 0x00, 0x4C, 0x9B,
+    0x1E, 0x00, 0x15, 0xA4, 0x1E, 0x00, 0x16, 0xB2, 0x1E, 0x00, 0x00, 0x06, 0x11, 0x04, 0x00, 0x82,
+    0x65, 0x6E, 0x74, 0x00, 0x08, 0x17, 0x0B, 0x08, 0x00, 0x86, 0x74, 0x68, 0x65, 0x72, 0x6E, 0x65,
+    0x74, 0x00, 0x11, 0x00, 0x58, 0x9F, 0x1E, 0x00, 0x00, 0x08, 0x15, 0x12, 0x09, 0x00, 0x82, 0x67,
+    0x65, 0x74, 0x00, 0x4A, 0xCC, 0x1E, 0x00, 0x18, 0xD9, 0x1E, 0x00, 0x00, 0x0F, 0x0C, 0x05, 0x0A,
+    0x15, 0x00, 0x84, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x00, 0x0A, 0x12, 0x16, 0x00, 0x83, 0x75, 0x67,
+    0x68, 0x74, 0x00, 0x18, 0x15, 0x09, 0x07, 0x04, 0x04, 0x00, 0x86, 0x64, 0x61, 0x66, 0x72, 0x75,
+    0x69, 0x74, 0x00, 0x44, 0x0C, 0x1F, 0x00, 0x06, 0x33, 0x1F, 0x00, 0x08, 0x3E, 0x1F, 0x00, 0x0C,
+    0x7D, 0x1F, 0x00, 0x15, 0xA0, 0x1F, 0x00, 0x17, 0xAB, 0x1F, 0x00, 0x00, 0x17, 0x00, 0x4C, 0x17,
+    0x1F, 0x00, 0x16, 0x24, 0x1F, 0x00, 0x00, 0x16, 0x16, 0x16, 0x04, 0x00, 0x85, 0x69, 0x73, 0x74,
+    0x61, 0x6E, 0x74, 0x00, 0x0C, 0x08, 0x16, 0x15, 0x00, 0x87, 0x65, 0x73, 0x69, 0x73, 0x74, 0x61,
+    0x6E, 0x74, 0x00, 0x08, 0x15, 0x08, 0x13, 0x00, 0x83, 0x63, 0x65, 0x6E, 0x74, 0x00, 0x50, 0x47,
+    0x1F, 0x00, 0x16, 0x6F, 0x1F, 0x00, 0x00, 0x46, 0x50, 0x1F, 0x00, 0x08, 0x5E, 0x1F, 0x00, 0x00,
+    0x0B, 0x04, 0x17, 0x17, 0x04, 0x00, 0x85, 0x63, 0x68, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0A, 0x04,
+    0x11, 0x15, 0x15, 0x04, 0x00, 0x87, 0x61, 0x6E, 0x67, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x17,
+    0x0C, 0x16, 0x11, 0x12, 0x06, 0x00, 0x84, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x00, 0x48, 0x86, 0x1F,
+    0x00, 0x13, 0x91, 0x1F, 0x00, 0x00, 0x07, 0x04, 0x15, 0x0A, 0x00, 0x83, 0x69, 0x65, 0x6E, 0x74,
+    0x00, 0x15, 0x15, 0x08, 0x0A, 0x11, 0x0C, 0x09, 0x00, 0x84, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x00,
+    0x04, 0x0A, 0x04, 0x19, 0x00, 0x83, 0x72, 0x61, 0x6E, 0x74, 0x00, 0x04, 0x16, 0x11, 0x0C, 0x00,
+    0x83, 0x74, 0x61, 0x6E, 0x74, 0x00, 0x12, 0x0B, 0x16, 0x0F, 0x08, 0x05, 0x18, 0x12, 0x15, 0x17,
+    0x00, 0x86, 0x6C, 0x65, 0x73, 0x68, 0x6F, 0x6F, 0x74, 0x00, 0x48, 0xD3, 0x1F, 0x00, 0x13, 0xDF,
+    0x1F, 0x00, 0x00, 0x10, 0x05, 0x18, 0x0B, 0x00, 0x84, 0x6D, 0x62, 0x65, 0x72, 0x74, 0x00, 0x12,
+    0x16, 0x11, 0x04, 0x15, 0x17, 0x00, 0x83, 0x70, 0x6F, 0x72, 0x74, 0x00, 0x48, 0x01, 0x20, 0x00,
+    0x0A, 0x0B, 0x20, 0x00, 0x0B, 0x16, 0x20, 0x00, 0x0C, 0x36, 0x20, 0x00, 0x1A, 0x43, 0x20, 0x00,
+    0x00, 0x13, 0x0C, 0x0B, 0x06, 0x00, 0x82, 0x73, 0x65, 0x74, 0x00, 0x08, 0x15, 0x04, 0x0F, 0x00,
+    0x83, 0x67, 0x65, 0x73, 0x74, 0x00, 0x48, 0x1F, 0x20, 0x00, 0x12, 0x2A, 0x20, 0x00, 0x00, 0x17,
+    0x15, 0x18, 0x09, 0x00, 0x83, 0x68, 0x65, 0x73, 0x74, 0x00, 0x0F, 0x04, 0x06, 0x12, 0x0F, 0x00,
+    0x83, 0x68, 0x6F, 0x73, 0x74, 0x00, 0x17, 0x0F, 0x16, 0x08, 0x17, 0x00, 0x84, 0x74, 0x6C, 0x69,
+    0x73, 0x74, 0x00, 0x08, 0x08, 0x11, 0x00, 0x83, 0x77, 0x65, 0x73, 0x74, 0x00, 0x51, 0x5E, 0x20,
+    0x00, 0x12, 0x68, 0x20, 0x00, 0x13, 0x79, 0x20, 0x00, 0x16, 0x92, 0x20, 0x00, 0x00, 0x12, 0x10,
+    0x10, 0x04, 0x00, 0x82, 0x75, 0x6E, 0x74, 0x00, 0x1C, 0x04, 0x0F, 0x17, 0x07, 0x16, 0x00, 0x87,
+    0x74, 0x64, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x00, 0x18, 0x12, 0x15, 0x08, 0x0F, 0x17, 0x09,
+    0x0C, 0x1B, 0x04, 0x10, 0x00, 0x8A, 0x66, 0x69, 0x74, 0x6C, 0x65, 0x72, 0x6F, 0x75, 0x70, 0x75,
+    0x74, 0x00, 0x0A, 0x18, 0x04, 0x00, 0x82, 0x75, 0x73, 0x74, 0x00, 0x11, 0x0D, 0x04, 0x11, 0x0C,
+    0x16, 0x00, 0x82, 0x6E, 0x6A, 0x75, 0x00, 0x12, 0x0F, 0x00, 0x44, 0xB3, 0x20, 0x00, 0x0A, 0xBF,
+    0x20, 0x00, 0x00, 0x0F, 0x16, 0x0C, 0x07, 0x00, 0x84, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x00, 0x15,
+    0x07, 0x08, 0x11, 0x18, 0x00, 0x86, 0x64, 0x65, 0x72, 0x67, 0x6C, 0x6F, 0x77, 0x00, 0x08, 0x0F,
+    0x10, 0x13, 0x12, 0x06, 0x00, 0x84, 0x6D, 0x70, 0x6C, 0x65, 0x78, 0x00, 0x44, 0x09, 0x21, 0x00,
+    0x05, 0x16, 0x21, 0x00, 0x06, 0x22, 0x21, 0x00, 0x07, 0x2C, 0x21, 0x00, 0x08, 0x3C, 0x21, 0x00,
+    0x0C, 0x5C, 0x21, 0x00, 0x0E, 0x68, 0x21, 0x00, 0x0F, 0x9B, 0x21, 0x00, 0x11, 0x4F, 0x23, 0x00,
+    0x15, 0x5B, 0x23, 0x00, 0x17, 0xD2, 0x23, 0x00, 0x00, 0x15, 0x15, 0x12, 0x13, 0x10, 0x08, 0x17,
+    0x00, 0x82, 0x61, 0x72, 0x79, 0x00, 0x15, 0x08, 0x08, 0x0B, 0x17, 0x00, 0x83, 0x72, 0x65, 0x62,
+    0x79, 0x00, 0x0E, 0x0C, 0x15, 0x17, 0x00, 0x82, 0x63, 0x6B, 0x79, 0x00, 0x07, 0x18, 0x08, 0x05,
+    0x10, 0x04, 0x0A, 0x00, 0x85, 0x65, 0x62, 0x75, 0x64, 0x64, 0x79, 0x00, 0x4C, 0x45, 0x21, 0x00,
+    0x0F, 0x50, 0x21, 0x00, 0x00, 0x0E, 0x0A, 0x0C, 0x07, 0x00, 0x83, 0x69, 0x6B, 0x65, 0x79, 0x00,
+    0x10, 0x08, 0x15, 0x17, 0x1B, 0x08, 0x00, 0x82, 0x65, 0x6C, 0x79, 0x00, 0x17, 0x15, 0x04, 0x0F,
+    0x12, 0x13, 0x00, 0x82, 0x69, 0x74, 0x79, 0x00, 0x4C, 0x75, 0x21, 0x00, 0x11, 0x80, 0x21, 0x00,
+    0x17, 0x8C, 0x21, 0x00, 0x00, 0x11, 0x0F, 0x13, 0x16, 0x00, 0x83, 0x69, 0x6E, 0x6B, 0x79, 0x00,
+    0x0F, 0x0C, 0x19, 0x16, 0x00, 0x84, 0x6C, 0x69, 0x6E, 0x6B, 0x79, 0x00, 0x17, 0x12, 0x06, 0x0B,
+    0x16, 0x00, 0x86, 0x63, 0x68, 0x6F, 0x74, 0x74, 0x6B, 0x79, 0x00, 0x44, 0xC4, 0x21, 0x00, 0x05,
+    0xCE, 0x21, 0x00, 0x08, 0xDD, 0x21, 0x00, 0x0C, 0x6F, 0x22, 0x00, 0x0E, 0xB2, 0x22, 0x00, 0x0F,
+    0xBC, 0x22, 0x00, 0x11, 0x0B, 0x23, 0x00, 0x15, 0x18, 0x23, 0x00, 0x16, 0x25, 0x23, 0x00, 0x17,
+    0x30, 0x23, 0x00, 0x00, 0x0F, 0x08, 0x15, 0x00, 0x83, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x04, 0x0C,
+    0x08, 0x0F, 0x15, 0x00, 0x86, 0x65, 0x6C, 0x69, 0x61, 0x62, 0x6C, 0x79, 0x00, 0x48, 0xEE, 0x21,
+    0x00, 0x0C, 0xF8, 0x21, 0x00, 0x15, 0x06, 0x22, 0x00, 0x17, 0x11, 0x22, 0x00, 0x00, 0x15, 0x10,
+    0x00, 0x84, 0x65, 0x72, 0x65, 0x6C, 0x79, 0x00, 0x17, 0x11, 0x0C, 0x09, 0x11, 0x0C, 0x00, 0x84,
+    0x69, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x13, 0x12, 0x15, 0x13, 0x00, 0x83, 0x65, 0x72, 0x6C, 0x79,
+    0x00, 0x44, 0x1E, 0x22, 0x00, 0x08, 0x4F, 0x22, 0x00, 0x18, 0x5E, 0x22, 0x00, 0x00, 0x51, 0x27,
+    0x22, 0x00, 0x15, 0x3B, 0x22, 0x00, 0x00, 0x18, 0x17, 0x12, 0x15, 0x09, 0x11, 0x18, 0x00, 0x89,
+    0x6F, 0x72, 0x74, 0x75, 0x6E, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x08, 0x05, 0x0C, 0x08, 0x0F,
+    0x07, 0x00, 0x8A, 0x65, 0x6C, 0x69, 0x62, 0x65, 0x72, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x13,
+    0x0F, 0x10, 0x12, 0x06, 0x00, 0x86, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x0F, 0x12,
+    0x05, 0x16, 0x04, 0x00, 0x88, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x44,
+    0x80, 0x22, 0x00, 0x06, 0x8E, 0x22, 0x00, 0x07, 0x99, 0x22, 0x00, 0x15, 0xA3, 0x22, 0x00, 0x00,
+    0x15, 0x11, 0x0C, 0x07, 0x15, 0x12, 0x00, 0x84, 0x61, 0x72, 0x69, 0x6C, 0x79, 0x00, 0x0E, 0x18,
+    0x0F, 0x00, 0x84, 0x63, 0x6B, 0x69, 0x6C, 0x79, 0x00, 0x13, 0x04, 0x15, 0x00, 0x83, 0x69, 0x64,
+    0x6C, 0x79, 0x00, 0x04, 0x0C, 0x10, 0x15, 0x13, 0x00, 0x86, 0x69, 0x6D, 0x61, 0x72, 0x69, 0x6C,
+    0x79, 0x00, 0x08, 0x0C, 0x0F, 0x00, 0x83, 0x6B, 0x65, 0x6C, 0x79, 0x00, 0x44, 0xC5, 0x22, 0x00,
+    0x05, 0xFF, 0x22, 0x00, 0x00, 0x46, 0xD2, 0x22, 0x00, 0x0C, 0xE4, 0x22, 0x00, 0x17, 0xF3, 0x22,
+    0x00, 0x00, 0x0C, 0x10, 0x11, 0x04, 0x1C, 0x07, 0x00, 0x88, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x61,
+    0x6C, 0x6C, 0x79, 0x00, 0x06, 0x17, 0x06, 0x04, 0x15, 0x13, 0x00, 0x85, 0x69, 0x63, 0x61, 0x6C,
+    0x6C, 0x79, 0x00, 0x18, 0x18, 0x10, 0x00, 0x85, 0x74, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x04,
+    0x12, 0x0F, 0x0A, 0x00, 0x84, 0x62, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x07, 0x12, 0x04, 0x08, 0x15,
+    0x00, 0x84, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x00, 0x07, 0x04, 0x1A, 0x17, 0x18, 0x12, 0x00, 0x83,
+    0x72, 0x64, 0x6C, 0x79, 0x00, 0x08, 0x0F, 0x04, 0x09, 0x00, 0x83, 0x73, 0x65, 0x6C, 0x79, 0x00,
+    0x4B, 0x39, 0x23, 0x00, 0x12, 0x45, 0x23, 0x00, 0x00, 0x0C, 0x0A, 0x11, 0x00, 0x85, 0x69, 0x67,
+    0x68, 0x74, 0x6C, 0x79, 0x00, 0x16, 0x10, 0x00, 0x84, 0x6F, 0x73, 0x74, 0x6C, 0x79, 0x00, 0x0F,
+    0x12, 0x07, 0x04, 0x08, 0x15, 0x00, 0x82, 0x6E, 0x6C, 0x79, 0x00, 0x44, 0x74, 0x23, 0x00, 0x08,
+    0x94, 0x23, 0x00, 0x0A, 0xA0, 0x23, 0x00, 0x0C, 0xA9, 0x23, 0x00, 0x0F, 0xB6, 0x23, 0x00, 0x12,
+    0xC3, 0x23, 0x00, 0x00, 0x47, 0x7D, 0x23, 0x00, 0x12, 0x8A, 0x23, 0x00, 0x00, 0x18, 0x11, 0x12,
+    0x05, 0x00, 0x85, 0x75, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x00, 0x1B, 0x11, 0x00, 0x84, 0x6F, 0x78,
+    0x61, 0x72, 0x79, 0x00, 0x0F, 0x19, 0x0C, 0x16, 0x00, 0x84, 0x6C, 0x76, 0x65, 0x72, 0x79, 0x00,
+    0x08, 0x11, 0x08, 0x00, 0x82, 0x72, 0x67, 0x79, 0x00, 0x17, 0x18, 0x06, 0x15, 0x0C, 0x06, 0x00,
+    0x83, 0x69, 0x74, 0x72, 0x79, 0x00, 0x04, 0x0C, 0x0F, 0x0C, 0x10, 0x0C, 0x16, 0x00, 0x82, 0x72,
+    0x6C, 0x79, 0x00, 0x0A, 0x08, 0x04, 0x17, 0x06, 0x00, 0x86, 0x61, 0x74, 0x65, 0x67, 0x6F, 0x72,
+    0x79, 0x00, 0x49, 0xDB, 0x23, 0x00, 0x0C, 0xE5, 0x23, 0x00, 0x00, 0x08, 0x04, 0x16, 0x00, 0x83,
+    0x66, 0x65, 0x74, 0x79, 0x00, 0x4C, 0xF6, 0x23, 0x00, 0x0F, 0x07, 0x24, 0x00, 0x11, 0x4A, 0x24,
+    0x00, 0x15, 0x55, 0x24, 0x00, 0x00, 0x0F, 0x05, 0x0C, 0x17, 0x04, 0x13, 0x10, 0x12, 0x06, 0x00,
+    0x84, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x4C, 0x10, 0x24, 0x00, 0x18, 0x3F, 0x24, 0x00, 0x00,
+    0x05, 0x00, 0x44, 0x1B, 0x24, 0x00, 0x0C, 0x2A, 0x24, 0x00, 0x00, 0x04, 0x13, 0x06, 0x00, 0x88,
+    0x61, 0x70, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x16, 0x11, 0x13, 0x12, 0x16, 0x08,
+    0x15, 0x00, 0x8A, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x04,
+    0x14, 0x00, 0x85, 0x75, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x16, 0x08, 0x07, 0x00, 0x84, 0x6E,
+    0x73, 0x69, 0x74, 0x79, 0x00, 0x06, 0x18, 0x08, 0x16, 0x00, 0x85, 0x63, 0x75, 0x72, 0x69, 0x74,
+    0x79, 0x00
+};
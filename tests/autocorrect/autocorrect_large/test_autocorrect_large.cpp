@@ -0,0 +1,73 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+
+// This folder's autocorrect_data.h holds 500 typos, generated with --offset-size 3
+
+static std::vector<std::pair<std::string, std::string>> applied;
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    applied.emplace_back(typo, correct);
+    return false;
+}
+
+static const char corpus[] = "the firmware should compile on cenots and the key desnity of the layout is fine. "
+                             "do not foregt to flash the readolny bootloader, and keep the numbeerd layers in order. "
+                             "undersatnding the matrix scan is easier once the buffer walk is cheap. ";
+
+static uint16_t char_to_keycode(char c) {
+    switch (c) {
+        case 'a' ... 'z':
+            return KC_A + (c - 'a');
+        case ',':
+            return KC_COMMA;
+        case '.':
+            return KC_DOT;
+        default:
+            return KC_SPACE;
+    }
+}
+
+class AutoCorrectLarge : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        applied.clear();
+    }
+
+    void type(const char *text) {
+        keyrecord_t record   = {};
+        record.event.type    = KEY_EVENT;
+        record.event.pressed = true;
+        for (const char *c = text; *c; c++) {
+            process_autocorrect(char_to_keycode(*c), &record);
+        }
+    }
+};
+
+TEST_F(AutoCorrectLarge, FirstAndLastEntries) {
+    type(" aadfruit waevshare ");
+    ASSERT_EQ(applied.size(), 2);
+    EXPECT_EQ(applied[0].first, "aadfruit");
+    EXPECT_EQ(applied[0].second, "adafruit");
+    EXPECT_EQ(applied[1].first, "waevshare");
+    EXPECT_EQ(applied[1].second, "waveshare");
+}
+
+TEST_F(AutoCorrectLarge, CorrectWordsAreLeftAlone) {
+    type(" adafruit waveshare understanding density forget ");
+    EXPECT_TRUE(applied.empty());
+}
+
+TEST_F(AutoCorrectLarge, Corpus) {
+    type(corpus);
+    ASSERT_EQ(applied.size(), 6);
+    EXPECT_EQ(applied[5].second, "understanding");
+
+    type(corpus);
+    EXPECT_EQ(applied.size(), 6 * 2);
+}
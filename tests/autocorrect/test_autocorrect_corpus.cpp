@@ -0,0 +1,74 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include "keycode.h"
+#include "test_common.hpp"
+
+// Set while replaying the corpus, so corrections are counted rather than typed
+static bool     count_corrections = false;
+static uint32_t corrections       = 0;
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    if (count_corrections) {
+        corrections++;
+        return false;
+    }
+    return true;
+}
+
+static const char corpus[] = "the firmware should recieve each report before it is sent, and thier layers are checked. "
+                             "a fitler on the matrix removes bounce, but the lenght of the scan and the ouput latency "
+                             "matter more than you would think. it is not fales to say that every keypress counts, "
+                             "so the dictionary walk has to stay cheap even when nothing in the buffer is a typo. ";
+
+static uint16_t char_to_keycode(char c) {
+    switch (c) {
+        case 'a' ... 'z':
+            return KC_A + (c - 'a');
+        case ',':
+            return KC_COMMA;
+        case '.':
+            return KC_DOT;
+        default:
+            return KC_SPACE;
+    }
+}
+
+class AutoCorrectCorpus : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        count_corrections = true;
+        corrections       = 0;
+    }
+
+    void TearDown() override {
+        count_corrections = false;
+    }
+
+    /**
+     * @brief Feeds the corpus `repeats` times straight through process_autocorrect
+     */
+    void replay(uint32_t repeats) {
+        keyrecord_t record   = {};
+        record.event.type    = KEY_EVENT;
+        record.event.pressed = true;
+        for (uint32_t r = 0; r < repeats; r++) {
+            for (const char *c = corpus; *c; c++) {
+                process_autocorrect(char_to_keycode(*c), &record);
+            }
+        }
+    }
+};
+
+TEST_F(AutoCorrectCorpus, FindsEveryTypo) {
+    replay(1);
+    // recieve, thier, fitler, lenght, ouput and fales
+    EXPECT_EQ(corrections, 6);
+}
+
+TEST_F(AutoCorrectCorpus, FindsEveryTypoWhenRepeated) {
+    replay(3);
+    EXPECT_EQ(corrections, 6 * 3);
+}
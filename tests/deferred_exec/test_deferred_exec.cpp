@@ -0,0 +1,100 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+}
+
+static std::vector<uint32_t> calls;
+
+static uint32_t record_call(uint32_t trigger_time, void *cb_arg) {
+    calls.push_back(timer_read32());
+    return (uintptr_t)cb_arg;
+}
+
+class DeferredExecCore : public TestFixture {
+   protected:
+    void SetUp() override {
+        calls.clear();
+    }
+};
+
+TEST_F(DeferredExecCore, RunsFromKeyboardTaskWhenDue) {
+    TestDriver driver;
+    uint32_t   start = timer_read32();
+
+    deferred_token token = defer_exec_core(10, record_call, (void *)0);
+    EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+    idle_for(10);
+    EXPECT_TRUE(calls.empty());
+    run_one_scan_loop();
+    ASSERT_EQ(calls.size(), 1);
+    EXPECT_EQ(calls[0], start + 10);
+
+    // Freed once the callback returns zero
+    EXPECT_FALSE(cancel_deferred_exec_core(token));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DeferredExecCore, RepeatsAndCancels) {
+    TestDriver driver;
+
+    deferred_token token = defer_exec_core(5, record_call, (void *)5);
+    idle_for(21);
+    EXPECT_EQ(calls.size(), 4);
+    EXPECT_TRUE(cancel_deferred_exec_core(token));
+    idle_for(20);
+    EXPECT_EQ(calls.size(), 4);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DeferredExecCore, ExtendPushesTheDeadline) {
+    TestDriver driver;
+
+    deferred_token token = defer_exec_core(10, record_call, (void *)0);
+    idle_for(8);
+    EXPECT_TRUE(extend_deferred_exec_core(token, 10));
+    idle_for(8);
+    EXPECT_TRUE(calls.empty());
+    idle_for(3);
+    EXPECT_EQ(calls.size(), 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Core executors left free, found by filling the table and emptying it again
+static uint8_t free_core_executors(void) {
+    std::vector<deferred_token> tokens;
+    for (deferred_token token; (token = defer_exec_core(1000, record_call, (void *)0)) != INVALID_DEFERRED_TOKEN;) {
+        tokens.push_back(token);
+    }
+    for (auto token : tokens) {
+        cancel_deferred_exec_core(token);
+    }
+    return tokens.size();
+}
+
+TEST_F(DeferredExecCore, LayerLockOnlySchedulesWhileLocked) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+    uint8_t idle = free_core_executors();
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    EXPECT_EQ(free_core_executors(), idle);
+    VERIFY_AND_CLEAR(driver);
+
+    layer_lock_on(1);
+    EXPECT_EQ(free_core_executors(), idle - 1);
+    layer_lock_all_off();
+    EXPECT_EQ(free_core_executors(), idle);
+
+    layer_lock_on(1);
+    layer_lock_off(1);
+    EXPECT_EQ(free_core_executors(), idle);
+}
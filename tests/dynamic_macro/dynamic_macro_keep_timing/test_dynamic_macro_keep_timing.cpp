@@ -0,0 +1,47 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class DynamicMacroKeepTiming : public TestFixture {};
+
+TEST_F(DynamicMacroKeepTiming, PlaybackKeepsRecordedGaps) {
+    TestDriver driver;
+    KeymapKey  key_record = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_stop   = KeymapKey(0, 1, 0, DM_RSTP);
+    KeymapKey  key_play   = KeymapKey(0, 2, 0, DM_PLY1);
+    KeymapKey  key_a      = KeymapKey(0, 3, 0, KC_A);
+    KeymapKey  key_b      = KeymapKey(0, 4, 0, KC_B);
+    set_keymap({key_record, key_stop, key_play, key_a, key_b});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    tap_key(key_record);
+    tap_key(key_a);
+    idle_for(300);
+    tap_key(key_b);
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    InSequence s;
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_play);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(250);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    idle_for(100);
+    EXPECT_FALSE(output_queue_is_busy());
+    VERIFY_AND_CLEAR(driver);
+}
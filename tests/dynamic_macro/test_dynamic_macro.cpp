@@ -0,0 +1,99 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class DynamicMacro : public TestFixture {
+   protected:
+    KeymapKey key_record = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey key_stop   = KeymapKey(0, 1, 0, DM_RSTP);
+    KeymapKey key_play   = KeymapKey(0, 2, 0, DM_PLY1);
+    KeymapKey key_a      = KeymapKey(0, 3, 0, KC_A);
+    KeymapKey key_b      = KeymapKey(0, 4, 0, KC_B);
+    KeymapKey key_lt     = KeymapKey(0, 5, 0, LT(1, KC_C));
+    KeymapKey key_d      = KeymapKey(0, 6, 0, KC_D);
+    KeymapKey key_d_l1   = KeymapKey(1, 6, 0, KC_E);
+    // The last matrix position, to cover the largest packed key index
+    KeymapKey key_last = KeymapKey(0, MATRIX_COLS - 1, MATRIX_ROWS - 1, KC_F);
+
+    void SetUp() override {
+        set_keymap({key_record, key_stop, key_play, key_a, key_b, key_lt, key_d, key_d_l1, key_last});
+    }
+};
+
+TEST_F(DynamicMacro, RecordedKeysPlayBackInOrder) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    tap_key(key_record);
+    tap_keys(key_a, key_b, key_last);
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    InSequence s;
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_F));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    tap_key(key_play);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, TapStateIsKept) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    tap_key(key_record);
+    tap_key(key_lt);
+    idle_for(TAPPING_TERM);
+    // Held past the tapping term, so layer 1 is active for the tap of key_d
+    key_lt.press();
+    idle_for(TAPPING_TERM + 1);
+    tap_key(key_d);
+    key_lt.release();
+    run_one_scan_loop();
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    InSequence s;
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    tap_key(key_play);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, PackedEventsMultiplyCapacity) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    tap_key(key_record);
+    const uint8_t taps = 40;
+    for (uint8_t i = 0; i < taps; i++) {
+        tap_key(i % 2 ? key_a : key_b, 20);
+        idle_for(50);
+    }
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    uint32_t played = 0;
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A))).WillRepeatedly([&](const report_keyboard_t &) { played++; });
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B))).WillRepeatedly([&](const report_keyboard_t &) { played++; });
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    tap_key(key_play);
+    VERIFY_AND_CLEAR(driver);
+
+    // Each keyrecord_t slot used to hold one event, half a keypress
+    uint32_t legacy = DYNAMIC_MACRO_SIZE / 2;
+    EXPECT_GE(played, legacy * 3);
+}
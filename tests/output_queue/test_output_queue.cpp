@@ -0,0 +1,150 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class OutputQueue : public TestFixture {};
+
+TEST_F(OutputQueue, AsyncStringIsTypedByTheMainLoop) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_NO_REPORT(driver);
+    send_string_async("a" SS_DELAY(100) "b");
+    EXPECT_TRUE(output_queue_is_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(98);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(2);
+    EXPECT_FALSE(output_queue_is_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(OutputQueue, KeysPressedDuringPlaybackAreReplayedAfterwards) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_c = KeymapKey(0, 0, 0, KC_C);
+    set_keymap({key_c});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async("a" SS_DELAY(100) "b");
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_c);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(OutputQueue, BlockingStringWaitsForQueuedOutput) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    uint16_t start = timer_read();
+    send_string_async("a" SS_DELAY(50));
+    send_string("b");
+    EXPECT_GE(timer_elapsed(start), 50);
+    EXPECT_FALSE(output_queue_is_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+static uint16_t send_blocking_string_step(void) {
+    send_string("x");
+    return OUTPUT_QUEUE_STEP_DONE;
+}
+
+TEST_F(OutputQueue, BlockingStringInsideAsyncStringKeepsTheOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    for (uint8_t keycode = KC_A; keycode <= KC_L; keycode++) {
+        EXPECT_REPORT(driver, (keycode));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    // The queue fills up part way through, running the step and its blocking string
+    output_queue_step(send_blocking_string_step);
+    send_string_async("abcdefghijkl");
+    EXPECT_TRUE(output_queue_is_busy());
+    run_one_scan_loop();
+    EXPECT_FALSE(output_queue_is_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(OutputQueue, StringsLongerThanTheQueueAreNotTruncated) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    send_string_async("abcdefghijklmnopqrstuvwxyz");
+    EXPECT_TRUE(output_queue_is_busy());
+    run_one_scan_loop();
+    EXPECT_FALSE(output_queue_is_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(OutputQueue, DynamicMacroPlaysWithoutBlockingTheScan) {
+    TestDriver driver;
+    KeymapKey  key_record = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_stop   = KeymapKey(0, 1, 0, DM_RSTP);
+    KeymapKey  key_play   = KeymapKey(0, 2, 0, DM_PLY1);
+    KeymapKey  key_a      = KeymapKey(0, 3, 0, KC_A);
+    KeymapKey  key_c      = KeymapKey(0, 4, 0, KC_C);
+    set_keymap({key_record, key_stop, key_play, key_a, key_c});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    tap_key(key_record);
+    tap_key(key_a);
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+        EXPECT_REPORT(driver, (KC_C));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+
+        key_play.press();
+        run_one_scan_loop();
+        key_play.release();
+        run_one_scan_loop();
+        EXPECT_TRUE(output_queue_is_busy());
+
+        // Scanned mid playback, typed once the macro is done
+        key_c.press();
+        run_one_scan_loop();
+        key_c.release();
+        idle_for(10);
+        EXPECT_FALSE(output_queue_is_busy());
+    }
+    VERIFY_AND_CLEAR(driver);
+}
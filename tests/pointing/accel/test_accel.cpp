@@ -0,0 +1,112 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+
+class PointingAccel : public TestFixture {
+   public:
+    void SetUp() override {
+        pointing_device_accel_init();
+    }
+};
+
+TEST_F(PointingAccel, SlowMovementIsUnchanged) {
+    TestDriver driver;
+
+    pd_set_x(1);
+    pd_set_y(-2);
+    EXPECT_MOUSE_REPORT(driver, (1, -2, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, FastMovementIsInterpolated) {
+    TestDriver driver;
+
+    // default curve: 2.0x at 16 counts, 3.0x at 48 counts
+    pd_set_x(-32);
+    EXPECT_MOUSE_REPORT(driver, (-80, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, GainIsFlatAboveLastPoint) {
+    TestDriver driver;
+
+    pd_set_y(60);
+    EXPECT_MOUSE_REPORT(driver, (0, XY_REPORT_MAX, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(pointing_device_accel_get_gain(200 << POINTING_DEVICE_ACCEL_SPEED_SHIFT), POINTING_DEVICE_ACCEL_GAIN(3.0));
+}
+
+TEST_F(PointingAccel, SubPixelRemainderIsCarried) {
+    TestDriver                          driver;
+    const pointing_device_accel_point_t half[] = {{0, POINTING_DEVICE_ACCEL_GAIN(0.5)}};
+
+    EXPECT_TRUE(pointing_device_accel_set_curve(half, 1));
+
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_clear_movement();
+    run_one_scan_loop();
+}
+
+TEST_F(PointingAccel, DisabledPassesThrough) {
+    TestDriver driver;
+
+    pointing_device_accel_set_enabled(false);
+    EXPECT_FALSE(pointing_device_accel_get_enabled());
+
+    pd_set_x(32);
+    EXPECT_MOUSE_REPORT(driver, (32, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, InvalidCurveIsRejected) {
+    const pointing_device_accel_point_t unordered[] = {{8, POINTING_DEVICE_ACCEL_GAIN(1.0)}, {4, POINTING_DEVICE_ACCEL_GAIN(2.0)}};
+
+    EXPECT_FALSE(pointing_device_accel_set_curve(unordered, 2));
+    EXPECT_FALSE(pointing_device_accel_set_curve(unordered, 0));
+    EXPECT_EQ(pointing_device_accel_get_gain(0), POINTING_DEVICE_ACCEL_GAIN(1.0));
+}
+
+TEST_F(PointingAccel, SpeedOutOfRangeIsRejected) {
+    const pointing_device_accel_point_t too_fast[] = {{0, POINTING_DEVICE_ACCEL_GAIN(1.0)}, {POINTING_DEVICE_ACCEL_SPEED_MAX + 1, POINTING_DEVICE_ACCEL_GAIN(2.0)}};
+    const pointing_device_accel_point_t fastest[]  = {{0, POINTING_DEVICE_ACCEL_GAIN(1.0)}, {POINTING_DEVICE_ACCEL_SPEED_MAX, POINTING_DEVICE_ACCEL_GAIN(2.0)}};
+
+    EXPECT_FALSE(pointing_device_accel_set_curve(too_fast, 2));
+    EXPECT_EQ(pointing_device_accel_get_gain(UINT16_MAX), POINTING_DEVICE_ACCEL_GAIN(3.0));
+
+    EXPECT_TRUE(pointing_device_accel_set_curve(fastest, 2));
+    EXPECT_EQ(pointing_device_accel_get_gain(UINT16_MAX), POINTING_DEVICE_ACCEL_GAIN(2.0));
+}
@@ -0,0 +1,18 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+# Enough handlers, with and without a registered keycode range, to make the dispatch cost visible
+AUDIO_ENABLE = yes
+CAPS_WORD_ENABLE = yes
+DYNAMIC_TAPPING_TERM_ENABLE = yes
+GRAVE_ESC_ENABLE = yes
+LAYER_LOCK_ENABLE = yes
+LEADER_ENABLE = yes
+MAGIC_ENABLE = yes
+REPEAT_KEY_ENABLE = yes
+SPACE_CADET_ENABLE = yes
+TRI_LAYER_ENABLE = yes
@@ -0,0 +1,68 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+static bool block_user_keycodes = false;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    return !block_user_keycodes;
+}
+
+class ProcessRecordDispatch : public TestFixture {
+   protected:
+    void TearDown() override {
+        block_user_keycodes = false;
+    }
+};
+
+TEST_F(ProcessRecordDispatch, RangeHandlerReceivesItsKeycodes) {
+    TestDriver driver;
+    KeymapKey  key_gesc  = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    KeymapKey  key_lower = KeymapKey(0, 1, 0, QK_TRI_LAYER_LOWER);
+    set_keymap({key_gesc, key_lower, KeymapKey(1, 1, 0, KC_TRNS)});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_gesc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    key_lower.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, UserStillRunsBeforeRangeHandlers) {
+    TestDriver driver;
+    KeymapKey  key_gesc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    set_keymap({key_gesc});
+
+    block_user_keycodes = true;
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_gesc);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, ObservingHandlerSeesEveryKeycode) {
+    TestDriver driver;
+    KeymapKey  key_a     = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_space = KeymapKey(0, 1, 0, KC_SPACE);
+    set_keymap({key_a, key_space});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    caps_word_on();
+    tap_key(key_a);
+    EXPECT_TRUE(is_caps_word_on());
+    tap_key(key_space);
+    EXPECT_FALSE(is_caps_word_on());
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,15 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 44
+#define RGB_MATRIX_LED_PROCESS_LIMIT 0
+#define RGB_MATRIX_KEYPRESSES
+#define ENABLE_RGB_MATRIX_TYPING_HEATMAP
+#define ENABLE_RGB_MATRIX_DIGITAL_RAIN
+#define RGB_MATRIX_FRAMEBUFFER_EFFECTS
+// Small enough that the last keys measure distances on each press
+#define RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS 200
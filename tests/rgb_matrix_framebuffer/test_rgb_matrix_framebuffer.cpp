@@ -0,0 +1,127 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+bool TYPING_HEATMAP(effect_params_t *params);
+bool DIGITAL_RAIN(effect_params_t *params);
+void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col);
+}
+
+#define KEY_LED_COUNT (MATRIX_ROWS * MATRIX_COLS)
+
+static rgb_t leds[RGB_MATRIX_LED_COUNT];
+
+static void test_driver_init(void) {}
+
+static void test_driver_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    leds[index] = {r, g, b};
+}
+
+static void test_driver_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (auto &led : leds) {
+        led = {r, g, b};
+    }
+}
+
+static void test_driver_flush(void) {}
+
+extern "C" const rgb_matrix_driver_t rgb_matrix_driver = {test_driver_init, test_driver_set_color, test_driver_set_color_all, test_driver_flush};
+
+// One LED per key over the usual 224x64 space, then underglow LEDs that belong to no key
+static led_config_t make_led_config(void) {
+    led_config_t config = {};
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t i                  = row * MATRIX_COLS + col;
+            config.matrix_co[row][col] = i;
+            config.point[i]            = {(uint8_t)(col * 224 / (MATRIX_COLS - 1)), (uint8_t)(row * 64 / (MATRIX_ROWS - 1))};
+            config.flags[i]            = LED_FLAG_KEYLIGHT;
+        }
+    }
+    for (uint8_t i = KEY_LED_COUNT; i < RGB_MATRIX_LED_COUNT; i++) {
+        config.point[i] = {(uint8_t)((i - KEY_LED_COUNT) * 70), 32};
+        config.flags[i] = LED_FLAG_UNDERGLOW;
+    }
+    return config;
+}
+
+extern "C" led_config_t g_led_config = make_led_config();
+
+class RgbMatrixFramebuffer : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgb_matrix_config.hsv = {0, 255, 100};
+    }
+
+    void render(bool (*effect)(effect_params_t *), bool init) {
+        effect_params_t params = {};
+        params.flags           = LED_FLAG_ALL;
+        params.init            = init;
+        effect(&params);
+    }
+};
+
+TEST_F(RgbMatrixFramebuffer, HeatmapMatchesKnownValues) {
+    // Recorded from the matrix indexed framebuffer this replaced
+    const uint8_t expected[MATRIX_ROWS][MATRIX_COLS] = {
+        {32, 16, 0, 16, 32, 16, 0, 0, 0, 0},
+        {16, 9, 0, 30, 72, 46, 8, 0, 0, 0},
+        {0, 0, 0, 16, 47, 48, 15, 0, 7, 16},
+        {0, 0, 0, 0, 7, 16, 7, 0, 15, 32},
+    };
+    const uint8_t presses[][2] = {{1, 4}, {1, 4}, {2, 5}, {0, 0}, {3, 9}};
+
+    render(&TYPING_HEATMAP, true);
+    for (auto &press : presses) {
+        process_rgb_matrix_typing_heatmap(press[0], press[1]);
+    }
+
+    for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+        for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+            EXPECT_EQ(g_rgb_frame_buffer[g_led_config.matrix_co[r][c]], expected[r][c]) << "key " << (int)r << "," << (int)c;
+        }
+    }
+    for (uint8_t i = KEY_LED_COUNT; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(g_rgb_frame_buffer[i], 0) << "underglow led " << (int)i;
+    }
+}
+
+TEST_F(RgbMatrixFramebuffer, HeatmapRendersEveryLed) {
+    render(&TYPING_HEATMAP, true);
+    process_rgb_matrix_typing_heatmap(1, 4);
+    process_rgb_matrix_typing_heatmap(1, 4);
+    uint8_t heat[RGB_MATRIX_LED_COUNT];
+    memcpy(heat, g_rgb_frame_buffer, sizeof(heat));
+    test_driver_set_color_all(1, 1, 1);
+    render(&TYPING_HEATMAP, false);
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (heat[i] == 0) {
+            EXPECT_EQ(leds[i].r | leds[i].g | leds[i].b, 0) << "led " << (int)i;
+        }
+    }
+    uint8_t pressed = g_led_config.matrix_co[1][4];
+    EXPECT_GT(leds[pressed].r | leds[pressed].g | leds[pressed].b, 0);
+}
+
+TEST_F(RgbMatrixFramebuffer, DigitalRainFallsOnKeysOnly) {
+    bool lit = false;
+    srand(42);
+    for (uint16_t f = 0; f < 2000; f++) {
+        render(&DIGITAL_RAIN, f == 0);
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            // Green, brightening towards white at the head of a drop
+            ASSERT_EQ(leds[i].r, leds[i].b) << "frame " << f << " led " << (int)i;
+            ASSERT_GE(leds[i].g, leds[i].r) << "frame " << f << " led " << (int)i;
+            if (i >= KEY_LED_COUNT) {
+                ASSERT_EQ(leds[i].g, 0) << "frame " << f << " underglow led " << (int)i;
+            }
+            lit |= i >= MATRIX_COLS && i < KEY_LED_COUNT && leds[i].g > 0;
+        }
+    }
+    // Drops made it past the top row
+    EXPECT_TRUE(lit);
+}
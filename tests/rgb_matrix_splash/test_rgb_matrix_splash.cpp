@@ -0,0 +1,179 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "lib/lib8tion/lib8tion.h"
+
+hsv_t SOLID_SPLASH_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+bool  SOLID_MULTISPLASH(effect_params_t *params);
+bool  MULTISPLASH(effect_params_t *params);
+bool  SOLID_REACTIVE_MULTINEXUS(effect_params_t *params);
+bool  SOLID_REACTIVE_MULTICROSS(effect_params_t *params);
+bool  SOLID_REACTIVE_MULTIWIDE(effect_params_t *params);
+}
+
+static rgb_t leds[RGB_MATRIX_LED_COUNT];
+
+static void test_driver_init(void) {}
+
+static void test_driver_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    leds[index] = {r, g, b};
+}
+
+static void test_driver_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (auto &led : leds) {
+        led = {r, g, b};
+    }
+}
+
+static void test_driver_flush(void) {}
+
+extern "C" const rgb_matrix_driver_t rgb_matrix_driver = {test_driver_init, test_driver_set_color, test_driver_set_color_all, test_driver_flush};
+
+// One LED per key, spread over the usual 224x64 space
+static led_config_t make_led_config(void) {
+    led_config_t config = {};
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t i                  = row * MATRIX_COLS + col;
+            config.matrix_co[row][col] = i;
+            config.point[i]            = {(uint8_t)(col * 224 / (MATRIX_COLS - 1)), (uint8_t)(row * 64 / (MATRIX_ROWS - 1))};
+            config.flags[i]            = LED_FLAG_KEYLIGHT;
+        }
+    }
+    return config;
+}
+
+extern "C" led_config_t g_led_config = make_led_config();
+
+typedef hsv_t (*splash_math_t)(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+
+static hsv_t cross_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+    uint16_t effect = tick + dist;
+    dx              = dx < 0 ? dx * -1 : dx;
+    dy              = dy < 0 ? dy * -1 : dy;
+    dx              = dx * 16 > 255 ? 255 : dx * 16;
+    dy              = dy * 16 > 255 ? 255 : dy * 16;
+    effect += dx > dy ? dy : dx;
+    if (effect > 255) effect = 255;
+    hsv.v = qadd8(hsv.v, 255 - effect);
+    return hsv;
+}
+
+static hsv_t wide_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+    uint16_t effect = tick + dist * 5;
+    if (effect > 255) effect = 255;
+    hsv.v = qadd8(hsv.v, 255 - effect);
+    return hsv;
+}
+
+class RgbMatrixSplash : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgb_matrix_config.hsv   = {0, 255, 255};
+        rgb_matrix_config.speed = 128;
+        g_last_hit_tracker      = {};
+    }
+
+    /**
+     * @brief Records `count` hits on pseudo random keys, of ages spread across the whole fade out
+     */
+    void add_hits(uint8_t count, uint32_t seed) {
+        g_last_hit_tracker.count = count;
+        for (uint8_t j = 0; j < count; j++) {
+            seed                        = seed * 1103515245 + 12345;
+            uint8_t i                   = (seed >> 16) % RGB_MATRIX_LED_COUNT;
+            g_last_hit_tracker.x[j]     = g_led_config.point[i].x;
+            g_last_hit_tracker.y[j]     = g_led_config.point[i].y;
+            g_last_hit_tracker.index[j] = i;
+            g_last_hit_tracker.tick[j]  = (seed >> 8) % 1200;
+        }
+    }
+
+    void render(bool (*effect)(effect_params_t *)) {
+        effect_params_t params = {};
+        params.flags           = LED_FLAG_ALL;
+        effect(&params);
+    }
+
+    // Every LED against every hit with sqrt16, as the runner did before the grid
+    void render_reference(splash_math_t math) {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            hsv_t hsv = rgb_matrix_config.hsv;
+            hsv.v     = 0;
+            for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+                int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+                int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+                uint8_t  dist = sqrt16(dx * dx + dy * dy);
+                uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
+                hsv           = math(hsv, dx, dy, dist, tick);
+            }
+            hsv.v     = scale8(hsv.v, rgb_matrix_config.hsv.v);
+            rgb_t rgb = hsv_to_rgb(hsv);
+            test_driver_set_color(i, rgb.r, rgb.g, rgb.b);
+        }
+    }
+
+    void expect_matches_reference(bool (*effect)(effect_params_t *), splash_math_t math) {
+        for (uint32_t seed = 1; seed < 200; seed++) {
+            add_hits(1 + seed % LED_HITS_TO_REMEMBER, seed);
+            render_reference(math);
+            rgb_t expected[RGB_MATRIX_LED_COUNT];
+            memcpy(expected, leds, sizeof(leds));
+            render(effect);
+            for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+                ASSERT_EQ(leds[i].r, expected[i].r) << "seed " << seed << " led " << (int)i;
+                ASSERT_EQ(leds[i].g, expected[i].g) << "seed " << seed << " led " << (int)i;
+                ASSERT_EQ(leds[i].b, expected[i].b) << "seed " << seed << " led " << (int)i;
+            }
+        }
+    }
+};
+
+TEST_F(RgbMatrixSplash, SolidSplashMatchesReference) {
+    expect_matches_reference(&SOLID_MULTISPLASH, &SOLID_SPLASH_math);
+}
+
+TEST_F(RgbMatrixSplash, CrossMatchesReference) {
+    expect_matches_reference(&SOLID_REACTIVE_MULTICROSS, &cross_math);
+}
+
+TEST_F(RgbMatrixSplash, WideMatchesReference) {
+    expect_matches_reference(&SOLID_REACTIVE_MULTIWIDE, &wide_math);
+}
+
+TEST_F(RgbMatrixSplash, DistanceTableMatchesSqrt) {
+    // Hits on every key so each LED pair distance goes through the table or the fallback
+    for (uint8_t start = 0; start < RGB_MATRIX_LED_COUNT; start += LED_HITS_TO_REMEMBER) {
+        g_last_hit_tracker.count = LED_HITS_TO_REMEMBER;
+        for (uint8_t j = 0; j < LED_HITS_TO_REMEMBER; j++) {
+            uint8_t i                  = (start + j) % RGB_MATRIX_LED_COUNT;
+            g_last_hit_tracker.x[j]    = g_led_config.point[i].x;
+            g_last_hit_tracker.y[j]    = g_led_config.point[i].y;
+            g_last_hit_tracker.tick[j] = 200;
+        }
+        render_reference(&SOLID_SPLASH_math);
+        rgb_t expected[RGB_MATRIX_LED_COUNT];
+        memcpy(expected, leds, sizeof(leds));
+        render(&SOLID_MULTISPLASH);
+        EXPECT_EQ(memcmp(leds, expected, sizeof(leds)), 0);
+    }
+}
+
+TEST_F(RgbMatrixSplash, FadedHitsLeaveLedsDark) {
+    add_hits(LED_HITS_TO_REMEMBER, 7);
+    for (uint8_t j = 0; j < LED_HITS_TO_REMEMBER; j++) {
+        g_last_hit_tracker.tick[j] = UINT16_MAX;
+    }
+    bool (*effects[])(effect_params_t *) = {&SOLID_MULTISPLASH, &MULTISPLASH, &SOLID_REACTIVE_MULTINEXUS, &SOLID_REACTIVE_MULTICROSS, &SOLID_REACTIVE_MULTIWIDE};
+    for (auto effect : effects) {
+        test_driver_set_color_all(1, 1, 1);
+        render(effect);
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            EXPECT_EQ(leds[i].r | leds[i].g | leds[i].b, 0) << "led " << (int)i;
+        }
+    }
+}
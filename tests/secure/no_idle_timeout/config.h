@@ -0,0 +1,17 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// clang-format off
+#define SECURE_UNLOCK_SEQUENCE \
+    {                          \
+        {0, 1},                \
+        {0, 2}                 \
+    }
+// clang-format on
+
+#define SECURE_UNLOCK_TIMEOUT 20
+#define SECURE_IDLE_TIMEOUT 0
@@ -0,0 +1,50 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+
+class SecureNoIdleTimeout : public TestFixture {
+   public:
+    void SetUp() override {
+        secure_lock();
+    }
+};
+
+TEST_F(SecureNoIdleTimeout, UnlockDoesNotTimeOut) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+
+    secure_unlock();
+    EXPECT_TRUE(secure_is_unlocked());
+    idle_for(1000);
+    EXPECT_TRUE(secure_is_unlocked());
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SecureNoIdleTimeout, UnlockRequestTimeoutIsCancelled) {
+    TestDriver driver;
+    auto       key_mo = KeymapKey(0, 0, 0, MO(1));
+    auto       key_a  = KeymapKey(0, 1, 0, KC_A);
+    auto       key_b  = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({key_mo, key_a, key_b});
+
+    EXPECT_NO_REPORT(driver);
+
+    secure_request_unlock();
+    EXPECT_TRUE(secure_is_unlocking());
+    tap_keys(key_a, key_b);
+    EXPECT_TRUE(secure_is_unlocked());
+
+    // The pending unlock timeout must not lock the keyboard again
+    idle_for(SECURE_UNLOCK_TIMEOUT * 2);
+    EXPECT_TRUE(secure_is_unlocked());
+
+    VERIFY_AND_CLEAR(driver);
+}
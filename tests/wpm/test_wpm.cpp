@@ -0,0 +1,61 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+class Wpm : public TestFixture {
+   protected:
+    // Taps `key` `count` times, one press every `interval` milliseconds
+    void type(KeymapKey key, uint16_t count, uint16_t interval) {
+        for (uint16_t i = 0; i < count; i++) {
+            key.press();
+            run_one_scan_loop();
+            key.release();
+            idle_for(interval - 1);
+        }
+    }
+};
+
+TEST_F(Wpm, SteadyTypingSettles) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    // Ten keys a second is 120 WPM at five keys per word
+    type(key_a, 60, 100);
+    EXPECT_GE(get_current_wpm(), 110);
+    EXPECT_LE(get_current_wpm(), 130);
+
+    idle_for(WPM_SAMPLE_SECONDS * 1000 + 500);
+    EXPECT_EQ(get_target_wpm(), 0);
+    EXPECT_EQ(get_current_wpm(), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Wpm, EstimateOnlyChangesAtPeriodEnds) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    type(key_a, 30, 100);
+
+    // While idle the estimate moves once per period, the reported value follows it smoothly
+    uint8_t  target  = get_target_wpm();
+    uint16_t changes = 0;
+    for (uint16_t ms = 0; ms < 1000; ms++) {
+        run_one_scan_loop();
+        if (get_target_wpm() != target) {
+            target = get_target_wpm();
+            changes++;
+        }
+    }
+    EXPECT_GT(changes, 0);
+    EXPECT_LE(changes, 1000 * WPM_SAMPLE_PERIODS / (WPM_SAMPLE_SECONDS * 1000) + 1);
+    VERIFY_AND_CLEAR(driver);
+}
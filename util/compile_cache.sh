@@ -0,0 +1,130 @@
+#!/usr/bin/env bash
+
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Content addressed object cache, used as the compiler prefix:
+#
+#     util/compile_cache.sh [--launcher <launcher>] <cache dir> <compiler> <arguments>...
+#
+# An object is keyed on the compiler, the source after preprocessing, and every argument that isn't a preprocessor
+# one, so a translation unit that comes out the same for two keyboards is only compiled once. Dependency files are
+# still written for every build, and a hit replays whatever the compiler printed the first time. Anything other than a
+# plain compile to an object file, or one that leaves files beside the object, is passed straight through.
+#
+# A launcher such as ccache runs every compile this cache doesn't answer itself.
+#
+# If COMPILE_CACHE_STATS names a file, "hit" or "miss" is appended to it for each object.
+
+set -o pipefail
+
+launcher=()
+if [[ $1 == --launcher ]]; then
+    launcher=("$2")
+    shift 2
+fi
+cache_dir=$1
+compiler=$2
+shift 2
+original=("$@")
+
+if command -v sha1sum >/dev/null; then
+    digest=sha1sum
+else
+    digest="shasum -a 1"
+fi
+
+object=
+sources=()
+compiling=no
+passthrough=no
+has_target=no
+has_deps=no
+cpp_args=()
+key_args=()
+while [[ $# -gt 0 ]]; do
+    arg=$1
+    shift
+    case $arg in
+        -c)
+            compiling=yes
+            ;;
+        -o)
+            object=$1
+            shift
+            ;;
+        -MT | -MQ)
+            has_target=yes
+            cpp_args+=("$arg" "$1")
+            shift
+            ;;
+        -I | -D | -U | -include | -imacros | -isystem | -iquote | -idirafter | -MF)
+            cpp_args+=("$arg" "$1")
+            shift
+            ;;
+        -M*)
+            has_deps=yes
+            cpp_args+=("$arg")
+            ;;
+        -I* | -D* | -U*)
+            cpp_args+=("$arg")
+            ;;
+        -g* | -v | -H | -save-temps* | -Wa,-a* | -fstack-usage | -fdump-* | -fcallgraph-info*)
+            passthrough=yes
+            ;;
+        -x | --param | -Xassembler | -Xlinker | -Xpreprocessor)
+            key_args+=("$arg" "$1")
+            shift
+            ;;
+        -*)
+            key_args+=("$arg")
+            ;;
+        *)
+            sources+=("$arg")
+            ;;
+    esac
+done
+
+if [[ $compiling != yes || -z $object || ${#sources[@]} -ne 1 || $passthrough == yes ]]; then
+    exec "${launcher[@]}" "$compiler" "${original[@]}"
+fi
+
+# Preprocessing also writes the dependency file, which has to name the object this build asked for
+if [[ $has_deps == yes && $has_target == no ]]; then
+    cpp_args+=(-MT "$object")
+fi
+
+if ! key=$(
+    {
+        printf '%s\0' "$(command -v "$compiler")" "${sources[0]}" "${key_args[@]}"
+        "$compiler" --version || exit 1
+        "$compiler" "${cpp_args[@]}" "${key_args[@]}" -E -P "${sources[0]}" 2>/dev/null || exit 1
+    } | $digest
+); then
+    # Let the compiler report whatever went wrong
+    exec "${launcher[@]}" "$compiler" "${original[@]}"
+fi
+key=${key%% *}
+entry=$cache_dir/${key:0:2}/${key:2}
+
+if [[ -f $entry.o && -f $entry.log ]] && cp -f "$entry.o" "$object"; then
+    cat "$entry.log" >&2
+    [[ -n $COMPILE_CACHE_STATS ]] && echo hit >>"$COMPILE_CACHE_STATS"
+    exit 0
+fi
+
+mkdir -p "$cache_dir/${key:0:2}"
+log=$(mktemp "$entry.XXXXXX") || exec "${launcher[@]}" "$compiler" "${original[@]}"
+"${launcher[@]}" "$compiler" "${original[@]}" 2>"$log"
+status=$?
+cat "$log" >&2
+
+# The object goes in last, so an entry is only ever seen complete
+if [[ $status -eq 0 ]]; then
+    mv -f "$log" "$entry.log" \
+        && cp -f "$object" "$entry.o.$$" \
+        && mv -f "$entry.o.$$" "$entry.o"
+fi
+rm -f "$log" "$entry.o.$$"
+[[ -n $COMPILE_CACHE_STATS ]] && echo miss >>"$COMPILE_CACHE_STATS"
+exit $status